@@ -5,6 +5,7 @@
  *      Author: anderson
  *
  *  Updated   : Dec. 9, 2023 (C.R. Anderson)
+ *  Updated   : Oct. 18, 2026 (C.R. Anderson)
  */
 //
 // Instances of this class are N x N banded matrices with double entries
@@ -37,7 +38,10 @@
 //
 // Bounds checking is only done if _DEBUG is defined
 //
-// Lapack routine dependencies : dgbmv_
+// The class is a template, LapackBandMatrixT<T>, with T = double or T = float.
+// LapackBandMatrix is LapackBandMatrixT<double>.
+//
+// Lapack routine dependencies : dgbmv_ (sgbmv_ for single precision)
 /*
 #############################################################################
 #
@@ -68,30 +72,34 @@
 #endif
 
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 
 #include "SCC_LapackHeaders.h"
 #include "SCC_LapackMatrix.h"
+#include "SCC_LapackTraits.h"
 
 #ifndef SCC_LAPACK_BAND_MATRIX_
 #define SCC_LAPACK_BAND_MATRIX_
 
 namespace SCC
 {
-class LapackBandMatrix
+template <class T>
+class LapackBandMatrixT
 {
 	public:
 
-	LapackBandMatrix()
+	LapackBandMatrixT()
 	{
 	initialize();
 	}
 
-    LapackBandMatrix(const LapackBandMatrix& S)
+    LapackBandMatrixT(const LapackBandMatrixT& S)
 	{
     	initialize(S);
 	}
 
-	LapackBandMatrix(long kl, long ku, long N)
+	LapackBandMatrixT(long kl, long ku, long N)
 	{
 	    initialize(kl,ku,N);
 	}
@@ -104,7 +112,7 @@ class LapackBandMatrix
     	N  = 0;
 	}
 
-	void initialize(const LapackBandMatrix& S)
+	void initialize(const LapackBandMatrixT& S)
 	{
 		kl = S.kl;
 		ku = S.ku;
@@ -122,13 +130,13 @@ class LapackBandMatrix
 
 
 	#ifdef _DEBUG
-	double& operator()(long i, long j)
+	T& operator()(long i, long j)
 	{
 		assert(boundsCheck(i,j));
 		return mData(ku +  (i-j),j);
 	}
 
-    const double& operator()(long i, long j) const
+    const T& operator()(long i, long j) const
 	{
     	assert(boundsCheck(i,j));
 		return mData(ku +  (i-j),j);
@@ -138,24 +146,108 @@ class LapackBandMatrix
 
 
 	#else
-	inline double& operator()(long i, long j)
+	inline T& operator()(long i, long j)
 	{
 
 		return mData(ku +  (i-j),j);
 	}
 
-    inline const double& operator()(long i, long j) const
+    inline const T& operator()(long i, long j) const
 	{
 		return mData(ku +  (i-j),j);
 	}
 	#endif
 
-	double* getDataPointer() const {return mData.dataPtr;}
+	T* getDataPointer() const {return mData.dataPtr;}
+
+	//
+	// Initializes with the entries of the square matrix M. The bandwidths
+	// kl and ku are the smallest for which all entries of M with absolute
+	// value greater than dropTol are contained in the band.
+	//
+	void initialize(const LapackMatrixT<T>& M, T dropTol = 0.0)
+	{
+		assert(sizeCheck(M.rows,M.cols));
+
+		long Msize = M.rows;
+		long lower = 0;
+		long upper = 0;
+
+		for(long j = 0; j < Msize; j++)
+		{
+		for(long i = 0; i < Msize; i++)
+		{
+		if(std::abs(M(i,j)) > dropTol)
+		{
+			lower = std::max(lower,i-j);
+			upper = std::max(upper,j-i);
+		}
+		}}
+
+		initialize(lower,upper,Msize);
+
+		long LDAB = kl + ku + 1;
+		long iMin;
+		long iMax;
+
+		for(long j = 0; j < N; j++)
+		{
+		iMin = std::max((long)0,j-ku);
+		iMax = std::min(N-1,j+kl);
+		std::memcpy(mData.dataPtr + j*LDAB + ku + (iMin - j),M.dataPtr + j*N + iMin,(iMax-iMin+1)*sizeof(T));
+		}
+	}
+
+	//
+	// Returns the band matrix as a dense N x N matrix
+	//
+	LapackMatrixT<T> getDenseMatrix() const
+	{
+		LapackMatrixT<T> M(N,N);
+
+		long LDAB = kl + ku + 1;
+		long iMin;
+		long iMax;
+
+		for(long j = 0; j < N; j++)
+		{
+		iMin = std::max((long)0,j-ku);
+		iMax = std::min(N-1,j+kl);
+		std::memcpy(M.dataPtr + j*N + iMin,mData.dataPtr + j*LDAB + ku + (iMin - j),(iMax-iMin+1)*sizeof(T));
+		}
+		return M;
+	}
+
+	//
+	// Returns true if |A(i,j) - A(j,i)| <= relTol*max|A(i,j)| for all i,j,
+	// entries outside of the band being zero.
+	//
+	bool isSymmetric(T relTol = 0.0) const
+	{
+		T tol = relTol*mData.elementMaxAbs();
+		T aij;
+		T aji;
+
+		for(long j = 0; j < N; j++)
+		{
+		for(long i = std::max((long)0,j-ku); i < j; i++)
+		{
+			aij = this->operator()(i,j);
+			aji = (j - i <= kl) ? this->operator()(j,i) : 0.0;
+			if(std::abs(aij - aji) > tol) return false;
+		}
+		for(long i = j + ku + 1; i <= std::min(N-1,j+kl); i++)
+		{
+			if(std::abs(this->operator()(i,j)) > tol) return false;
+		}
+		}
+		return true;
+	}
 
 //
 // Algebraic operators utilize algebraic operations of underlying LapackMatric
 //
-    inline void operator=(const LapackBandMatrix& B)
+    inline void operator=(const LapackBandMatrixT& B)
 	{
     	if(mData.isNull())
     	{
@@ -172,62 +264,62 @@ class LapackBandMatrix
 	}
 
 
-    inline void operator+=(const  LapackBandMatrix& B)
+    inline void operator+=(const  LapackBandMatrixT& B)
     {
         assert(sizeCheck(B.kl, B.ku, B.N));
     	mData += B.mData;
     }
 
-    LapackBandMatrix operator+(const LapackBandMatrix& B)
+    LapackBandMatrixT operator+(const LapackBandMatrixT& B)
     {
         assert(sizeCheck(B.kl, B.ku, B.N));
-    	LapackBandMatrix     C(*this);
+    	LapackBandMatrixT     C(*this);
     	C.mData += B.mData;
         return C;
     }
 
-    inline void operator-=(const  LapackBandMatrix& B)
+    inline void operator-=(const  LapackBandMatrixT& B)
     {
       assert(sizeCheck(B.kl, B.ku, B.N));
       mData -= B.mData;
     }
 
-    LapackBandMatrix operator-(const LapackBandMatrix& B)
+    LapackBandMatrixT operator-(const LapackBandMatrixT& B)
     {
         assert(sizeCheck(B.kl, B.ku, B.N));
-    	LapackBandMatrix     C(*this);
+    	LapackBandMatrixT     C(*this);
     	C.mData -= B.mData;
         return C;
     }
 
 
-    inline void operator*=(const double alpha)
+    inline void operator*=(const T alpha)
     {
        mData *= alpha;
     }
 
-    LapackBandMatrix operator*(const double alpha)
+    LapackBandMatrixT operator*(const T alpha)
     {
-    LapackBandMatrix R(*this);
+    LapackBandMatrixT R(*this);
     R *= alpha;
     return R;
     }
 
-    friend LapackBandMatrix operator*(const double alpha, const LapackBandMatrix& B)
+    friend LapackBandMatrixT operator*(const T alpha, const LapackBandMatrixT& B)
     {
-    LapackBandMatrix R(B);
+    LapackBandMatrixT R(B);
     R *= alpha;
     return R;
     }
 
-    inline void operator/=(const double alpha)
+    inline void operator/=(const T alpha)
     {
     mData /= alpha;
     }
 
-    LapackBandMatrix operator/(const double alpha)
+    LapackBandMatrixT operator/(const T alpha)
     {
-    LapackBandMatrix R(*this);
+    LapackBandMatrixT R(*this);
     R /= alpha;
     return R;
     }
@@ -238,7 +330,7 @@ class LapackBandMatrix
     return mData.isNull();
     }
 
-    void setToValue(double val)
+    void setToValue(T val)
     {
       mData.setToValue(val);
     }
@@ -246,48 +338,273 @@ class LapackBandMatrix
     void setToIdentity()
     {
     	setToValue(0.0);
-    	for(long k = 0; k < N; k++)
+    	long LDAB = kl + ku + 1;
+    	T* Dptr = mData.dataPtr + ku;
+    	for(long k = 0; k < N; k++) {Dptr[k*LDAB] = 1.0;}
+    }
+
+//
+//###################################################################
+//  Whole band operations
+//###################################################################
+//
+//  These routines operate directly on the band data, mData. The
+//  entries of column j of the matrix that are in the band occupy the
+//  contiguous rows
+//
+//  max(0,ku-j) <= r <= min(kl+ku,ku+N-1-j)
+//
+//  of mData, with r = ku + i - j for A(i,j), so that the bounds are
+//  computed once for each column and the inner loops are unit stride
+//  loops that the compiler vectorizes. Entries of mData outside of
+//  the band (the upper left and lower right corners) are not
+//  referenced.
+//
+
+    void setDiagonal(const std::vector<T>& diag)
+    {
+    	assert(sizeCheck((long)diag.size(),N));
+    	long LDAB = kl + ku + 1;
+    	T* Dptr = mData.dataPtr + ku;
+    	for(long k = 0; k < N; k++) {Dptr[k*LDAB] = diag[k];}
+    }
+
+    void getDiagonal(std::vector<T>& diag) const
+    {
+    	diag.resize(N);
+    	long LDAB = kl + ku + 1;
+    	const T* Dptr = mData.dataPtr + ku;
+    	for(long k = 0; k < N; k++) {diag[k] = Dptr[k*LDAB];}
+    }
+
+    std::vector<T> getDiagonal() const
+    {
+    	std::vector<T> diag;
+    	getDiagonal(diag);
+    	return diag;
+    }
+
+    // A = A + alpha*I
+
+    void addToDiagonal(T alpha)
+    {
+    	long LDAB = kl + ku + 1;
+    	T* Dptr = mData.dataPtr + ku;
+    	for(long k = 0; k < N; k++) {Dptr[k*LDAB] += alpha;}
+    }
+
+    // A = A + diag(d)
+
+    void addToDiagonal(const std::vector<T>& d)
+    {
+    	assert(sizeCheck((long)d.size(),N));
+    	long LDAB = kl + ku + 1;
+    	T* Dptr = mData.dataPtr + ku;
+    	for(long k = 0; k < N; k++) {Dptr[k*LDAB] += d[k];}
+    }
+
+    //
+    // The sum of squares is accumulated in double precision
+    //
+    T normFrobenius() const
+    {
+    	long LDAB = kl + ku + 1;
+    	double valSum = 0.0;
+    	const T* Aj;
+
+    	for(long j = 0; j < N; j++)
     	{
-    	this->operator()(k,k) = 1.0;
-    	}
+    	Aj = mData.dataPtr + j*LDAB;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		valSum += (double)Aj[r]*(double)Aj[r];
+    	}}
+    	return (T)std::sqrt(valSum);
     }
 
-    void setDiagonal(const std::vector<double>& diag)
+    // Maximum absolute column sum
+
+    T norm1() const
     {
-    	for(long k = 0; k < N; k++)
+    	long LDAB = kl + ku + 1;
+    	T colSum;
+    	T normVal = 0.0;
+    	const T* Aj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = mData.dataPtr + j*LDAB;
+    	colSum = 0.0;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
     	{
-    		this->operator()(k,k) = diag[k];
+    		colSum += std::abs(Aj[r]);
     	}
+    	normVal = std::max(normVal,colSum);
+    	}
+    	return normVal;
     }
 
-    double normFrobenius()
+    // Maximum absolute row sum
+
+    T normInf() const
     {
-    	double val    = 0.0;
-    	double valSum = 0.0;
+    	long LDAB = kl + ku + 1;
+    	std::vector<T> rowSum(N,0.0);
+    	T* rSum = rowSum.data();
+    	const T* Aj;
+    	long offset;
+
+    	// Accumulate into rowSum[i] with i = r - ku + j
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = mData.dataPtr + j*LDAB;
+    	offset = j - ku;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		rSum[offset + r] += std::abs(Aj[r]);
+    	}}
+
+    	T normVal = 0.0;
+    	for(long i = 0; i < N; i++) {normVal = std::max(normVal,rowSum[i]);}
+    	return normVal;
+    }
+
+    // Maximum absolute value of the entries
+
+    T normMax() const
+    {
+    	long LDAB = kl + ku + 1;
+    	T normVal = 0.0;
+    	const T* Aj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = mData.dataPtr + j*LDAB;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		normVal = std::max(normVal,std::abs(Aj[r]));
+    	}}
+    	return normVal;
+    }
+
+    // A = diag(rowScale)*A
+
+    void scaleRows(const std::vector<T>& rowScale)
+    {
+    	assert(sizeCheck((long)rowScale.size(),N));
+    	long LDAB = kl + ku + 1;
+    	T* Aj;
+    	const T* sPtr = rowScale.data();
+    	long offset;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = mData.dataPtr + j*LDAB;
+    	offset = j - ku;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		Aj[r] *= sPtr[offset + r];
+    	}}
+    }
+
+    // A = A*diag(colScale)
+
+    void scaleColumns(const std::vector<T>& colScale)
+    {
+    	assert(sizeCheck((long)colScale.size(),N));
+    	long LDAB = kl + ku + 1;
+    	T* Aj;
+    	T  s;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = mData.dataPtr + j*LDAB;
+    	s  = colScale[j];
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		Aj[r] *= s;
+    	}}
+    }
+
+    //
+    // A = A + alpha*B where B is an N x N band matrix whose bandwidths
+    // need not be those of A. If B.kl > kl or B.ku > ku the band of A is
+    // first widened to contain that of B.
+    //
+    void axpy(T alpha, const LapackBandMatrixT& B)
+    {
+    	assert(sizeCheck(B.N,N));
 
-    	for(long i = 0; i < N; i++)
+    	if((B.kl > kl)||(B.ku > ku))
     	{
-    	for(long j = std::max((long)0,i- kl); j <= std::min(i+ku,N-1); j++)
+    	widenBand(std::max(kl,B.kl),std::max(ku,B.ku));
+    	}
+
+    	long LDAB  = kl + ku + 1;
+    	long LDBB  = B.kl + B.ku + 1;
+    	long shift = ku - B.ku;
+
+    	T*       Aj;
+    	const T* Bj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = mData.dataPtr   + j*LDAB + shift;
+    	Bj = B.mData.dataPtr + j*LDBB;
+    	for(long r = std::max((long)0,B.ku-j); r <= std::min(B.kl+B.ku,B.ku+N-1-j); r++)
     	{
-    		val = this->operator()(i,j);
-    		valSum += val*val;
+    		Aj[r] += alpha*Bj[r];
     	}}
-    	return std::sqrt(valSum);
+    }
+
+    //
+    // Increases the bandwidths of the matrix to klNew >= kl and kuNew >= ku,
+    // retaining the matrix entries.
+    //
+    void widenBand(long klNew, long kuNew)
+    {
+    	if((klNew == kl)&&(kuNew == ku)) return;
+
+    	assert(klNew >= kl);
+    	assert(kuNew >= ku);
+
+    	LapackMatrixT<T> mDataNew(klNew + kuNew + 1, N);
+
+    	long LDAB    = kl + ku + 1;
+    	long LDABnew = klNew + kuNew + 1;
+    	long shift   = kuNew - ku;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	std::memcpy(mDataNew.dataPtr + j*LDABnew + shift, mData.dataPtr + j*LDAB, LDAB*sizeof(T));
+    	}
+
+    	kl = klNew;
+    	ku = kuNew;
+    	mData.initialize(mDataNew);
     }
 
     //
     // The only band matrix X matrix operation allowed
-    // is a band matrix times a matrix with a single
-    // column
+    // is a band matrix times a matrix with N rows. Matrices
+    // with more than one column are multiplied using gbmm(...)
     //
-    LapackMatrix operator*(const LapackMatrix& x)
+    LapackMatrixT<T> operator*(const LapackMatrixT<T>& x)
+    {
+    assert(sizeCheck(x.rows,N));
+    if(x.cols != 1)
     {
-    assert(sizecheckNx1(x.rows,x.cols));
-	LapackMatrix y(x.rows,1);
+    LapackMatrixT<T> y(N,x.cols);
+    gbmm('N',1.0,x,0.0,y);
+    return y;
+    }
+
+	LapackMatrixT<T> y(x.rows,1);
 
     char TRANS     = 'N';
-    double ALPHA   = 1.0;
-    double BETA    = 0.0;
+    T ALPHA   = 1.0;
+    T BETA    = 0.0;
     long INCX      = 1;
     long INCY      = 1;
 
@@ -301,18 +618,18 @@ class LapackBandMatrix
     m by n band matrix, with kl sub-diagonals and ku super-diagonals.
    */
 
-    dgbmv_(&TRANS,&N,&N, &kl, &ku,&ALPHA, mData.dataPtr,&mData.rows, x.dataPtr,&INCX,&BETA,y.dataPtr,&INCY);
+    LapackTraits<T>::gbmv(&TRANS,&N,&N, &kl, &ku,&ALPHA, mData.dataPtr,&mData.rows, x.dataPtr,&INCX,&BETA,y.dataPtr,&INCY);
 	return y;
     }
 
 
-    std::vector<double> operator*(const std::vector<double>& x)
+    std::vector<T> operator*(const std::vector<T>& x)
     {
-	std::vector<double> y(N,0.0);
+	std::vector<T> y(N,0.0);
 
     char TRANS     = 'N';
-    double ALPHA   = 1.0;
-    double BETA    = 0.0;
+    T ALPHA   = 1.0;
+    T BETA    = 0.0;
     long INCX      = 1;
     long INCY      = 1;
 
@@ -325,16 +642,138 @@ class LapackBandMatrix
     m by n band matrix, with kl sub-diagonals and ku super-diagonals.
    */
 
-    dgbmv_(&TRANS,&N,&N, &kl, &ku,&ALPHA, mData.dataPtr,&mData.rows,const_cast<double*>(&x[0]),&INCX,&BETA,&y[0],&INCY);
+    LapackTraits<T>::gbmv(&TRANS,&N,&N, &kl, &ku,&ALPHA, mData.dataPtr,&mData.rows,const_cast<T*>(&x[0]),&INCX,&BETA,&y[0],&INCY);
 	return y;
     }
 
 
+//
+//###################################################################
+//  "low level" routines with direct operation on the band data
+//###################################################################
+//
+//  Y := alpha*A*X    + beta*Y  (trans = 'N')
+//  Y := alpha*A**T*X + beta*Y  (trans = 'T')
+//
+//  where X and Y are N x m matrices.
+//
+//  The band data is processed in panels of consecutive band columns,
+//  each small enough to remain in cache while it is applied to all m
+//  columns of X, so the band is streamed from memory once, rather
+//  than once per column as with m invocations of dgbmv.
+//
+//  If beta = 0 then Y need not be initialized.
+//
+void gbmm(char trans, T alpha, const LapackMatrixT<T>& X, T beta, LapackMatrixT<T>& Y) const
+{
+    assert(sizeCheck(X.rows,N));
+    assert(sizeCheck(Y.rows,N));
+    assert(sizeCheck(X.cols,Y.cols));
+
+    long   m      = X.cols;
+    long   LDAB   = kl + ku + 1;
+    T* ABptr = mData.dataPtr;
+    T* Xptr  = X.dataPtr;
+    T* Yptr  = Y.dataPtr;
+
+    if(beta == 0.0)
+    {
+    for(long k = 0; k < N*m; k++) {Yptr[k] = 0.0;}
+    }
+    else if(beta != 1.0)
+    {
+    for(long k = 0; k < N*m; k++) {Yptr[k] *= beta;}
+    }
+
+    if((alpha == 0.0)||(N == 0)) return;
+
+    // Panel width chosen so that a panel of band data occupies
+    // approximately 128 KB
+
+    long panelWidth = 16384/LDAB;
+    if(panelWidth < 1) panelWidth = 1;
+
+    long   iMin; long iMax;
+    T  sum; T aX;
+    T* ABj;
+    T* Xc;
+    T* Yc;
+
+    for(long jStart = 0; jStart < N; jStart += panelWidth)
+    {
+    long jEnd = std::min(jStart + panelWidth, N);
+
+    if((trans == 'N')||(trans == 'n'))
+    {
+        for(long c = 0; c < m; c++)
+        {
+        Xc = Xptr + c*N;
+        Yc = Yptr + c*N;
+        for(long j = jStart; j < jEnd; j++)
+        {
+            aX   = alpha*Xc[j];
+            if(aX == 0.0) continue;
+            iMin = std::max((long)0,j-ku);
+            iMax = std::min(N-1,j+kl);
+            ABj  = ABptr + j*LDAB + (ku - j);   // ABj[i] = A(i,j)
+            for(long i = iMin; i <= iMax; i++)
+            {
+                Yc[i] += aX*ABj[i];
+            }
+        }}
+    }
+    else
+    {
+        for(long c = 0; c < m; c++)
+        {
+        Xc = Xptr + c*N;
+        Yc = Yptr + c*N;
+        for(long j = jStart; j < jEnd; j++)
+        {
+            iMin = std::max((long)0,j-ku);
+            iMax = std::min(N-1,j+kl);
+            ABj  = ABptr + j*LDAB + (ku - j);
+            sum  = 0.0;
+            for(long i = iMin; i <= iMax; i++)
+            {
+                sum += ABj[i]*Xc[i];
+            }
+            Yc[j] += alpha*sum;
+        }}
+    }
+
+    }
+}
+
+//
+// Retained for code written for the double precision class
+//
+void dgbmm(char trans, T alpha, const LapackMatrixT<T>& X, T beta, LapackMatrixT<T>& Y) const
+{
+    gbmm(trans,alpha,X,beta,Y);
+}
+
+//
+// Y = alpha*A*X + beta*Y
+//
+void apply(const LapackMatrixT<T>& X, LapackMatrixT<T>& Y, T alpha = 1.0, T beta = 0.0) const
+{
+    gbmm('N',alpha,X,beta,Y);
+}
+
+//
+// Y = alpha*A**T*X + beta*Y
+//
+void applyTranspose(const LapackMatrixT<T>& X, LapackMatrixT<T>& Y, T alpha = 1.0, T beta = 0.0) const
+{
+    gbmm('T',alpha,X,beta,Y);
+}
+
 /*!  Outputs the band matrix as a dense matrix with the (0,0) element in the upper left corner */
 
 void printDense(std::ostream& outStream, int precision = 3)
 {
-	    double val;
+	    T val;
         std::ios_base::fmtflags ff = outStream.flags();
         int precisionCache = outStream.precision(precision);
 
@@ -360,9 +799,9 @@ void printDense(std::ostream& outStream, int precision = 3)
 // ToDo: Decide on proper output format to support both << and >> stream operators
 //       and then implements.
 //
-friend std::ostream& operator<<(std::ostream& outStream, const LapackBandMatrix&  V)
+friend std::ostream& operator<<(std::ostream& outStream, const LapackBandMatrixT&  V)
 {
-        long i; long j; double val;
+        long i; long j; T val;
 
         for(i = 0;  i < V.N; i++)
         {
@@ -461,13 +900,15 @@ friend std::ostream& operator<<(std::ostream& outStream, const LapackBandMatrix&
 
 
 
-    SCC::LapackMatrix mData;
+    LapackMatrixT<T> mData;
 
 	long ku;
 	long kl;
 	long  N;
 };
 
+typedef LapackBandMatrixT<double> LapackBandMatrix;
+
 } // Namespace SCC
 
 //
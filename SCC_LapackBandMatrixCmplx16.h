@@ -3,6 +3,8 @@
  *
  *  Created on: Dec. 3,2023
  *      Author: anderson
+ *
+ *  Updated: Oct. 18, 2026 (C.R. Anderson)
  */
 //
 // Instances of this class are N x N banded matrices with complex entries
@@ -25,6 +27,11 @@
 // storage convention so that LAPACK band matrix routines can be
 // invoked directly without having to transform the matrix data.
 //
+// The class is the partial specialization LapackBandMatrixT<std::complex<RT>>
+// of the band matrix class template of SCC_LapackBandMatrix.h, with
+// the storage a LapackMatrixT<std::complex<RT>> instance.
+// LapackBandMatrixCmplx16 is LapackBandMatrixT<std::complex<double>>.
+//
 // Typical use case consists of initializing an instance
 // then setting values of the banded matrix using the
 // standard access operator.
@@ -64,28 +71,37 @@
 #endif
 #endif
 
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <complex>
+#include <algorithm>
+
 #include "LapackInterface/SCC_LapackMatrixCmplx16.h"
+#include "LapackInterface/SCC_LapackBandMatrix.h"
+#include "LapackInterface/SCC_LapackTraits.h"
 
 #ifndef SCC_LAPACK_BAND_MATRIX_CMPLX_16
 #define SCC_LAPACK_BAND_MATRIX_CMPLX_16
 
 namespace SCC
 {
-class LapackBandMatrixCmplx16
+template <class RT>
+class LapackBandMatrixT< std::complex<RT> >
 {
 	public:
 
-	LapackBandMatrixCmplx16()
+	LapackBandMatrixT()
 	{
 	initialize();
 	}
 
-    LapackBandMatrixCmplx16(const LapackBandMatrixCmplx16& S)
+    LapackBandMatrixT(const LapackBandMatrixT& S)
 	{
     	initialize(S);
 	}
 
-	LapackBandMatrixCmplx16(long kl, long ku, long N)
+	LapackBandMatrixT(long kl, long ku, long N)
 	{
 	    initialize(kl,ku,N);
 	}
@@ -98,7 +114,7 @@ class LapackBandMatrixCmplx16
     	N  = 0;
 	}
 
-	void initialize(const LapackBandMatrixCmplx16& S)
+	void initialize(const LapackBandMatrixT& S)
 	{
 		kl = S.kl;
 		ku = S.ku;
@@ -116,13 +132,13 @@ class LapackBandMatrixCmplx16
 
 
 	#ifdef _DEBUG
-	 std::complex<double>& operator()(long i, long j)
+	 std::complex<RT>& operator()(long i, long j)
 	{
 		assert(boundsCheck(i,j));
 		return cmplxMdata(ku +  (i-j),j);
 	}
 
-    const  std::complex<double>& operator()(long i, long j) const
+    const  std::complex<RT>& operator()(long i, long j) const
 	{
     	assert(boundsCheck(i,j));
 		return cmplxMdata(ku +  (i-j),j);
@@ -130,25 +146,25 @@ class LapackBandMatrixCmplx16
 
 
 	#else
-	inline std::complex<double>& operator()(long i, long j)
+	inline std::complex<RT>& operator()(long i, long j)
 	{
 		return cmplxMdata(ku +  (i-j),j);
 	}
 
-    inline const std::complex<double>& operator()(long i, long j) const
+    inline const std::complex<RT>& operator()(long i, long j) const
 	{
 		return cmplxMdata(ku +  (i-j),j);
 	}
 	#endif
 
-	double* getDataPointer() const {return cmplxMdata.mData.dataPtr;}
+	RT* getDataPointer() const {return cmplxMdata.mData.dataPtr;}
 
-    void setToValue(double val)
+    void setToValue(RT val)
 	{
 		cmplxMdata.setToValue(val);
 	}
 
-	void setToValue(const std::complex<double>& val)
+	void setToValue(const std::complex<RT>& val)
 	{
 	cmplxMdata.setToValue(val);
 	}
@@ -159,25 +175,310 @@ class LapackBandMatrixCmplx16
 	}
 
 
-    double normFrobenius()
+//
+//###################################################################
+//  Whole band operations
+//###################################################################
+//
+//  These routines operate directly on the interleaved real/imaginary
+//  band data, cmplxMdata.mData. The entries of column j of the matrix
+//  that are in the band occupy the contiguous rows
+//
+//  max(0,ku-j) <= r <= min(kl+ku,ku+N-1-j)
+//
+//  of the band storage, with r = ku + i - j for A(i,j), i.e. doubles
+//  2*r and 2*r+1 of the column data. The bounds are computed once for
+//  each column and the inner loops are unit stride loops over doubles
+//  that the compiler vectorizes; complex products are expanded into
+//  real arithmetic rather than evaluated with std::complex operators.
+//  Entries outside of the band are not referenced.
+//
+
+    void setToIdentity()
     {
-    	double valSum = 0.0;
+    	setToValue(0.0);
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Dptr = cmplxMdata.mData.dataPtr + 2*ku;
+    	for(long k = 0; k < N; k++) {Dptr[k*LDAB2] = 1.0;}
+    }
 
-    	for(long i = 0; i < N; i++)
+    void setDiagonal(const std::vector< std::complex<RT> >& diag)
+    {
+    	assert(sizeCheck((long)diag.size(),N));
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Dptr = cmplxMdata.mData.dataPtr + 2*ku;
+    	for(long k = 0; k < N; k++)
     	{
-    	for(long j = std::max((long)0,i- kl); j <= std::min(i+ku,N-1); j++)
+    	Dptr[k*LDAB2]     = diag[k].real();
+    	Dptr[k*LDAB2 + 1] = diag[k].imag();
+    	}
+    }
+
+    void getDiagonal(std::vector< std::complex<RT> >& diag) const
+    {
+    	diag.resize(N);
+    	long LDAB2 = 2*(kl + ku + 1);
+    	const RT* Dptr = cmplxMdata.mData.dataPtr + 2*ku;
+    	for(long k = 0; k < N; k++)
     	{
-    	    valSum += std::norm(this->operator()(i,j));
+    	diag[k] = std::complex<RT>(Dptr[k*LDAB2],Dptr[k*LDAB2 + 1]);
+    	}
+    }
+
+    std::vector< std::complex<RT> > getDiagonal() const
+    {
+    	std::vector< std::complex<RT> > diag;
+    	getDiagonal(diag);
+    	return diag;
+    }
+
+    // A = A + alpha*I
+
+    void addToDiagonal(const std::complex<RT>& alpha)
+    {
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Dptr = cmplxMdata.mData.dataPtr + 2*ku;
+    	for(long k = 0; k < N; k++)
+    	{
+    	Dptr[k*LDAB2]     += alpha.real();
+    	Dptr[k*LDAB2 + 1] += alpha.imag();
+    	}
+    }
+
+    RT normFrobenius() const
+    {
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT valSum = 0.0;
+    	const RT* Aj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	for(long p = 2*std::max((long)0,ku-j); p < 2*(std::min(kl+ku,ku+N-1-j)+1); p++)
+    	{
+    		valSum += Aj[p]*Aj[p];
     	}}
     	return std::sqrt(valSum);
     }
 
+    // Maximum absolute column sum
+
+    RT norm1() const
+    {
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT colSum;
+    	RT normVal = 0.0;
+    	const RT* Aj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	colSum = 0.0;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		colSum += std::sqrt(Aj[2*r]*Aj[2*r] + Aj[2*r+1]*Aj[2*r+1]);
+    	}
+    	normVal = std::max(normVal,colSum);
+    	}
+    	return normVal;
+    }
+
+    // Maximum absolute row sum
+
+    RT normInf() const
+    {
+    	long LDAB2 = 2*(kl + ku + 1);
+    	std::vector<RT> rowSum(N,0.0);
+    	RT* rSum = rowSum.data();
+    	const RT* Aj;
+    	long offset;
+
+    	// Accumulate into rowSum[i] with i = r - ku + j
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	offset = j - ku;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		rSum[offset + r] += std::sqrt(Aj[2*r]*Aj[2*r] + Aj[2*r+1]*Aj[2*r+1]);
+    	}}
+
+    	RT normVal = 0.0;
+    	for(long i = 0; i < N; i++) {normVal = std::max(normVal,rowSum[i]);}
+    	return normVal;
+    }
+
+    // Maximum absolute value of the entries
+
+    RT normMax() const
+    {
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT maxSq = 0.0;
+    	const RT* Aj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		maxSq = std::max(maxSq,Aj[2*r]*Aj[2*r] + Aj[2*r+1]*Aj[2*r+1]);
+    	}}
+    	return std::sqrt(maxSq);
+    }
+
+    // A = diag(rowScale)*A
+
+    void scaleRows(const std::vector<RT>& rowScale)
+    {
+    	assert(sizeCheck((long)rowScale.size(),N));
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Aj;
+    	const RT* sPtr = rowScale.data();
+    	long offset;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	offset = j - ku;
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		Aj[2*r]     *= sPtr[offset + r];
+    		Aj[2*r + 1] *= sPtr[offset + r];
+    	}}
+    }
+
+    void scaleRows(const std::vector< std::complex<RT> >& rowScale)
+    {
+    	assert(sizeCheck((long)rowScale.size(),N));
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Aj;
+    	const RT* sPtr = reinterpret_cast<const RT*>(rowScale.data());
+    	RT sr; RT si; RT ar; RT ai;
+    	long offset;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj     = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	offset = 2*(j - ku);
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		sr = sPtr[offset + 2*r]; si = sPtr[offset + 2*r + 1];
+    		ar = Aj[2*r];            ai = Aj[2*r + 1];
+    		Aj[2*r]     = sr*ar - si*ai;
+    		Aj[2*r + 1] = sr*ai + si*ar;
+    	}}
+    }
+
+    // A = A*diag(colScale)
+
+    void scaleColumns(const std::vector<RT>& colScale)
+    {
+    	assert(sizeCheck((long)colScale.size(),N));
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Aj;
+    	RT  s;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	s  = colScale[j];
+    	for(long p = 2*std::max((long)0,ku-j); p < 2*(std::min(kl+ku,ku+N-1-j)+1); p++)
+    	{
+    		Aj[p] *= s;
+    	}}
+    }
+
+    void scaleColumns(const std::vector< std::complex<RT> >& colScale)
+    {
+    	assert(sizeCheck((long)colScale.size(),N));
+    	long LDAB2 = 2*(kl + ku + 1);
+    	RT* Aj;
+    	RT sr; RT si; RT ar; RT ai;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = cmplxMdata.mData.dataPtr + j*LDAB2;
+    	sr = colScale[j].real();
+    	si = colScale[j].imag();
+    	for(long r = std::max((long)0,ku-j); r <= std::min(kl+ku,ku+N-1-j); r++)
+    	{
+    		ar = Aj[2*r]; ai = Aj[2*r + 1];
+    		Aj[2*r]     = sr*ar - si*ai;
+    		Aj[2*r + 1] = sr*ai + si*ar;
+    	}}
+    }
+
+    //
+    // A = A + alpha*B where B is an N x N band matrix whose bandwidths
+    // need not be those of A. If B.kl > kl or B.ku > ku the band of A is
+    // first widened to contain that of B.
+    //
+    void axpy(const std::complex<RT>& alpha, const LapackBandMatrixT& B)
+    {
+    	assert(sizeCheck(B.N,N));
+
+    	if((B.kl > kl)||(B.ku > ku))
+    	{
+    	widenBand(std::max(kl,B.kl),std::max(ku,B.ku));
+    	}
+
+    	long LDAB2 = 2*(kl + ku + 1);
+    	long LDBB2 = 2*(B.kl + B.ku + 1);
+    	long shift = 2*(ku - B.ku);
+
+    	RT ar = alpha.real();
+    	RT ai = alpha.imag();
+    	RT br; RT bi;
+
+    	RT*       Aj;
+    	const RT* Bj;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Aj = cmplxMdata.mData.dataPtr   + j*LDAB2 + shift;
+    	Bj = B.cmplxMdata.mData.dataPtr + j*LDBB2;
+    	for(long r = std::max((long)0,B.ku-j); r <= std::min(B.kl+B.ku,B.ku+N-1-j); r++)
+    	{
+    		br = Bj[2*r]; bi = Bj[2*r + 1];
+    		Aj[2*r]     += ar*br - ai*bi;
+    		Aj[2*r + 1] += ar*bi + ai*br;
+    	}}
+    }
+
+    //
+    // Increases the bandwidths of the matrix to klNew >= kl and kuNew >= ku,
+    // retaining the matrix entries.
+    //
+    void widenBand(long klNew, long kuNew)
+    {
+    	if((klNew == kl)&&(kuNew == ku)) return;
+
+    	assert(klNew >= kl);
+    	assert(kuNew >= ku);
+
+    	LapackMatrixT< std::complex<RT> > cmplxMdataNew(klNew + kuNew + 1, N);
+
+    	long LDAB2    = 2*(kl + ku + 1);
+    	long LDABnew2 = 2*(klNew + kuNew + 1);
+    	long shift    = 2*(kuNew - ku);
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	std::memcpy(cmplxMdataNew.mData.dataPtr + j*LDABnew2 + shift,
+    	cmplxMdata.mData.dataPtr + j*LDAB2, LDAB2*sizeof(RT));
+    	}
+
+    	kl = klNew;
+    	ku = kuNew;
+    	cmplxMdata.initialize(cmplxMdataNew);
+    }
 
 /*!  Outputs the band matrix as a dense matrix with the (0,0) element in the upper left corner */
 
 void printDense(std::ostream& outStream, int precision = 3)
 {
-	    std::complex<double> val;
+	    std::complex<RT> val;
 	    std::ios_base::fmtflags ff = outStream.flags();
 	    int precisionCache = outStream.precision(precision);
 
@@ -203,9 +504,9 @@ void printDense(std::ostream& outStream, int precision = 3)
 //       and then implements.
 //
 /*
-	friend std::ostream& operator<<(std::ostream& outStream, const LapackBandMatrixCmplx16&  V)
+	friend std::ostream& operator<<(std::ostream& outStream, const LapackBandMatrixT&  V)
 	{
-        long i; long j; std::complex<double> val;
+        long i; long j; std::complex<RT> val;
 
         for(i = 0;  i < V.N; i++)
         {
@@ -226,7 +527,7 @@ void printDense(std::ostream& outStream, int precision = 3)
 
 	//  Algebraic operators
 
-    inline void operator=(const LapackBandMatrixCmplx16& B)
+    inline void operator=(const LapackBandMatrixT& B)
 	{
     	if(cmplxMdata.isNull())
     	{
@@ -241,100 +542,100 @@ void printDense(std::ostream& outStream, int precision = 3)
 
 	}
 
-    inline void operator+=(const  LapackBandMatrixCmplx16& B)
+    inline void operator+=(const  LapackBandMatrixT& B)
     {
     	assert(sizeCheck(B.kl, B.ku, B.N));
     	cmplxMdata += B.cmplxMdata;
     }
 
-    LapackBandMatrixCmplx16 operator+(const LapackBandMatrixCmplx16& B)
+    LapackBandMatrixT operator+(const LapackBandMatrixT& B)
     {
     	assert(sizeCheck(B.kl, B.ku, B.N));
 
-    	LapackBandMatrixCmplx16  C(*this);
+    	LapackBandMatrixT  C(*this);
 
     	C.cmplxMdata += B.cmplxMdata;
 
         return C;
     }
 
-    LapackBandMatrixCmplx16 operator-(const LapackBandMatrixCmplx16& B)
+    LapackBandMatrixT operator-(const LapackBandMatrixT& B)
     {
     	assert(sizeCheck(B.kl, B.ku, B.N));
 
-    	LapackBandMatrixCmplx16  C(*this);
+    	LapackBandMatrixT  C(*this);
 
     	C.cmplxMdata -= B.cmplxMdata;
     	return C;
     }
 
-    inline void operator-=(const  LapackBandMatrixCmplx16& D)
+    inline void operator-=(const  LapackBandMatrixT& D)
     {
     	assert(sizeCheck(D.kl, D.ku, D.N));
         cmplxMdata -= D.cmplxMdata;
     }
 
-    inline void operator*=(const double alpha)
+    inline void operator*=(const RT alpha)
     {
     	cmplxMdata *= alpha;
     }
 
-    inline void operator*=(const std::complex<double> alpha)
+    inline void operator*=(const std::complex<RT> alpha)
     {
     	cmplxMdata *= alpha;
     }
 
-    LapackBandMatrixCmplx16 operator*(const double alpha)
+    LapackBandMatrixT operator*(const RT alpha)
     {
-    LapackBandMatrixCmplx16 R(*this);
+    LapackBandMatrixT R(*this);
     R *= alpha;
     return R;
     }
 
-    LapackBandMatrixCmplx16 operator*(const std::complex<double> alpha)
+    LapackBandMatrixT operator*(const std::complex<RT> alpha)
     {
-    LapackBandMatrixCmplx16 R(*this);
+    LapackBandMatrixT R(*this);
     R *= alpha;
     return R;
     }
 
 
-    friend LapackBandMatrixCmplx16 operator*(const double alpha, const LapackBandMatrixCmplx16& B)
+    friend LapackBandMatrixT operator*(const RT alpha, const LapackBandMatrixT& B)
     {
-    LapackBandMatrixCmplx16 R(B);
+    LapackBandMatrixT R(B);
     R *= alpha;
     return R;
     }
 
-    friend LapackBandMatrixCmplx16 operator*(const std::complex<double> alpha, const LapackBandMatrixCmplx16& B)
+    friend LapackBandMatrixT operator*(const std::complex<RT> alpha, const LapackBandMatrixT& B)
     {
-    LapackBandMatrixCmplx16 R(B);
+    LapackBandMatrixT R(B);
     R *= alpha;
     return R;
     }
 
 
-    inline void operator/=(const double alpha)
+    inline void operator/=(const RT alpha)
     {
     	  cmplxMdata /= alpha;
     }
 
-    inline void operator/=(const std::complex<double> alpha)
+    inline void operator/=(const std::complex<RT> alpha)
     {
            cmplxMdata /= alpha;
     }
 
 
-    LapackBandMatrixCmplx16 operator/(const double alpha)
+    LapackBandMatrixT operator/(const RT alpha)
     {
-    LapackBandMatrixCmplx16 R(*this);
+    LapackBandMatrixT R(*this);
     R /= alpha;
     return R;
     }
 
-    LapackBandMatrixCmplx16 operator/(const std::complex<double> alpha)
+    LapackBandMatrixT operator/(const std::complex<RT> alpha)
     {
-    LapackBandMatrixCmplx16 R(*this);
+    LapackBandMatrixT R(*this);
     R /= alpha;
     return R;
     }
@@ -351,40 +652,40 @@ void printDense(std::ostream& outStream, int precision = 3)
     // allowed is a band matrix times a matrix with a
     // single column
     //
-    LapackMatrixCmplx16 operator*(const LapackMatrixCmplx16& x)
+    LapackMatrixT< std::complex<RT> > operator*(const LapackMatrixT< std::complex<RT> >& x)
     {
     assert(sizecheckNx1(x.rows,x.cols));
 
-	LapackMatrixCmplx16 y(x.rows,1);
+	LapackMatrixT< std::complex<RT> > y(x.rows,1);
 
     char TRANS     = 'N';
-    std::complex<double> ALPHA   = {1.0,0.0};
-    std::complex<double> BETA    = {0.0,0.0};
+    std::complex<RT> ALPHA   = {1.0,0.0};
+    std::complex<RT> BETA    = {0.0,0.0};
     long INCX      = 1;
     long INCY      = 1;
     long LDA       = kl + ku + 1;
 
-    zgbmv_(&TRANS,&N,&N, &kl, &ku,reinterpret_cast<double*>(const_cast< std::complex<double>* >(&ALPHA)),
-    this->cmplxMdata.mData.dataPtr, &LDA, x.mData.dataPtr,&INCX,reinterpret_cast<double*>(const_cast< std::complex<double>* >(&BETA)),y.mData.dataPtr,&INCY);
+    LapackTraits< std::complex<RT> >::gbmv(&TRANS,&N,&N, &kl, &ku,reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&ALPHA)),
+    this->cmplxMdata.mData.dataPtr, &LDA, x.mData.dataPtr,&INCX,reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&BETA)),y.mData.dataPtr,&INCY);
 	return y;
 }
 
-std::vector< std::complex<double> > operator*(const std::vector< std::complex<double> >& x)
+std::vector< std::complex<RT> > operator*(const std::vector< std::complex<RT> >& x)
 {
-	std::vector< std::complex<double> > y(N,0.0);
+	std::vector< std::complex<RT> > y(N,0.0);
 
     char TRANS     = 'N';
-    std::complex<double> ALPHA   = {1.0,0.0};
-    std::complex<double> BETA    = {0.0,0.0};
+    std::complex<RT> ALPHA   = {1.0,0.0};
+    std::complex<RT> BETA    = {0.0,0.0};
     long INCX      = 1;
     long INCY      = 1;
     long LDA       = kl + ku + 1;
 
-    zgbmv_(&TRANS,&N,&N, &kl, &ku,
-    reinterpret_cast<double*>(const_cast< std::complex<double>* >(&ALPHA)),this->cmplxMdata.mData.dataPtr, &LDA,
-    reinterpret_cast<double*>(const_cast< std::complex<double>* >(&x[0])),&INCX,
-    reinterpret_cast<double*>(const_cast< std::complex<double>* >(&BETA)),
-    reinterpret_cast<double*>(const_cast< std::complex<double>* >(&y[0])),&INCY);
+    LapackTraits< std::complex<RT> >::gbmv(&TRANS,&N,&N, &kl, &ku,
+    reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&ALPHA)),this->cmplxMdata.mData.dataPtr, &LDA,
+    reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&x[0])),&INCX,
+    reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&BETA)),
+    reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&y[0])),&INCY);
 	return y;
 }
 
@@ -468,13 +769,15 @@ std::vector< std::complex<double> > operator*(const std::vector< std::complex<do
     bool sizeCheck(long, long) const{return true;}
 #endif
 
-    SCC::LapackMatrixCmplx16 cmplxMdata;
+    LapackMatrixT< std::complex<RT> > cmplxMdata;
 
 	long ku;
 	long kl;
 	long  N;
 };
 
+typedef LapackBandMatrixT< std::complex<double> > LapackBandMatrixCmplx16;
+
 } // Namespace SCC
 
 //
@@ -0,0 +1,48 @@
+/*
+ * SCC_LapackBandMatrixCmplx8.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Instances of this class are N x N banded matrices with COMPLEX (COMPLEX*8)
+// entries. The class has the same interface as SCC::LapackBandMatrixCmplx16
+// with float replacing double.
+//
+// LapackBandMatrixCmplx8 is the instance LapackBandMatrixT<std::complex<float>>
+// of the complex band matrix class template defined in SCC_LapackBandMatrixCmplx16.h.
+//
+// Lapack routine dependencies : cgbmv_
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include "LapackInterface/SCC_LapackMatrixCmplx8.h"
+#include "LapackInterface/SCC_LapackBandMatrixCmplx16.h"
+
+#ifndef SCC_LAPACK_BAND_MATRIX_CMPLX_8_
+#define SCC_LAPACK_BAND_MATRIX_CMPLX_8_
+
+namespace SCC
+{
+typedef LapackBandMatrixT< std::complex<float> > LapackBandMatrixCmplx8;
+} // Namespace SCC
+
+#endif
@@ -0,0 +1,381 @@
+/*
+ * SCC_LapackBandMatrixDIA.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Instances of this class are N x N banded matrices with double entries
+// stored in diagonal-major (DIA) form. The matrices are specified with
+// the same three parameters as LapackBandMatrix:
+//
+// kl = lower bandwidth
+// ku = upper bandwidth
+//  N = system size
+//
+// Each of the kl+ku+1 diagonals is stored contiguously and indexed by
+// row, i.e. diagonal d (-kl <= d <= ku) is column (kl + d) of the
+// N x (kl+ku+1) matrix dData with
+//
+// dData(i, kl + d) = A(i, i+d)
+//
+// Entries of dData with i+d outside of [0,N-1] are not referenced and
+// are kept at zero.
+//
+// In this form the matrix-vector product is a sum of kl+ku+1 products of
+// contiguous vectors, y[i] = sum_d dData(i,kl+d)*x[i+d], which vectorizes
+// efficiently even for very narrow bands, where the dgbmv traversal
+// of the LAPACK band storage does not. The product kernel uses AVX-512 or
+// AVX2 instructions when compiled with support for them (e.g. -mavx2 -mfma
+// or -march=native), and a portable loop otherwise.
+//
+// The LAPACK band storage form, required for factorizations, is obtained
+// with getBandMatrix(...), a single pass over the matrix data. DGBSVX
+// accepts instances of this class directly, creating the LAPACK band
+// storage in its factorization array.
+//
+// The indexing for the access operator()(i,j) starts at 0, consistent
+// with the indexing of the other LapackInterface matrix classes.
+//
+// Bounds checking is only done if _DEBUG is defined
+//
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include <vector>
+#include <algorithm>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "SCC_LapackMatrix.h"
+#include "SCC_LapackBandMatrix.h"
+
+#ifndef SCC_LAPACK_BAND_MATRIX_DIA_
+#define SCC_LAPACK_BAND_MATRIX_DIA_
+
+namespace SCC
+{
+class LapackBandMatrixDIA
+{
+	public:
+
+	LapackBandMatrixDIA()
+	{
+	initialize();
+	}
+
+	LapackBandMatrixDIA(const LapackBandMatrixDIA& S)
+	{
+	initialize(S);
+	}
+
+	LapackBandMatrixDIA(long kl, long ku, long N)
+	{
+	initialize(kl,ku,N);
+	}
+
+	LapackBandMatrixDIA(const LapackBandMatrix& A)
+	{
+	initialize(A);
+	}
+
+	void initialize()
+	{
+		dData.initialize();
+		kl = 0;
+		ku = 0;
+		N  = 0;
+	}
+
+	void initialize(const LapackBandMatrixDIA& S)
+	{
+		kl = S.kl;
+		ku = S.ku;
+		N  = S.N;
+		dData.initialize(S.dData);
+	}
+
+	void initialize(long kl, long ku, long N)
+	{
+		this->kl = kl;
+		this->ku = ku;
+		this->N  = N;
+		dData.initialize(N, kl + ku + 1);
+	}
+
+	//
+	// Initializes with the entries of a matrix in LAPACK band storage
+	//
+	void initialize(const LapackBandMatrix& A)
+	{
+		initialize(A.kl,A.ku,A.N);
+
+		long    LDAB  = kl + ku + 1;
+		double* ABptr = A.mData.dataPtr;
+		double* Dd;
+
+		// A(i,i+d) = AB(ku - d, i + d)
+
+		for(long d = -kl; d <= ku; d++)
+		{
+		Dd = dData.dataPtr + (kl + d)*N;
+		for(long i = std::max((long)0,-d); i < std::min(N,N-d); i++)
+		{
+			Dd[i] = ABptr[(ku - d) + (i + d)*LDAB];
+		}
+		}
+	}
+
+	#ifdef _DEBUG
+	double& operator()(long i, long j)
+	{
+		assert(boundsCheck(i,j));
+		return dData(i,kl + (j-i));
+	}
+
+    const double& operator()(long i, long j) const
+	{
+    	assert(boundsCheck(i,j));
+		return dData(i,kl + (j-i));
+	}
+	#else
+	inline double& operator()(long i, long j)
+	{
+		return dData(i,kl + (j-i));
+	}
+
+    inline const double& operator()(long i, long j) const
+	{
+		return dData(i,kl + (j-i));
+	}
+	#endif
+
+	double* getDataPointer() const {return dData.dataPtr;}
+
+	// Pointer to the contiguous data of diagonal d, -kl <= d <= ku,
+	// with getDiagonalPointer(d)[i] = A(i,i+d)
+
+	double* getDiagonalPointer(long d) const {return dData.dataPtr + (kl + d)*N;}
+
+    void setToValue(double val)
+    {
+    	for(long d = -kl; d <= ku; d++)
+    	{
+    	double* Dd = getDiagonalPointer(d);
+    	for(long i = std::max((long)0,-d); i < std::min(N,N-d); i++) {Dd[i] = val;}
+    	}
+    }
+
+	//
+	// Creates the matrix in LAPACK band storage in A, re-using the
+	// allocation of A when possible.
+	//
+	void getBandMatrix(LapackBandMatrix& A) const
+	{
+		if((A.kl != kl)||(A.ku != ku)||(A.N != N)||A.isNull()) {A.initialize(kl,ku,N);}
+		copyToBandStorage(A.mData.dataPtr,kl+ku+1,0);
+	}
+
+	LapackBandMatrix getBandMatrix() const
+	{
+		LapackBandMatrix A(kl,ku,N);
+		copyToBandStorage(A.mData.dataPtr,kl+ku+1,0);
+		return A;
+	}
+
+	//
+	// Copies the matrix data into the LAPACK band storage array AB with
+	// leading dimension LDAB, starting at row rowOffset, i.e.
+	// AB(rowOffset + ku + i - j, j) = A(i,j). With LDAB = 2*kl+ku+1 and
+	// rowOffset = kl this is the input format of dgbtrf.
+	//
+	void copyToBandStorage(double* AB, long LDAB, long rowOffset) const
+	{
+		double* Dd;
+		for(long d = -kl; d <= ku; d++)
+		{
+		Dd = dData.dataPtr + (kl + d)*N;
+		for(long i = std::max((long)0,-d); i < std::min(N,N-d); i++)
+		{
+			AB[rowOffset + (ku - d) + (i + d)*LDAB] = Dd[i];
+		}
+		}
+	}
+
+    //
+    // y = alpha*A*x + beta*y
+    //
+    // If beta = 0 then y need not be initialized.
+    //
+    void apply(const double* x, double* y, double alpha = 1.0, double beta = 0.0) const
+    {
+    	long diagCount = kl + ku + 1;
+
+    	// Rows [iStart, iEnd) have all diagonals contained in the matrix
+
+    	long iStart = std::min(kl,N);
+    	long iEnd   = std::max(iStart,N - ku);
+
+    	applyRows(0,iStart,x,y,alpha,beta);
+    	applyRows(iEnd,N,x,y,alpha,beta);
+
+    	const double* D = dData.dataPtr;
+    	long i = iStart;
+
+#if defined(__AVX512F__)
+    	__m512d va = _mm512_set1_pd(alpha);
+    	__m512d vb = _mm512_set1_pd(beta);
+    	for(; i + 8 <= iEnd; i += 8)
+    	{
+    		__m512d acc = _mm512_setzero_pd();
+    		for(long k = 0; k < diagCount; k++)
+    		{
+    		acc = _mm512_fmadd_pd(_mm512_loadu_pd(D + k*N + i),_mm512_loadu_pd(x + i + (k - kl)),acc);
+    		}
+    		acc = _mm512_mul_pd(va,acc);
+    		if(beta != 0.0) {acc = _mm512_fmadd_pd(vb,_mm512_loadu_pd(y + i),acc);}
+    		_mm512_storeu_pd(y + i,acc);
+    	}
+#elif defined(__AVX2__)
+    	__m256d va = _mm256_set1_pd(alpha);
+    	__m256d vb = _mm256_set1_pd(beta);
+    	for(; i + 4 <= iEnd; i += 4)
+    	{
+    		__m256d acc = _mm256_setzero_pd();
+    		for(long k = 0; k < diagCount; k++)
+    		{
+#if defined(__FMA__)
+    		acc = _mm256_fmadd_pd(_mm256_loadu_pd(D + k*N + i),_mm256_loadu_pd(x + i + (k - kl)),acc);
+#else
+    		acc = _mm256_add_pd(acc,_mm256_mul_pd(_mm256_loadu_pd(D + k*N + i),_mm256_loadu_pd(x + i + (k - kl))));
+#endif
+    		}
+    		acc = _mm256_mul_pd(va,acc);
+    		if(beta != 0.0) {acc = _mm256_add_pd(acc,_mm256_mul_pd(vb,_mm256_loadu_pd(y + i)));}
+    		_mm256_storeu_pd(y + i,acc);
+    	}
+#endif
+
+    	double sum;
+    	for(; i < iEnd; i++)
+    	{
+    		sum = 0.0;
+    		for(long k = 0; k < diagCount; k++) {sum += D[k*N + i]*x[i + (k - kl)];}
+    		y[i] = (beta == 0.0) ? alpha*sum : alpha*sum + beta*y[i];
+    	}
+    }
+
+    //
+    // Y = alpha*A*X + beta*Y where X and Y are N x m matrices
+    //
+    void apply(const LapackMatrix& X, LapackMatrix& Y, double alpha = 1.0, double beta = 0.0) const
+    {
+    	assert(sizeCheck(X.rows,N));
+    	assert(sizeCheck(Y.rows,N));
+    	assert(sizeCheck(X.cols,Y.cols));
+
+    	for(long c = 0; c < X.cols; c++)
+    	{
+    	apply(X.dataPtr + c*N, Y.dataPtr + c*N, alpha, beta);
+    	}
+    }
+
+    std::vector<double> operator*(const std::vector<double>& x) const
+    {
+    	assert(sizeCheck((long)x.size(),N));
+    	std::vector<double> y(N,0.0);
+    	apply(&x[0],&y[0]);
+    	return y;
+    }
+
+    LapackMatrix operator*(const LapackMatrix& X) const
+    {
+    	LapackMatrix Y(N,X.cols);
+    	apply(X,Y);
+    	return Y;
+    }
+
+    //
+    // Product for rows [iBegin, iEnd) with bounds checking of the diagonals
+    //
+    void applyRows(long iBegin, long iEnd, const double* x, double* y, double alpha, double beta) const
+    {
+    	double sum;
+    	for(long i = iBegin; i < iEnd; i++)
+    	{
+    		sum = 0.0;
+    		for(long d = std::max(-kl,-i); d <= std::min(ku,N-1-i); d++)
+    		{
+    			sum += dData.dataPtr[(kl + d)*N + i]*x[i + d];
+    		}
+    		y[i] = (beta == 0.0) ? alpha*sum : alpha*sum + beta*y[i];
+    	}
+    }
+
+#ifdef _DEBUG
+	bool boundsCheck(long i, long j) const
+	{
+	    if((i < 0)||(i >= N)||(j < 0)||(j >= N)||(j - i > ku)||(i - j > kl))
+	    {
+	    std::cerr  <<  "DIA band matrix storage error " << std::endl;
+	    std::cerr  <<  "kl =  " << kl  <<  std::endl;
+	    std::cerr  <<  "ku =  " << ku  <<  std::endl;
+	    std::cerr  <<  "N  =  " << N   <<  std::endl;
+	    std::cerr  <<  "Offending indices " << "(" << i << ", " << j << ")" << std::endl;
+	    return false;
+	    }
+	    return true;
+	}
+
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "LapackBandMatrixDIA sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool boundsCheck(long, long) const {return true;}
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+    SCC::LapackMatrix dData;
+
+	long kl;
+	long ku;
+	long  N;
+};
+
+} // Namespace SCC
+
+#endif /* SCC_LAPACK_BAND_MATRIX_DIA_ */
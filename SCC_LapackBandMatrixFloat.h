@@ -0,0 +1,72 @@
+/*
+ * SCC_LapackBandMatrixFloat.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Instances of this class are N x N banded matrices with float entries
+// that are specified with three parameters:
+//
+// kl = lower bandwidth
+// ku = upper bandwidth
+//  N = system size
+//
+//
+// The indexing for the access operator()(i,j) starts at 0, consistent 
+// with the indexing of the other LapackInterface matrix classes.
+//
+// When complied with the _DEBUG pre-processor directive, then index checking 
+// is performed so that if an element is sought that is outside of the specification 
+// of the band matrix structure and exception is triggered (using assert(...)). 
+//
+// Internally the matrix data is stored as a SCC::LapackMatrixFloat
+// instance that contains the matrix data stored using the Lapack band 
+// storage convention, so that LAPACK band matrix routines can be
+// invoked without having to transform the matrix data. 
+//
+// Typical use case consists of initializing an instance
+// then setting values of the banded matrix using the
+// standard access operator.
+//
+// The data pointer obtained using getDataPointer() can be
+// passed to Lapack routines that assume a matrix stored
+// using the Lapack band matrix storage convention.
+//
+// LapackBandMatrixFloat is the instance LapackBandMatrixT<float> of the
+// band matrix class template defined in SCC_LapackBandMatrix.h.
+//
+// Lapack routine dependencies : sgbmv_
+/*
+#############################################################################
+#
+# Copyright 2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include "SCC_LapackMatrixFloat.h"
+#include "SCC_LapackBandMatrix.h"
+
+#ifndef SCC_LAPACK_BAND_MATRIX_FLOAT_
+#define SCC_LAPACK_BAND_MATRIX_FLOAT_
+
+namespace SCC
+{
+typedef LapackBandMatrixT<float> LapackBandMatrixFloat;
+} // Namespace SCC
+
+#endif
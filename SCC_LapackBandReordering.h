@@ -0,0 +1,653 @@
+/*
+ * SCC_LapackBandReordering.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// SCC::LapackBandReordering
+//
+// Utility classes for reducing the bandwidth of sparse matrices prior
+// to their assembly as LapackBandMatrix or LapackSymBandMatrix instances.
+//
+// The sparse matrix is specified by triplets (rowIndex[k], colIndex[k], values[k])
+// with 0-based indices. Repeated triplets are summed, as is typical
+// for finite element assembly.
+//
+// Since the cost of a banded factorization is O(N*kl*ku), a reduction
+// of the bandwidth by a factor of 10 reduces the factorization cost
+// by approximately a factor of 100.
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class RCMreordering : Computes a Reverse Cuthill-McKee permutation of
+//                       a sparse matrix pattern and assembles the permuted
+//                       matrix in LapackBandMatrix or LapackSymBandMatrix form.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class RCMbandSolver : Solves A*x = b for a sparse matrix A specified by
+//                       triplets using an RCM reordered LapackBandMatrix
+//                       and DGBSVX.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class RCMsymBandSolver : Solves A*x = b for a sparse symmetric positive
+//                          definite matrix A specified by triplets using an RCM
+//                          reordered LapackSymBandMatrix and DPBSV.
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "SCC_LapackMatrix.h"
+#include "SCC_LapackBandMatrix.h"
+#include "SCC_LapackSymBandMatrix.h"
+#include "SCC_LapackBandRoutines.h"
+#include "SCC_LapackSymBandRoutines.h"
+
+#ifndef SCC_LAPACK_BAND_REORDERING_
+#define SCC_LAPACK_BAND_REORDERING_
+
+namespace SCC
+{
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class RCMreordering
+//
+// The permutation is computed from the symmetrized pattern of the
+// matrix, A + A^T, so it is suitable for matrices with a symmetric,
+// or nearly symmetric, sparsity pattern.
+//
+// Each connected component of the pattern graph is ordered by a
+// breadth first search started from a pseudo-peripheral node (found
+// using the George-Liu algorithm), with the neighbors of each node
+// visited in order of increasing degree. The complete ordering
+// is then reversed.
+//
+// Permutation convention:
+//
+// perm[k]    = original index of the k'th unknown of the reordered system
+// invPerm[i] = index in the reordered system of the original unknown i
+//
+// so that Ap(invPerm[i],invPerm[j]) = A(i,j)
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class RCMreordering
+{
+public:
+
+	RCMreordering()
+	{
+	initialize();
+	}
+
+	RCMreordering(const RCMreordering& R)
+	{
+	initialize(R);
+	}
+
+	void initialize()
+	{
+	N       = 0;
+	kl      = 0;
+	ku      = 0;
+	klOrig  = 0;
+	kuOrig  = 0;
+	perm.clear();
+	invPerm.clear();
+	}
+
+	void initialize(const RCMreordering& R)
+	{
+	N       = R.N;
+	kl      = R.kl;
+	ku      = R.ku;
+	klOrig  = R.klOrig;
+	kuOrig  = R.kuOrig;
+	perm    = R.perm;
+	invPerm = R.invPerm;
+	}
+
+	//
+	// Computes the RCM permutation of the N x N matrix pattern specified
+	// by the triplet indices, and the bandwidths of the reordered matrix.
+	//
+	void createPermutation(long N, const std::vector<long>& rowIndex, const std::vector<long>& colIndex)
+	{
+	patternCheck(N,rowIndex,colIndex);
+
+	this->N = N;
+
+	// Create the adjacency structure of the symmetrized pattern
+	// in compressed row form
+
+	std::vector<long> adjStart(N+1,0);
+	std::vector<long> adj;
+
+	createAdjacency(rowIndex,colIndex,adjStart,adj);
+
+	std::vector<long> degree(N);
+	for(long i = 0; i < N; i++) {degree[i] = adjStart[i+1] - adjStart[i];}
+
+	perm.clear();
+	perm.reserve(N);
+
+	std::vector<bool> visited(N,false);
+	std::vector<long> levelMark(N,-1);
+	std::vector<long> component;
+	std::vector<long> nbrs;
+
+	long startNode; long head;
+
+	for(long i = 0; i < N; i++)
+	{
+	if(visited[i]) continue;
+
+	startNode = pseudoPeripheralNode(i,adjStart,adj,degree,levelMark,component);
+
+	// Cuthill-McKee ordering of the component
+
+	head = (long)perm.size();
+	perm.push_back(startNode);
+	visited[startNode] = true;
+
+	while(head < (long)perm.size())
+	{
+	long node = perm[head++];
+
+	nbrs.clear();
+	for(long p = adjStart[node]; p < adjStart[node+1]; p++)
+	{
+		if(not visited[adj[p]]) {nbrs.push_back(adj[p]); visited[adj[p]] = true;}
+	}
+
+	std::sort(nbrs.begin(),nbrs.end(),
+	[&degree](long a, long b) {return (degree[a] < degree[b])||((degree[a] == degree[b])&&(a < b));});
+
+	perm.insert(perm.end(),nbrs.begin(),nbrs.end());
+	}
+
+	}
+
+	std::reverse(perm.begin(),perm.end());
+
+	invPerm.resize(N);
+	for(long k = 0; k < N; k++) {invPerm[perm[k]] = k;}
+
+	// Bandwidths of the original and reordered matrices
+
+	kl = 0; ku = 0; klOrig = 0; kuOrig = 0;
+	long d;
+	for(size_t k = 0; k < rowIndex.size(); k++)
+	{
+	d      = rowIndex[k] - colIndex[k];
+	klOrig = std::max(klOrig, d);
+	kuOrig = std::max(kuOrig,-d);
+
+	d      = invPerm[rowIndex[k]] - invPerm[colIndex[k]];
+	kl     = std::max(kl, d);
+	ku     = std::max(ku,-d);
+	}
+	}
+
+	//
+	// Assembles the reordered matrix in band storage. Repeated triplets are summed.
+	//
+	void createBandMatrix(const std::vector<long>& rowIndex, const std::vector<long>& colIndex,
+	const std::vector<double>& values, SCC::LapackBandMatrix& Ap) const
+	{
+	tripletCheck(rowIndex,colIndex,values);
+
+	Ap.initialize(kl,ku,N);
+	for(size_t k = 0; k < values.size(); k++)
+	{
+	Ap(invPerm[rowIndex[k]],invPerm[colIndex[k]]) += values[k];
+	}
+	}
+
+	//
+	// Assembles the reordered symmetric matrix in symmetric band storage.
+	//
+	// Only the triplets in the upper triangle of the original matrix,
+	// rowIndex[k] <= colIndex[k], are used; the triplets below the diagonal
+	// are ignored. The triplets specifying the full matrix, as used by
+	// createBandMatrix(...), or only its upper triangle may thus be given.
+	// The upper triangle entries are mapped to the upper triangle of the
+	// reordered matrix. Repeated triplets are summed.
+	//
+	void createSymBandMatrix(const std::vector<long>& rowIndex, const std::vector<long>& colIndex,
+	const std::vector<double>& values, SCC::LapackSymBandMatrix& Sp) const
+	{
+	tripletCheck(rowIndex,colIndex,values);
+
+	Sp.initialize(std::max(kl,ku),N);
+
+	long i; long j;
+	for(size_t k = 0; k < values.size(); k++)
+	{
+	if(rowIndex[k] > colIndex[k]) continue;
+
+	i = invPerm[rowIndex[k]];
+	j = invPerm[colIndex[k]];
+	if(i <= j) {Sp(i,j) += values[k];}
+	else       {Sp(j,i) += values[k];}
+	}
+	}
+
+	//
+	// Maps a vector indexed by the original unknowns to the
+	// reordered unknowns : fp[k] = f[perm[k]]
+	//
+	void permute(const double* f, double* fp) const
+	{
+	for(long k = 0; k < N; k++) {fp[k] = f[perm[k]];}
+	}
+
+	//
+	// Maps a vector indexed by the reordered unknowns to the
+	// original unknowns : f[perm[k]] = fp[k]
+	//
+	void unpermute(const double* fp, double* f) const
+	{
+	for(long k = 0; k < N; k++) {f[perm[k]] = fp[k];}
+	}
+
+	void permute(std::vector<double>& f) const
+	{
+	std::vector<double> fp(N);
+	permute(&f[0],&fp[0]);
+	f = fp;
+	}
+
+	void unpermute(std::vector<double>& fp) const
+	{
+	std::vector<double> f(N);
+	unpermute(&fp[0],&f[0]);
+	fp = f;
+	}
+
+	const std::vector<long>& getPermutation() const
+	{return perm;}
+
+	const std::vector<long>& getInversePermutation() const
+	{return invPerm;}
+
+	long getDimension() const
+	{return N;}
+
+	long getLowerBandwidth() const
+	{return kl;}
+
+	long getUpperBandwidth() const
+	{return ku;}
+
+	long getOriginalLowerBandwidth() const
+	{return klOrig;}
+
+	long getOriginalUpperBandwidth() const
+	{return kuOrig;}
+
+//
+// Internal routines
+//
+
+	void createAdjacency(const std::vector<long>& rowIndex, const std::vector<long>& colIndex,
+	std::vector<long>& adjStart, std::vector<long>& adj) const
+	{
+	long i; long j;
+
+	std::vector<long> count(N,0);
+	for(size_t k = 0; k < rowIndex.size(); k++)
+	{
+	i = rowIndex[k]; j = colIndex[k];
+	if(i != j) {count[i]++; count[j]++;}
+	}
+
+	std::vector<long> fill(N+1,0);
+	for(i = 0; i < N; i++) {fill[i+1] = fill[i] + count[i];}
+
+	std::vector<long> adjTmp(fill[N]);
+	std::vector<long> pos(fill.begin(),fill.end()-1);
+
+	for(size_t k = 0; k < rowIndex.size(); k++)
+	{
+	i = rowIndex[k]; j = colIndex[k];
+	if(i != j) {adjTmp[pos[i]++] = j; adjTmp[pos[j]++] = i;}
+	}
+
+	// Remove duplicate connections
+
+	adj.clear();
+	adj.reserve(fill[N]);
+	adjStart.assign(N+1,0);
+
+	for(i = 0; i < N; i++)
+	{
+	std::sort(adjTmp.begin() + fill[i], adjTmp.begin() + fill[i+1]);
+	for(long p = fill[i]; p < fill[i+1]; p++)
+	{
+		if((p == fill[i])||(adjTmp[p] != adjTmp[p-1])) {adj.push_back(adjTmp[p]);}
+	}
+	adjStart[i+1] = (long)adj.size();
+	}
+	}
+
+	//
+	// Creates the level structure rooted at root. Returns the number of levels
+	// and the nodes of the last level in lastLevel. levelMark is used as scratch
+	// and is reset to -1 on the nodes visited before returning.
+	//
+	long rootedLevelStructure(long root, const std::vector<long>& adjStart, const std::vector<long>& adj,
+	std::vector<long>& levelMark, std::vector<long>& nodes, std::vector<long>& lastLevel) const
+	{
+	nodes.clear();
+	nodes.push_back(root);
+	levelMark[root] = 0;
+
+	long head      = 0;
+	long levelBase = 0;
+	long level     = 0;
+
+	while(head < (long)nodes.size())
+	{
+	long node = nodes[head++];
+	if(levelMark[node] != level) {level = levelMark[node]; levelBase = head-1;}
+
+	for(long p = adjStart[node]; p < adjStart[node+1]; p++)
+	{
+		if(levelMark[adj[p]] < 0)
+		{
+		levelMark[adj[p]] = levelMark[node] + 1;
+		nodes.push_back(adj[p]);
+		}
+	}
+	}
+
+	lastLevel.assign(nodes.begin() + levelBase, nodes.end());
+
+	for(size_t k = 0; k < nodes.size(); k++) {levelMark[nodes[k]] = -1;}
+
+	return level + 1;
+	}
+
+	//
+	// George-Liu pseudo-peripheral node finder applied to the connected
+	// component containing the node seed. The search is started from
+	// a node of minimal degree in the component.
+	//
+	long pseudoPeripheralNode(long seed, const std::vector<long>& adjStart, const std::vector<long>& adj,
+	const std::vector<long>& degree, std::vector<long>& levelMark, std::vector<long>& component) const
+	{
+	std::vector<long> lastLevel;
+
+	rootedLevelStructure(seed,adjStart,adj,levelMark,component,lastLevel);
+
+	long root = seed;
+	for(size_t k = 0; k < component.size(); k++)
+	{
+	if(degree[component[k]] < degree[root]) {root = component[k];}
+	}
+
+	long levelCount = rootedLevelStructure(root,adjStart,adj,levelMark,component,lastLevel);
+	long newLevelCount;
+	long candidate;
+
+	while(true)
+	{
+	candidate = lastLevel[0];
+	for(size_t k = 1; k < lastLevel.size(); k++)
+	{
+		if(degree[lastLevel[k]] < degree[candidate]) {candidate = lastLevel[k];}
+	}
+
+	newLevelCount = rootedLevelStructure(candidate,adjStart,adj,levelMark,component,lastLevel);
+
+	if(newLevelCount <= levelCount) break;
+
+	root       = candidate;
+	levelCount = newLevelCount;
+	}
+
+	return root;
+	}
+
+	void patternCheck(long N, const std::vector<long>& rowIndex, const std::vector<long>& colIndex) const
+	{
+	if(rowIndex.size() != colIndex.size())
+	{
+		throw std::runtime_error("\nRCMreordering : Row and column index arrays have different sizes \n");
+	}
+
+	for(size_t k = 0; k < rowIndex.size(); k++)
+	{
+	if((rowIndex[k] < 0)||(rowIndex[k] >= N)||(colIndex[k] < 0)||(colIndex[k] >= N))
+	{
+		std::stringstream sout;
+		sout << "\nRCMreordering Error \n";
+		sout << "Triplet index (" << rowIndex[k] << ", " << colIndex[k] << ") ";
+		sout << "is not contained in [0, " << N-1 << "] \n";
+		throw std::runtime_error(sout.str());
+	}
+	}
+	}
+
+	void tripletCheck(const std::vector<long>& rowIndex, const std::vector<long>& colIndex,
+	const std::vector<double>& values) const
+	{
+	if((rowIndex.size() != values.size())||(colIndex.size() != values.size()))
+	{
+		throw std::runtime_error("\nRCMreordering : Triplet index and value arrays have different sizes \n");
+	}
+	if(invPerm.size() != (size_t)N)
+	{
+		throw std::runtime_error("\nRCMreordering : createPermutation(...) not called before matrix assembly \n");
+	}
+	}
+
+	long      N;
+	long     kl;
+	long     ku;
+	long klOrig;
+	long kuOrig;
+
+	std::vector<long>    perm;
+	std::vector<long> invPerm;
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class RCMbandSolver
+//
+// Creates the RCM reordered band matrix from triplets, factors it using
+// DGBSVX, and applies the inverse to vectors indexed by the original
+// unknowns; the reordering is applied to the right hand side and
+// removed from the solution internally.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class RCMbandSolver
+{
+public:
+
+	RCMbandSolver()
+	{
+	initialize();
+	}
+
+	RCMbandSolver(const RCMbandSolver& R)
+	{
+	initialize(R);
+	}
+
+	void initialize()
+	{
+	reordering.initialize();
+	Ap.initialize();
+	dgbsvx.initialize();
+	fp.clear();
+	}
+
+	void initialize(const RCMbandSolver& R)
+	{
+	reordering.initialize(R.reordering);
+	Ap.initialize(R.Ap);
+	dgbsvx.initialize(R.dgbsvx);
+	fp = R.fp;
+	}
+
+	void createFactors(long N, const std::vector<long>& rowIndex, const std::vector<long>& colIndex,
+	const std::vector<double>& values)
+	{
+	reordering.createPermutation(N,rowIndex,colIndex);
+	reordering.createBandMatrix(rowIndex,colIndex,values,Ap);
+	dgbsvx.createFactors(Ap);
+	fp.resize(N);
+	}
+
+	void applyInverse(std::vector<double>& f)
+	{
+	applyInverse(&f[0]);
+	}
+
+	void applyInverse(LapackMatrix& F)
+	{
+	for(long k = 0; k < F.cols; k++)
+	{
+	applyInverse(F.dataPtr + k*F.rows);
+	}
+	}
+
+	void applyInverse(double* f)
+	{
+	reordering.permute(f,&fp[0]);
+	dgbsvx.applyInverse(&fp[0]);
+	reordering.unpermute(&fp[0],f);
+	}
+
+	double getReciprocalCondNumber()
+	{
+	return dgbsvx.getReciprocalCondNumber();
+	}
+
+	RCMreordering         reordering;
+	SCC::LapackBandMatrix         Ap;
+	SCC::DGBSVX               dgbsvx;
+	std::vector<double>           fp;
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class RCMsymBandSolver
+//
+// Creates the RCM reordered symmetric band matrix from triplets (see
+// RCMreordering::createSymBandMatrix for the triplet convention: the
+// triplets of the full matrix, as used by RCMbandSolver, or of its upper
+// triangle may be given), creates
+// its Cholesky factors using DPBSV, and applies the inverse to vectors
+// indexed by the original unknowns.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class RCMsymBandSolver
+{
+public:
+
+	RCMsymBandSolver()
+	{
+	initialize();
+	}
+
+	RCMsymBandSolver(const RCMsymBandSolver& R)
+	{
+	initialize(R);
+	}
+
+	void initialize()
+	{
+	reordering.initialize();
+	Sp.initialize();
+	dpbsv.initialize();
+	Fp.initialize();
+	}
+
+	void initialize(const RCMsymBandSolver& R)
+	{
+	reordering.initialize(R.reordering);
+	Sp.initialize(R.Sp);
+	dpbsv.initialize(R.dpbsv);
+	Fp.initialize(R.Fp);
+	}
+
+	void createFactors(long N, const std::vector<long>& rowIndex, const std::vector<long>& colIndex,
+	const std::vector<double>& values)
+	{
+	reordering.createPermutation(N,rowIndex,colIndex);
+	reordering.createSymBandMatrix(rowIndex,colIndex,values,Sp);
+	dpbsv.createFactors(Sp);
+	}
+
+	void applyInverse(std::vector<double>& f)
+	{
+	applyInverse(&f[0]);
+	}
+
+	void applyInverse(LapackMatrix& F)
+	{
+	applyInverse(F.dataPtr,F.cols);
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions.
+	//
+	void applyInverse(double* f, long NRHS = 1)
+	{
+	long N = reordering.getDimension();
+
+	Fp.initialize(N,NRHS);
+	for(long k = 0; k < NRHS; k++) {reordering.permute(f + k*N, Fp.dataPtr + k*N);}
+
+	dpbsv.applyInverse(Fp.dataPtr,NRHS);
+
+	for(long k = 0; k < NRHS; k++) {reordering.unpermute(Fp.dataPtr + k*N, f + k*N);}
+	}
+
+	double getReciprocalCondNumber()
+	{
+	return dpbsv.getReciprocalCondNumber();
+	}
+
+	RCMreordering          reordering;
+	SCC::LapackSymBandMatrix       Sp;
+	SCC::DPBSV                  dpbsv;
+	SCC::LapackMatrix              Fp;
+};
+
+} // Namespace SCC
+
+#endif /* SCC_LAPACK_BAND_REORDERING_ */
@@ -5,6 +5,7 @@
  *      Author: anderson
  *
  *  Updated: Dec. 8, 2023 (C.R. Anderson)
+ *  Updated: Oct. 18, 2026 (C.R. Anderson)
  */
 //
 // SCC::LapackBandMatrixRoutines
@@ -33,8 +34,9 @@
 // Current class list
 // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-// Class DGBSVX : Created for solving A*X = B using LU factorization
-//                when A is a band matrix.
+// Class GBSVX : Created for solving A*X = B using LU factorization
+//               when A is a band matrix (double or complex). DGBSVX is
+//               GBSVX<double> and ZGBSVX is GBSVX<std::complex<double>>.
 // LAPACK base routine description:
 // DGBSVX uses the LU factorization to compute the solution to a real
 // system of linear equations A * X = B, A**T * X = B, or A**H * X = B,
@@ -43,6 +45,21 @@
 
 // Error bounds on the solution and a condition estimate are also
 // provided.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class BandWoodburySolver : Created for solving A*X = B when A is a band
+//                            matrix with cached LU factors plus a low rank
+//                            update, using the Sherman-Morrison-Woodbury formula.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class GBSV : Created for solving A*X = B using LU factorization
+//              when A is a band matrix (double, float or complex). DGBSV is
+//              GBSV<double> and SGBSV is GBSV<float>.
+// LAPACK base routines description:
+// DGBTRF computes an LU factorization of a real m-by-n band matrix A
+// using partial pivoting with row interchanges.
+// DGBTRS solves a system of linear equations
+//     A * X = B  or  A**T * X = B
+// with a general band matrix A using the LU factorization computed
+// by DGBTRF.
 /*
 #############################################################################
 #
@@ -75,10 +92,16 @@
 #include <vector>
 #include <iostream>
 #include <cstring>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
 
 #include "SCC_LapackHeaders.h"
 #include "SCC_LapackMatrix.h"
 #include "SCC_LapackBandMatrix.h"
+#include "SCC_LapackBandMatrixDIA.h"
+#include "SCC_LapackTraits.h"
 
 #ifndef SCC_LAPACK_BAND_ROUTINES_
 #define SCC_LAPACK_BAND_ROUTINES_
@@ -87,8 +110,218 @@ namespace SCC
 {
 
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
-// Class DGBSVX : Created for solving A*X = B using LU factorization
-//                when A is a band matrix.
+// Class GBSV : Created for solving A*X = B using LU factorization
+//              when A is a band matrix.
+//
+// The interface is that of GBSVX with error estimation cleared: the
+// factors are created with createFactors(...) and re-used by each
+// applyInverse(...) invocation. The reciprocal condition number is
+// computed with xGBCON on the first request after the factors are created.
+// An exactly singular matrix, or an error returned by xGBTRF, xGBTRS or
+// xGBCON, results in a std::runtime_error exception.
+//
+// The class is a template, GBSV<T>, with T = double, float or
+// std::complex<double> invoking the D, S or Z prefixed versions of
+// xGBTRF/xGBTRS/xGBCON, the routines being selected at compile time
+// using LapackTraits<T>. Complex data is passed to the RealType*
+// applyInverse(...) member function as alternating real and imaginary parts.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <class T>
+class GBSV
+{
+public:
+
+    typedef typename LapackTraits<T>::RealType RealType;
+
+	GBSV()
+	{
+	initialize();
+	}
+
+	GBSV(const GBSV& gbsv)
+	{
+	initialize(gbsv);
+	}
+
+	void initialize()
+	{
+	AFB.initialize();
+	IPIV.clear();
+
+	N     = 0;
+	KL    = 0;
+	KU    = 0;
+	ANORM = 0.0;
+	RCOND = -1.0;
+	}
+
+	void initialize(const GBSV& gbsv)
+	{
+	AFB.initialize(gbsv.AFB);
+	IPIV  = gbsv.IPIV;
+
+	N     = gbsv.N;
+	KL    = gbsv.KL;
+	KU    = gbsv.KU;
+	ANORM = gbsv.ANORM;
+	RCOND = gbsv.RCOND;
+	}
+
+	void applyInverse(const LapackBandMatrixT<T>& S, LapackMatrixT<T>& x)
+	{
+	createFactors(S);
+	applyInverse(x);
+	}
+
+	void applyInverse(const LapackBandMatrixT<T>& S, std::vector<T>& f)
+	{
+	createFactors(S);
+	applyInverse(f);
+	}
+
+	void applyInverse(std::vector<T>& f)
+	{
+	applyInverse(reinterpret_cast<RealType*>(&f[0]));
+	}
+
+	void applyInverse(LapackMatrixT<T>& F)
+	{
+	applyInverse(F.getDataPointer(),F.cols);
+	}
+
+	void applyInverse(RealType* f, long NRHS = 1)
+	{
+    char TRANS = 'N';
+    long LDAFB = 2*KL+KU+1;
+    long LDB   = N;
+    long INFO  = 0;
+
+    LapackTraits<T>::gbtrs(&TRANS, &N, &KL, &KU, &NRHS, AFB.getDataPointer(), &LDAFB, &IPIV[0], f, &LDB, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "gbtrs \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+	//
+	// Factors the matrix using xGBTRF. The band data of S is copied
+	// into rows KL through 2*KL+KU of AFB, the rows above being required
+	// for the fill-in created by row interchanges.
+	//
+	void createFactors(const LapackBandMatrixT<T>& S)
+	{
+    N  = S.N;
+    KL = S.kl;
+    KU = S.ku;
+
+    long nc    = LapackTraits<T>::realComponents;
+    long LDAB  = KL + KU + 1;
+    long LDAFB = 2*KL+KU+1;
+
+    AFB.initialize(LDAFB,N);
+    IPIV.resize(N);
+
+    for(long j = 0; j < N; j++)
+    {
+    std::memcpy(AFB.getDataPointer() + nc*(j*LDAFB + KL), S.getDataPointer() + nc*j*LDAB, nc*LDAB*sizeof(RealType));
+    }
+
+    factor();
+	}
+
+	//
+	// Creates the factors of a band matrix in diagonal-major form (T = double).
+	// The LAPACK band storage form of S is created directly in the
+	// factorization array. This is a member template so that it is only
+	// instantiated when used.
+	//
+	template <class U = T>
+	void createFactors(const LapackBandMatrixDIA& S)
+	{
+    static_assert(std::is_same<U,double>::value,"GBSV<T> : LapackBandMatrixDIA requires T = double");
+
+    N  = S.N;
+    KL = S.kl;
+    KU = S.ku;
+
+    AFB.initialize(2*KL+KU+1,N);
+    IPIV.resize(N);
+
+    S.copyToBandStorage(AFB.getDataPointer(),2*KL+KU+1,KL);
+
+    factor();
+	}
+
+	//
+	// Factors the matrix stored in rows KL through 2*KL+KU of AFB using xGBTRF
+	//
+	void factor()
+	{
+    long LDAFB = 2*KL+KU+1;
+
+    // 1-norm of A, required for condition number estimates, computed
+    // from the band data in rows KL through 2*KL+KU of AFB
+
+    ANORM = 0.0;
+    for(long j = 0; j < N; j++)
+    {
+    RealType colSum = 0.0;
+    for(long i = KL; i < LDAFB; i++) {colSum += std::abs(AFB(i,j));}
+    ANORM = (colSum > ANORM) ? colSum : ANORM;
+    }
+
+    RCOND = -1.0;
+
+    long INFO = 0;
+
+    LapackTraits<T>::gbtrf(&N, &N, &KL, &KU, AFB.getDataPointer(), &LDAFB, &IPIV[0], &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "gbtrf \nError INFO = " << INFO << "\n";
+    	if(INFO > 0) {sout << "U(" << INFO << "," << INFO << ") is exactly zero: the matrix is singular \n";}
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+	RealType getReciprocalCondNumber()
+	{
+	if(RCOND < 0.0)
+	{
+    char NORM  = '1';
+    long LDAFB = 2*KL+KU+1;
+    long INFO  = 0;
+
+    LapackTraits<T>::gbcon(&NORM, &N, &KL, &KU, AFB.getDataPointer(), &LDAFB, &IPIV[0], &ANORM, &RCOND, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "gbcon \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+	return RCOND;
+	}
+
+	LapackMatrixT<T>       AFB;
+	std::vector<long>     IPIV;
+
+	long     N;
+	long    KL;
+	long    KU;
+	RealType ANORM;
+	RealType RCOND;
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class GBSVX : Created for solving A*X = B using LU factorization
+//               when A is a band matrix.
 // LAPACK base routine description:
 // DGBSVX uses the LU factorization to compute the solution to a real
 // system of linear equations A * X = B, A**T * X = B, or A**H * X = B,
@@ -97,20 +330,49 @@ namespace SCC
 
 // Error bounds on the solution and a condition estimate are also
 // provided.
+//
+// The class is a template, GBSVX<T>, with
+//
+// T = double               : DGBSVX = GBSVX<double>
+// T = std::complex<double> : ZGBSVX = GBSVX<std::complex<double>>
+//
+// with the LAPACK routine selected at compile time using LapackTraits<T>.
+// Complex data is passed to the RealType* applyInverse(...) member function
+// as alternating real and imaginary parts.
+//
+// The factors are created with createFactors(...) and re-used by each
+// subsequent applyInverse(...) invocation; applyInverse(A,B) creates the
+// factors of A and then solves. An error returned by xGBSVX, or a matrix
+// that is exactly singular, results in a std::runtime_error exception.
+// A matrix that is singular to working precision (INFO = N+1) is not
+// an error; the reciprocal condition number should be checked.
+//
+// If error estimation is cleared, using clearErrorEstimation(), the
+// factors are created and solutions obtained by a GBSV<T> member
+// (xGBTRF/xGBTRS), avoiding the iterative refinement and error bound
+// computation performed by xGBSVX for every solve. In this mode no
+// copy of the original matrix is retained, equilibration is not
+// performed, the forward and backward error estimates are not available,
+// and the reciprocal condition number is computed with xGBCON only when
+// requested. In this mode an error returned by xGBTRF, xGBTRS or
+// xGBCON also results in a std::runtime_error exception.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-class DGBSVX
+template <class T>
+class GBSVX
 {
 	public:
 
-	DGBSVX()
+    typedef typename LapackTraits<T>::RealType RealType;
+
+	GBSVX()
 	{
 	initialize();
 	}
 
-	DGBSVX(const DGBSVX& dgbsvx)
+	GBSVX(const GBSVX& gbsvx)
 	{
-		initialize(dgbsvx);
+		initialize(gbsvx);
 	}
 
 	void initialize()
@@ -118,8 +380,14 @@ class DGBSVX
 		FACT  = 'E'; // E = equilibrate
 		EQUED = 'B';
 		RCOND = 0.0;
-	    FERR  = 0.0;
-	    BERR  = 0.0;
+	    FERR.clear();
+	    BERR.clear();
+
+	    errorEstimateFlag = true;
+
+	    N  = 0;
+	    KL = 0;
+	    KU = 0;
 
 	    ABmatrix.initialize();
 	    AFB.initialize();
@@ -127,28 +395,35 @@ class DGBSVX
 	    R.clear();
 	    C.clear();
 	    X.clear();
-	    WORK.clear();
-	    IWORK.clear();
+
+	    gbsv.initialize();
 	}
-	void initialize(const DGBSVX& dgbsvx)
+
+	void initialize(const GBSVX& gbsvx)
 	{
-		FACT  = dgbsvx.FACT;
-		EQUED = dgbsvx.EQUED;
+		FACT  = gbsvx.FACT;
+		EQUED = gbsvx.EQUED;
+
+		RCOND = gbsvx.RCOND;
+	    FERR  = gbsvx.FERR;
+	    BERR  = gbsvx.BERR;
+
+	    errorEstimateFlag = gbsvx.errorEstimateFlag;
 
-		RCOND = dgbsvx.RCOND;
-	    FERR  = dgbsvx.FERR;
-	    BERR  = dgbsvx.BERR;
+	    N  = gbsvx.N;
+	    KL = gbsvx.KL;
+	    KU = gbsvx.KU;
 
 	    // For caching factors
 
-	    ABmatrix.initialize(dgbsvx.ABmatrix);
-	    AFB.initialize(dgbsvx.AFB);
-	    IPIV = dgbsvx.IPIV;
-	    R    = dgbsvx.R;
-	    C    = dgbsvx.C;
-	    X    = dgbsvx.X;
-	    WORK = dgbsvx.WORK;
-	    IWORK= dgbsvx.IWORK;
+	    ABmatrix.initialize(gbsvx.ABmatrix);
+	    AFB.initialize(gbsvx.AFB);
+	    IPIV = gbsvx.IPIV;
+	    R    = gbsvx.R;
+	    C    = gbsvx.C;
+	    X    = gbsvx.X;
+
+	    gbsv.initialize(gbsvx.gbsv);
 	}
 
 	void setEquilibration(bool val = true)
@@ -174,75 +449,114 @@ class DGBSVX
     */
 
 
-	void setEquilibrationType(char T)
+	void setEquilibrationType(char equedType)
+	{
+	EQUED = equedType;
+	}
+
+	//
+	// Specifies whether solutions are obtained with xGBSVX, with
+	// iterative refinement and error estimates (the default), or
+	// with xGBTRS alone. Must be set before createFactors(...) is invoked.
+	//
+	void setErrorEstimation(bool val = true)
 	{
-	EQUED = T;
+	errorEstimateFlag = val;
 	}
 
-    void applyInverse(SCC::LapackBandMatrix& S, LapackMatrix& x)
+	void clearErrorEstimation()
 	{
-    assert(sizecheckNx1(S.N,x.rows,x.cols));
-	applyInverse(S,x.dataPtr);
+	errorEstimateFlag = false;
 	}
 
-	void applyInverse(SCC::LapackBandMatrix& S, std::vector<double>& f)
+    void applyInverse(const LapackBandMatrixT<T>& S, LapackMatrixT<T>& F)
 	{
-	applyInverse(S,&f[0]);
+    assert(S.sizeCheck(S.N,F.rows));
+    createFactors(S);
+	applyInverse(F);
 	}
 
-	void applyInverse(SCC::LapackBandMatrix& S, double* f)
+	void applyInverse(const LapackBandMatrixT<T>& S, std::vector<T>& f)
 	{
+	assert(S.sizeCheck(S.N,(long)f.size()));
 	createFactors(S);
 	applyInverse(f);
-	return;
 	}
 
+	void applyInverse(const LapackBandMatrixT<T>& S, RealType* f, long NRHS = 1)
+	{
+	createFactors(S);
+	applyInverse(f,NRHS);
+	}
 
-	void applyInverse(double* f)
+	void applyInverse(std::vector<T>& f)
 	{
-    //char FACT  = 'E'; // E Or N for no-equilibration
+	applyInverse(reinterpret_cast<RealType*>(&f[0]));
+	}
 
-    char TRANS = 'N';
+	void applyInverse(LapackMatrixT<T>& F)
+	{
+	applyInverse(F.getDataPointer(),F.cols);
+	}
 
-    long N     = ABmatrix.N;
-    long KL    = ABmatrix.kl;
-    long KU    = ABmatrix.ku;
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions. When error estimation
+	// is specified an error estimate is computed for each right hand side.
+	//
+	void applyInverse(RealType* f, long NRHS = 1)
+	{
+	if(not errorEstimateFlag)
+	{
+	gbsv.applyInverse(f,NRHS);
+	return;
+	}
+
+    char FACT_TYPE = 'F'; // Use the factors created by createFactors(...)
+    char TRANS     = 'N';
 
-    long NRHS  = 1;
-    double* AB = ABmatrix.getDataPointer();
+    long nc    = LapackTraits<T>::realComponents;
     long LDAB  = KL + KU + 1;
     long LDAFB = 2*KL+KU+1;
+    long LDB   = N;
+    long LDX   = N;
 
-    double* Bptr = &f[0];
-    long LDB     = N;
-    long LDX     = N;
+    X.resize(nc*N*NRHS);
+    FERR.resize(NRHS);
+    BERR.resize(NRHS);
 
     long INFO = 0;
 
-    // coeffRHS
-    char FACT_TYPE = 'F';
+    LapackTraits<T>::gbsvx(&FACT_TYPE, &TRANS, &N, &KL, &KU, &NRHS, ABmatrix.getDataPointer(), &LDAB,
+    		AFB.getDataPointer(), &LDAFB, &IPIV[0], &EQUED, &R[0], &C[0], f, &LDB, &X[0], &LDX,
+			&RCOND, &FERR[0], &BERR[0], &INFO);
 
-    dgbsvx_(&FACT_TYPE, &TRANS, &N, &KL, &KU, &NRHS, AB, &LDAB, AFB.getDataPointer(), &LDAFB, &IPIV[0], &EQUED,
-    		&R[0], &C[0], Bptr, &LDB, &X[0], &LDX,&RCOND, &FERR,
-			&BERR, &WORK[0], &IWORK[0], &INFO);
-
-    if(INFO != 0)
+    if((INFO < 0)||((INFO > 0)&&(INFO <= N)))
     {
-    	if(INFO < 0) { std::cout << -INFO << "argument to dgbsvx had an illegal value " << std::endl;}
-    	if(INFO > 0) { std::cout <<  "Error in dgbsvs INFO = " << INFO << " " << " N " << N << std::endl;}
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "gbsvx \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
     }
 
     // Capture the solution
 
-    // f = X;
-
-    std::memcpy(&f[0],&X[0],N*sizeof(double));
+    std::memcpy(f,&X[0],nc*N*NRHS*sizeof(RealType));
 	}
 
+	void createFactors(const LapackBandMatrixT<T>& S)
+	{
+    N  = S.N;
+    KL = S.kl;
+    KU = S.ku;
 
+    if(not errorEstimateFlag)
+    {
+    releaseFactors();
+    gbsv.createFactors(S);
+    return;
+    }
 
-	void createFactors(const SCC::LapackBandMatrix& S)
-	{
+    gbsv.initialize();
 
     // non-default equilibration set before call to this method
 
@@ -254,12 +568,7 @@ class DGBSVX
 
     char TRANS = 'N';
 
-    long N     = S.N;
-    long KL    = S.kl;
-    long KU    = S.ku;
-
     ABmatrix.initialize(S);
-    double* AB = ABmatrix.getDataPointer();
     long LDAB  = KL + KU + 1;
     long LDAFB = 2*KL+KU+1;
 
@@ -267,45 +576,95 @@ class DGBSVX
     IPIV.resize(N);
     R.resize(N);
     C.resize(N);
-    X.resize(N);
-
-    WORK.resize(3*N);
-    IWORK.resize(N);
 
-    double doubleNull = 0.0;
-    double* Bptr      = &doubleNull;
-    long LDB          = N;
+    RealType bNull[2] = {0.0,0.0};
+    RealType xNull[2] = {0.0,0.0};
+    RealType ferrNull = 0.0;
+    RealType berrNull = 0.0;
 
-    double xNull      = 0.0;
-    double* xPtr      = &xNull;
-
-    long LDX           = N;
+    long LDB  = N;
+    long LDX  = N;
+    long INFO = 0;
 
-    //double RCOND = 1.0;
-    //double FERR;
-    //double BERR;
+    LapackTraits<T>::gbsvx(&FACT, &TRANS, &N, &KL, &KU, &NRHS, ABmatrix.getDataPointer(), &LDAB,
+    		AFB.getDataPointer(), &LDAFB, &IPIV[0], &EQUED, &R[0], &C[0], bNull, &LDB, xNull, &LDX,
+			&RCOND, &ferrNull, &berrNull, &INFO);
 
-    long INFO = 0;
+    FERR.clear();
+    BERR.clear();
 
+    if((INFO < 0)||((INFO > 0)&&(INFO <= N)))
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "gbsvx \nError INFO = " << INFO << "\n";
+    	if(INFO > 0) {sout << "U(" << INFO << "," << INFO << ") is exactly zero: the matrix is singular \n";}
+    	throw std::runtime_error(sout.str());
+    }
+	}
 
-    dgbsvx_(&FACT, &TRANS, &N, &KL, &KU, &NRHS, AB, &LDAB, AFB.getDataPointer(), &LDAFB, &IPIV[0], &EQUED,
-    		&R[0], &C[0], Bptr, &LDB, xPtr, &LDX,&RCOND, &FERR,
-			&BERR, &WORK[0], &IWORK[0], &INFO);
+	//
+	// Creates the factors of a band matrix in diagonal-major form (T = double).
+	// When error estimation is cleared the LAPACK band storage form of S is
+	// created directly in the factorization array. This is a member template
+	// so that it is only instantiated when used.
+	//
+	template <class U = T>
+	void createFactors(const LapackBandMatrixDIA& S)
+	{
+    static_assert(std::is_same<U,double>::value,"GBSVX<T> : LapackBandMatrixDIA requires T = double");
 
-    if(INFO != 0)
+    if(errorEstimateFlag)
     {
-    	if(INFO < 0) { std::cout << -INFO << "argument to dgbsvx had an illegal value " << std::endl;}
-    	if(INFO > 0) { std::cout <<  "Error in dgbsvs INFO = " << INFO << " " << " N " << N << std::endl;}
+    createFactors(S.getBandMatrix());
+    return;
     }
 
+    N  = S.N;
+    KL = S.kl;
+    KU = S.ku;
+
+    releaseFactors();
+    gbsv.createFactors(S);
 	}
 
+	//
+	// Releases the storage only required by xGBSVX
+	//
+	void releaseFactors()
+	{
+    ABmatrix.initialize();
+    AFB.initialize();
+    IPIV.clear();
+    R.clear();
+    C.clear();
+    X.clear();
+
+    RCOND = 0.0;
+    FERR.clear();
+    BERR.clear();
+	}
 
-	double getReciprocalCondNumber()
+/*
+*  RCOND is DOUBLE PRECISION
+*  The estimate of the reciprocal condition number of the matrix
+*  A after equilibration (if done).  If RCOND is less than the
+*  machine precision (in particular, if RCOND = 0), the matrix
+*  is singular to working precision.
+*
+*  When error estimation is cleared, the reciprocal condition number
+*  is computed using xGBCON on the first request after the factors are created.
+*/
+	RealType getReciprocalCondNumber()
 	{
+	if(not errorEstimateFlag) {return gbsv.getReciprocalCondNumber();}
 	return RCOND;
 	}
 
+	RealType getReciprocalConditionNumber()
+	{
+	return getReciprocalCondNumber();
+	}
+
 /*
 *  FERR    (output) DOUBLE PRECISION array, dimension (NRHS)
 *          The estimated forward error bound for each solution vector
@@ -316,8 +675,21 @@ class DGBSVX
 *          largest element in X(j).  The estimate is as reliable as
 *          the estimate for RCOND, and is almost always a slight
 *          overestimate of the true error.
+*
+*  The single value getters return the estimate for the first right hand
+*  side, and 0 if no estimates are available.
 */
-	double getForwardErrEstimate()
+	RealType getForwardErrEstimate()
+	{
+	return (FERR.size() > 0) ? FERR[0] : 0.0;
+	}
+
+	RealType getSolutionErrorEst()
+	{
+	return getForwardErrEstimate();
+	}
+
+	std::vector<RealType> getMultipleSolutionErrorEst()
 	{
 	return FERR;
 	}
@@ -328,7 +700,17 @@ class DGBSVX
 *          vector X(j) (i.e., the smallest relative change in
 *          any element of A or B that makes X(j) an exact solution).
 */
-	double getBackwardErrEstimate()
+	RealType getBackwardErrEstimate()
+	{
+	return (BERR.size() > 0) ? BERR[0] : 0.0;
+	}
+
+	RealType getSolutionBackwardErrorEst()
+	{
+	return getBackwardErrEstimate();
+	}
+
+	std::vector<RealType> getMultipleSolutionBackwardErrorEst()
 	{
 	return BERR;
 	}
@@ -337,38 +719,534 @@ class DGBSVX
 	char   FACT;
 	char   EQUED;
 
-	double RCOND;
-    double FERR;
-    double BERR;
+	RealType            RCOND;
+    std::vector<RealType> FERR;
+    std::vector<RealType> BERR;
+
+    bool errorEstimateFlag;
+
+    long N;
+    long KL;
+    long KU;
 
     // For caching factors
 
-    SCC::LapackBandMatrix ABmatrix;
-    SCC::LapackMatrix          AFB;
+    LapackBandMatrixT<T>  ABmatrix;
+    LapackMatrixT<T>           AFB;
     std::vector<long>         IPIV;
-    std::vector<double>          R;
-    std::vector<double>          C;
-    std::vector<double>          X;
-    std::vector<double>        WORK;
-    std::vector<long>         IWORK;
-
-#ifdef _DEBUG
-    bool sizecheckNx1(long bandDim, long rows, long cols) const
-    {
-    if((rows != bandDim) || (cols != 1))
-    {
-    std::cerr  <<  "LapackBandMatrix * LapackMatrix error   "  << "\n";
-    std::cerr  <<  "LapackMatrix must be N x 1 matrix       "  << "\n";
-    std::cerr  <<  "LapackMatrix rows : "  << rows << "\n";
-    std::cerr  <<  "LapackMatrix cols : "  << cols << "\n";
-    return false;
-    }
-    return true;
-    }
-#else
-bool sizecheckNx1(long bandDim, long rows, long cols)  const {return true;}
-#endif
+    std::vector<RealType>        R;
+    std::vector<RealType>        C;
+    std::vector<RealType>        X;
 
+    // LU factors when error estimation is cleared
+
+    GBSV<T>                   gbsv;
+};
+
+typedef GBSV<double>   DGBSV;
+typedef GBSVX<double> DGBSVX;
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class BandWoodburySolver : Created for solving A*X = B when A = A0 + U*V^T
+//                            where A0 is a band matrix with cached LU factors
+//                            and U*V^T is a low rank update.
+//
+// The solution is computed using the Sherman-Morrison-Woodbury formula
+//
+//  (A0 + U V^T)^{-1} B = Y - Z C^{-1} (V^T Y)
+//
+// where Y = A0^{-1} B, Z = A0^{-1} U and C = I + V^T Z is the r x r
+// capacitance matrix (r = the rank of the update). The factors of A0 are
+// created once using DGBSVX with error estimation cleared (DGBTRF),
+// and C is factored using DGETRF. Adding an update of rank k costs k
+// band solves and the refactorization of C, rather than the
+// O(N*kl*ku) refactorization of the band matrix.
+//
+// Updates are accumulated. When the accumulated rank exceeds the maximal
+// rank (setMaxRank(...)), the accumulated update is first recompressed
+// to its numerical rank using QR factorizations of U and V and the SVD of
+// the r x r core matrix. If the rank still exceeds the maximal rank, the
+// update is added to A0, widening the bandwidth of A0 if required, and A0
+// is refactored.
+//
+// Note: updates whose non-zero rows of U and V are far apart (e.g.
+// dense rows) can widen the band significantly when added to A0.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class BandWoodburySolver
+{
+	public:
+
+	BandWoodburySolver()
+	{
+	initialize();
+	}
+
+	BandWoodburySolver(const BandWoodburySolver& W)
+	{
+	initialize(W);
+	}
+
+	void initialize()
+	{
+	N       = 0;
+	rank    = 0;
+	maxRank = 50;
+	compressionTol   = 1.0e-13;
+	refactorCount    = 0;
+
+	A0.initialize();
+	bandSolver.initialize();
+	U.initialize();
+	V.initialize();
+	Z.initialize();
+	C.initialize();
+	CIPIV.clear();
+	}
+
+	void initialize(const BandWoodburySolver& W)
+	{
+	N       = W.N;
+	rank    = W.rank;
+	maxRank = W.maxRank;
+	compressionTol   = W.compressionTol;
+	refactorCount    = W.refactorCount;
+
+	A0.initialize(W.A0);
+	bandSolver.initialize(W.bandSolver);
+	U.initialize(W.U);
+	V.initialize(W.V);
+	Z.initialize(W.Z);
+	C.initialize(W.C);
+	CIPIV = W.CIPIV;
+	}
+
+	//
+	// Sets the accumulated update rank above which the update is
+	// recompressed and, if necessary, added to the band matrix.
+	//
+	void setMaxRank(long maxRank)
+	{
+	this->maxRank = maxRank;
+	}
+
+	//
+	// Sets the relative singular value tolerance used to determine the
+	// numerical rank of a recompressed update.
+	//
+	void setCompressionTolerance(double tol)
+	{
+	compressionTol = tol;
+	}
+
+	long getRank() const
+	{
+	return rank;
+	}
+
+	// Number of band refactorizations performed since createFactors(...)
+
+	long getRefactorizationCount() const
+	{
+	return refactorCount;
+	}
+
+	const SCC::LapackBandMatrix& getBandMatrix() const
+	{
+	return A0;
+	}
+
+	//
+	// Creates the LU factors of A and clears any update.
+	//
+	void createFactors(const SCC::LapackBandMatrix& A)
+	{
+	N = A.N;
+	A0.initialize(A);
+	factorBand();
+	clearUpdate();
+	refactorCount = 0;
+	}
+
+	//
+	// Clears the accumulated update so that A = A0.
+	//
+	void clearUpdate()
+	{
+	rank = 0;
+	U.initialize();
+	V.initialize();
+	Z.initialize();
+	C.initialize();
+	CIPIV.clear();
+	}
+
+	//
+	// A <- A + u*v^T
+	//
+	void addLowRankUpdate(const std::vector<double>& u, const std::vector<double>& v)
+	{
+	LapackMatrix Unew(N,1,const_cast<double*>(&u[0]));
+	LapackMatrix Vnew(N,1,const_cast<double*>(&v[0]));
+	addLowRankUpdate(Unew,Vnew);
+	}
+
+	//
+	// A <- A + Unew*Vnew^T where Unew and Vnew are N x k matrices.
+	//
+	void addLowRankUpdate(const LapackMatrix& Unew, const LapackMatrix& Vnew)
+	{
+	if((Unew.rows != N)||(Vnew.rows != N)||(Unew.cols != Vnew.cols))
+	{
+		std::stringstream sout;
+		sout << "\nBandWoodburySolver Error \n";
+		sout << "Update matrices must both be " << N << " x k \n";
+		sout << "U : " << Unew.rows << " x " << Unew.cols << " V : " << Vnew.rows << " x " << Vnew.cols << "\n";
+		throw std::runtime_error(sout.str());
+	}
+
+	long k = Unew.cols;
+	if(k == 0) return;
+
+	appendColumns(U,Unew);
+	appendColumns(V,Vnew);
+
+	// Z = A0^{-1} U for the new columns
+
+	LapackMatrix Znew(Unew);
+	bandSolver.applyInverse(Znew.dataPtr,k);
+	appendColumns(Z,Znew);
+
+	rank += k;
+
+	if(rank > maxRank)
+	{
+	compressUpdate();
+
+	// The update may cancel completely, e.g. u*v^T followed by -u*v^T
+
+	if(rank == 0) return;
+
+	if(rank > maxRank)
+	{
+	foldUpdate();
+	return;
+	}
+	}
+
+	factorCapacitance();
+	}
+
+	void applyInverse(std::vector<double>& f)
+	{
+	applyInverse(&f[0],1);
+	}
+
+	void applyInverse(LapackMatrix& F)
+	{
+	applyInverse(F.dataPtr,F.cols);
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions.
+	//
+	void applyInverse(double* f, long NRHS = 1)
+	{
+	// Y = A0^{-1} F
+
+	bandSolver.applyInverse(f,NRHS);
+
+	// No capacitance correction when there is no update
+
+	if(rank == 0) return;
+
+	// T = C^{-1} V^T Y
+
+	LapackMatrix T(rank,NRHS);
+
+	char TRANSA  = 'T';
+	char TRANSB  = 'N';
+	double ALPHA = 1.0;
+	double BETA  = 0.0;
+	long LDF     = N;
+
+	dgemm_(&TRANSA,&TRANSB,&rank,&NRHS,&N,&ALPHA,V.dataPtr,&N,f,&LDF,&BETA,T.dataPtr,&rank);
+
+	char TRANS = 'N';
+	long INFO  = 0;
+
+	dgetrs_(&TRANS,&rank,&NRHS,C.dataPtr,&rank,&CIPIV[0],T.dataPtr,&rank,&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBandWoodburySolver (dgetrs) \nError INFO = " << INFO << "\n";
+		throw std::runtime_error(sout.str());
+	}
+
+	// X = Y - Z T
+
+	TRANSA = 'N';
+	ALPHA  = -1.0;
+	BETA   =  1.0;
+
+	dgemm_(&TRANSA,&TRANSB,&N,&NRHS,&rank,&ALPHA,Z.dataPtr,&N,T.dataPtr,&rank,&BETA,f,&LDF);
+	}
+
+//
+// Internal routines
+//
+
+	void factorBand()
+	{
+	bandSolver.initialize();
+	bandSolver.clearErrorEstimation();
+	bandSolver.createFactors(A0);
+	}
+
+	//
+	// Creates and factors C = I + V^T Z
+	//
+	void factorCapacitance()
+	{
+	C.initialize(rank,rank);
+	for(long i = 0; i < rank; i++) {C(i,i) = 1.0;}
+
+	char TRANSA  = 'T';
+	char TRANSB  = 'N';
+	double ALPHA = 1.0;
+	double BETA  = 1.0;
+
+	dgemm_(&TRANSA,&TRANSB,&rank,&rank,&N,&ALPHA,V.dataPtr,&N,Z.dataPtr,&N,&BETA,C.dataPtr,&rank);
+
+	CIPIV.resize(rank);
+	long INFO = 0;
+
+	dgetrf_(&rank,&rank,C.dataPtr,&rank,&CIPIV[0],&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBandWoodburySolver (dgetrf) \nError INFO = " << INFO << "\n";
+		if(INFO > 0) {sout << "Capacitance matrix is singular: the updated matrix is singular \n";}
+		throw std::runtime_error(sout.str());
+	}
+	}
+
+	void appendColumns(LapackMatrix& M, const LapackMatrix& Mnew) const
+	{
+	long cols = (M.isNull()) ? 0 : M.cols;
+
+	LapackMatrix R(N,cols + Mnew.cols);
+	if(cols > 0) {std::memcpy(R.dataPtr,M.dataPtr,N*cols*sizeof(double));}
+	std::memcpy(R.dataPtr + N*cols,Mnew.dataPtr,N*Mnew.cols*sizeof(double));
+
+	M.initialize(R);
+	}
+
+	//
+	// Replaces U*V^T by its truncated SVD. With U = Qu*Ru and V = Qv*Rv,
+	// U*V^T = Qu (Ru Rv^T) Qv^T, so only the SVD of the r x r matrix
+	// Ru*Rv^T is required.
+	//
+	void compressUpdate()
+	{
+	if(rank > N) return;
+
+	long r = rank;
+	LapackMatrix Qu(U);
+	LapackMatrix Qv(V);
+	LapackMatrix Ru(r,r);
+	LapackMatrix Rv(r,r);
+
+	orthogonalize(Qu,Ru);
+	orthogonalize(Qv,Rv);
+
+	// Core = Ru*Rv^T
+
+	LapackMatrix Core(r,r);
+
+	char TRANSA  = 'N';
+	char TRANSB  = 'T';
+	double ALPHA = 1.0;
+	double BETA  = 0.0;
+
+	dgemm_(&TRANSA,&TRANSB,&r,&r,&r,&ALPHA,Ru.dataPtr,&r,Rv.dataPtr,&r,&BETA,Core.dataPtr,&r);
+
+	// SVD of the core matrix
+
+	char JOBU  = 'A';
+	char JOBVT = 'A';
+	std::vector<double> S(r);
+	LapackMatrix P(r,r);
+	LapackMatrix QT(r,r);
+
+	long   INFO    = 0;
+	long   LWORK   = -1;
+	double WORKtmp = 0.0;
+
+	dgesvd_(&JOBU,&JOBVT,&r,&r,Core.dataPtr,&r,&S[0],P.dataPtr,&r,QT.dataPtr,&r,&WORKtmp,&LWORK,&INFO);
+
+	LWORK = (long)(WORKtmp + 100);
+	std::vector<double> WORK(LWORK);
+
+	dgesvd_(&JOBU,&JOBVT,&r,&r,Core.dataPtr,&r,&S[0],P.dataPtr,&r,QT.dataPtr,&r,&WORK[0],&LWORK,&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBandWoodburySolver (dgesvd) \nError INFO = " << INFO << "\n";
+		throw std::runtime_error(sout.str());
+	}
+
+	long k = 0;
+	while((k < r)&&(S[k] > compressionTol*S[0])) {k++;}
+
+	if(k == 0)
+	{
+	clearUpdate();
+	return;
+	}
+
+	// U = Qu*P(:,0:k-1)*diag(S), V = Qv*QT(0:k-1,:)^T
+
+	for(long j = 0; j < k; j++)
+	{
+	for(long i = 0; i < r; i++) {P(i,j) *= S[j];}
+	}
+
+	U.initialize(N,k);
+	V.initialize(N,k);
+
+	TRANSA = 'N';
+	TRANSB = 'N';
+	dgemm_(&TRANSA,&TRANSB,&N,&k,&r,&ALPHA,Qu.dataPtr,&N,P.dataPtr,&r,&BETA,U.dataPtr,&N);
+
+	TRANSB = 'T';
+	dgemm_(&TRANSA,&TRANSB,&N,&k,&r,&ALPHA,Qv.dataPtr,&N,QT.dataPtr,&r,&BETA,V.dataPtr,&N);
+
+	rank = k;
+
+	Z.initialize(U);
+	bandSolver.applyInverse(Z.dataPtr,rank);
+	}
+
+	//
+	// Overwrites the N x r matrix Q with the orthonormal factor of its
+	// QR factorization and returns the upper triangular factor in R.
+	//
+	void orthogonalize(LapackMatrix& Q, LapackMatrix& R) const
+	{
+	long M    = Q.rows;
+	long r    = Q.cols;
+	long INFO = 0;
+
+	std::vector<double> TAU(r);
+
+	long   LWORK   = -1;
+	double WORKtmp = 0.0;
+
+	dgeqrf_(&M,&r,Q.dataPtr,&M,&TAU[0],&WORKtmp,&LWORK,&INFO);
+
+	LWORK = (long)(WORKtmp + 100);
+	std::vector<double> WORK(LWORK);
+
+	dgeqrf_(&M,&r,Q.dataPtr,&M,&TAU[0],&WORK[0],&LWORK,&INFO);
+
+	R.setToValue(0.0);
+	for(long j = 0; j < r; j++)
+	{
+	for(long i = 0; i <= j; i++) {R(i,j) = Q(i,j);}
+	}
+
+	dorgqr_(&M,&r,&r,Q.dataPtr,&M,&TAU[0],&WORK[0],&LWORK,&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBandWoodburySolver (dgeqrf/dorgqr) \nError INFO = " << INFO << "\n";
+		throw std::runtime_error(sout.str());
+	}
+	}
+
+	//
+	// Adds U*V^T to A0, widening the band if required, and refactors A0.
+	//
+	void foldUpdate()
+	{
+	// Index ranges of the non-zero rows of U and V
+
+	long uMin; long uMax;
+	long vMin; long vMax;
+
+	nonZeroRowRange(U,uMin,uMax);
+	nonZeroRowRange(V,vMin,vMax);
+
+	if((uMax >= 0)&&(vMax >= 0))
+	{
+	long kl = std::max(A0.kl, uMax - vMin);
+	long ku = std::max(A0.ku, vMax - uMin);
+
+	if((kl != A0.kl)||(ku != A0.ku))
+	{
+	SCC::LapackBandMatrix Aw(kl,ku,N);
+	for(long j = 0; j < N; j++)
+	{
+	for(long i = std::max((long)0,j-A0.ku); i <= std::min(N-1,j+A0.kl); i++)
+	{
+		Aw(i,j) = A0(i,j);
+	}}
+	A0.initialize(Aw);
+	}
+
+	double sum;
+	for(long j = vMin; j <= vMax; j++)
+	{
+	for(long i = uMin; i <= uMax; i++)
+	{
+		sum = 0.0;
+		for(long p = 0; p < rank; p++) {sum += U(i,p)*V(j,p);}
+		A0(i,j) += sum;
+	}}
+	}
+
+	factorBand();
+	clearUpdate();
+	refactorCount++;
+	}
+
+	void nonZeroRowRange(const LapackMatrix& M, long& iMin, long& iMax) const
+	{
+	iMin = -1;
+	iMax = -1;
+	for(long i = 0; i < M.rows; i++)
+	{
+	for(long j = 0; j < M.cols; j++)
+	{
+		if(M(i,j) != 0.0)
+		{
+		if(iMin < 0) {iMin = i;}
+		iMax = i;
+		break;
+		}
+	}}
+	}
+
+	long       N;
+	long    rank;
+	long maxRank;
+	double compressionTol;
+	long refactorCount;
+
+	SCC::LapackBandMatrix   A0;   // Band matrix whose factors are cached
+	SCC::DGBSVX     bandSolver;
+
+	SCC::LapackMatrix        U;   // N x rank
+	SCC::LapackMatrix        V;   // N x rank
+	SCC::LapackMatrix        Z;   // A0^{-1} U
+	SCC::LapackMatrix        C;   // LU factors of I + V^T Z
+	std::vector<long>    CIPIV;
 };
 
 }
@@ -690,6 +1568,165 @@ Parameters
                            computed solution can be more accurate than the
                            value of RCOND would suggest.
 
+Author
+    Univ. of Tennessee
+    Univ. of California Berkeley
+    Univ. of Colorado Denver
+    NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DGBTRF
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dgbtrf 	( 	integer  	m,
+		integer  	n,
+		integer  	kl,
+		integer  	ku,
+		double precision, dimension( ldab, * )  	ab,
+		integer  	ldab,
+		integer, dimension( * )  	ipiv,
+		integer  	info
+	)
+
+Purpose:
+
+     DGBTRF computes an LU factorization of a real m-by-n band matrix A
+     using partial pivoting with row interchanges.
+
+Parameters
+    [in,out]	AB
+
+              AB is DOUBLE PRECISION array, dimension (LDAB,N)
+              On entry, the matrix A in band storage, in rows KL+1 to
+              2*KL+KU+1; rows 1 to KL of the array need not be set.
+              The j-th column of A is stored in the j-th column of the
+              array AB as follows:
+              AB(kl+ku+1+i-j,j) = A(i,j) for max(1,j-ku)<=i<=min(m,j+kl)
+
+              On exit, details of the factorization: U is stored as an
+              upper triangular band matrix with KL+KU superdiagonals in
+              rows 1 to KL+KU+1, and the multipliers used during the
+              factorization are stored in rows KL+KU+2 to 2*KL+KU+1.
+
+    [in]	LDAB
+
+              LDAB is INTEGER
+              The leading dimension of the array AB.  LDAB >= 2*KL+KU+1.
+
+    [out]	IPIV
+
+              IPIV is INTEGER array, dimension (min(M,N))
+              The pivot indices; for 1 <= i <= min(M,N), row i of the
+              matrix was interchanged with row IPIV(i).
+
+    [out]	INFO
+
+              INFO is INTEGER
+              = 0: successful exit
+              < 0: if INFO = -i, the i-th argument had an illegal value
+              > 0: if INFO = +i, U(i,i) is exactly zero. The factorization
+                   has been completed, but the factor U is exactly
+                   singular, and division by zero will occur if it is used
+                   to solve a system of equations.
+
+Author
+    Univ. of Tennessee
+    Univ. of California Berkeley
+    Univ. of Colorado Denver
+    NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DGBTRS
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dgbtrs 	( 	character  	trans,
+		integer  	n,
+		integer  	kl,
+		integer  	ku,
+		integer  	nrhs,
+		double precision, dimension( ldab, * )  	ab,
+		integer  	ldab,
+		integer, dimension( * )  	ipiv,
+		double precision, dimension( ldb, * )  	b,
+		integer  	ldb,
+		integer  	info
+	)
+
+Purpose:
+
+     DGBTRS solves a system of linear equations
+        A * X = B  or  A**T * X = B
+     with a general band matrix A using the LU factorization computed
+     by DGBTRF.
+
+Parameters
+    [in]	AB
+
+              AB is DOUBLE PRECISION array, dimension (LDAB,N)
+              Details of the LU factorization of the band matrix A, as
+              computed by DGBTRF.
+
+    [in,out]	B
+
+              B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+              On entry, the right hand side matrix B.
+              On exit, the solution matrix X.
+
+    [out]	INFO
+
+              INFO is INTEGER
+              = 0:  successful exit
+              < 0: if INFO = -i, the i-th argument had an illegal value
+
+Author
+    Univ. of Tennessee
+    Univ. of California Berkeley
+    Univ. of Colorado Denver
+    NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DGBCON
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dgbcon 	( 	character  	norm,
+		integer  	n,
+		integer  	kl,
+		integer  	ku,
+		double precision, dimension( ldab, * )  	ab,
+		integer  	ldab,
+		integer, dimension( * )  	ipiv,
+		double precision  	anorm,
+		double precision  	rcond,
+		double precision, dimension( * )  	work,
+		integer, dimension( * )  	iwork,
+		integer  	info
+	)
+
+Purpose:
+
+     DGBCON estimates the reciprocal of the condition number of a real
+     general band matrix A, in either the 1-norm or the infinity-norm,
+     using the LU factorization computed by DGBTRF.
+
+     An estimate is obtained for norm(inv(A)), and the reciprocal of the
+     condition number is computed as
+        RCOND = 1 / ( norm(A) * norm(inv(A)) ).
+
+Parameters
+    [in]	ANORM
+
+              ANORM is DOUBLE PRECISION
+              If NORM = '1' or 'O', the 1-norm of the original matrix A.
+              If NORM = 'I', the infinity-norm of the original matrix A.
+
+    [out]	WORK
+
+              WORK is DOUBLE PRECISION array, dimension (3*N)
+
+    [out]	IWORK
+
+              IWORK is INTEGER array, dimension (N)
+
 Author
     Univ. of Tennessee
     Univ. of California Berkeley
@@ -3,6 +3,8 @@
  *
  *  Created on: Dec. 3, 2023
  *      Author: anderson
+ *
+ *  Updated: Oct. 18, 2026 (C.R. Anderson)
  */
 //
 // SCC::LapackBandMatrixRoutinesCmplx16
@@ -33,7 +35,8 @@
 // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Class ZGBSVX : Created for solving A*X = B using LU factorization
-//                when A is a complex band matrix.
+//                when A is a complex band matrix. ZGBSVX is
+//                GBSVX<std::complex<double>> (SCC_LapackBandRoutines.h).
 // LAPACK base routine description:
 // ZGBSVX uses the LU factorization to compute the solution to a complex
 // system of linear equations A * X = B, A**T * X = B, or A**H * X = B,
@@ -42,6 +45,21 @@
 //
 // Error bounds on the solution and a condition estimate are also
 // provided.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class ZPBSV : Created for solving A*X = B using the Cholesky
+//               factorization when A is a complex Hermitian positive
+//               definite band matrix.
+// LAPACK base routine description:
+// ZPBTRF computes the Cholesky factorization of a complex Hermitian
+// positive definite band matrix A.
+//
+// ZPBTRS solves a system of linear equations A*X = B with a Hermitian
+// positive definite band matrix A using the Cholesky factorization
+// A = U**H*U or A = L*L**H computed by ZPBTRF.
+//
+// ZPBCON estimates the reciprocal of the condition number (in the
+// 1-norm) of a complex Hermitian positive definite band matrix using
+// the Cholesky factorization computed by ZPBTRF.
 /*
 #############################################################################
 #
@@ -66,9 +84,14 @@
 #include <vector>
 #include <iostream>
 #include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
 
 #include "SCC_LapackHeaders.h"
 #include "SCC_LapackBandMatrixCmplx16.h"
+#include "SCC_LapackBandRoutines.h"
+#include "SCC_LapackSymBandRoutines.h"
 
 #ifndef SCC_LAPACK_BAND_ROUTINES_CMPLX_16_
 #define SCC_LAPACK_BAND_ROUTINES_CMPLX_16_
@@ -81,188 +104,22 @@ namespace SCC
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 // Class ZGBSVX : Created for solving A*X = B using LU factorization
 //                when A is a complex band matrix.
-// LAPACK base routine description:
-// ZGBSVX uses the LU factorization to compute the solution to a complex
-// system of linear equations A * X = B, A**T * X = B, or A**H * X = B,
-// where A is a band matrix of order N with KL subdiagonals and KU
-// superdiagonals, and X and B are N-by-NRHS matrices.
 //
-// Error bounds on the solution and a condition estimate are also
-// provided.
+// ZGBSVX is the instance GBSVX<std::complex<double>> of the band
+// solver class template defined in SCC_LapackBandRoutines.h.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-class ZGBSVX
-{
-public:
-
-	ZGBSVX()
-	{
-		initialize();
-	}
-
-	void initialize()
-	{
-    RCOND = 0.0;
-	FERR.clear();
-	BERR.clear();
-
-	A.initialize();
-	AF.initialize();
-	}
-
-    void applyInverse(const LapackBandMatrixCmplx16& A,std::vector <std::complex<double>>& b)
-	{
-    	    assert(A.sizeCheck(A.N,(long)b.size()));
-	        double* bptr =  &(reinterpret_cast<double(&)[2]>(b[0])[0]);
-			applyInverse(A,bptr);
-	}
-
-    void applyInverse(const LapackBandMatrixCmplx16& A,LapackMatrixCmplx16& b)
-	{
-    	    assert(A.sizeCheck(A.N,b.rows));
-    		applyInverse(A,b.mData.dataPtr,b.cols);
-	}
-
-	void applyInverse(const LapackBandMatrixCmplx16& S, double* b, long NRHS = 1)
-	{
-		//assert(A.sizeCheck(A.rows,A.cols));
-
-		char FACT  = 'E'; // Equilibrate, then factor
-		char TRANS = 'N'; // No transpose
-
-		long N     = S.N;
-		long KL    = S.kl;
-		long KU    = S.ku;
-
-		//
-		// Duplicate input matrix (since this zgbsvx overwrites input matrix)
-		// and allocate temporaries
-        //
-
-		long LDAB  = KL + KU + 1;
-		long LDAF  = 2*KL + KU + 1;
-
-		this->A.initialize(S);
-		this->AF.initialize(LDAF,N);
-
-		double* Aptr  =  A.cmplxMdata.mData.dataPtr;
-		double* AFptr =  AF.mData.dataPtr;
-
-		std::vector <long >   IPIV(N);
-		long* IPIVptr      = &IPIV[0];
-
-		char  EQED;
-
-		std::vector<double>   R(N);
-		double* Rptr  = &R[0];
-
-		std::vector<double>    C(N);
-		double* Cptr  =  &C[0];
-
-		std::vector<double>   B(2*N*NRHS);
-		double* Bptr  =       &B[0];
-	    long LDB      =          N;
-
-
-		// b will be overwritten with the solution
-	    // so no need to declare X separately
+typedef GBSVX< std::complex<double> > ZGBSVX;
 
-		double* Xptr   = b;
-		long LDX       = N;
-
-		FERR.resize(NRHS);
-		BERR.resize(NRHS);
-
-		std::vector<double>   WORK(4*N);
-		double* WORKptr     = &WORK[0];
-
-		std::vector<double>  RWORK(2*N);
-		double* RWORKptr   = &RWORK[0];
-
-		long   INFO = 0;
-
-		// Assign right hand side to B
-
-		for(long i = 0; i < 2*N*NRHS; i++)
-		{
-			Bptr[i] = b[i];
-		}
-
-
-		zgbsvx_(&FACT, &TRANS, &N, &KL, &KU, &NRHS, Aptr, &LDAB, AFptr, &LDAF, IPIVptr,
-		        &EQED, Rptr, Cptr, Bptr,&LDB, Xptr, &LDX, &RCOND,
-				&FERR[0], &BERR[0], WORKptr,RWORKptr, &INFO);
-
-
-		if(INFO != 0)
-        {
-        std::cerr << "dgesvx  Failed : INFO = " << INFO  << std::endl;
-        exit(1);
-        }
-	}
-
-/*
-*  RCOND is DOUBLE PRECISION
-*  The estimate of the reciprocal condition number of the matrix
-*  A after equilibration (if done).  If RCOND is less than the
-*  machine precision (in particular, if RCOND = 0), the matrix
-*  is singular to working precision.  This condition is
-*  indicated by a return code of INFO > 0.
-*/
-
-	double getReciprocalConditionNumber()
-	{
-		return RCOND;
-	}
-
-/*
-    FERR is DOUBLE PRECISION array, dimension (NRHS)
-    The estimated forward error bound for each solution vector
-    X(j) (the j-th column of the solution matrix X).
-    If XTRUE is the true solution corresponding to X(j), FERR(j)
-    is an estimated upper bound for the magnitude of the largest
-    element in (X(j) - XTRUE) divided by the magnitude of the
-    largest element in X(j).  The estimate is as reliable as
-    the estimate for RCOND, and is almost always a slight
-    overestimate of the true error.
-*/
-
-	double getSolutionErrorEst()
-	{
-		return FERR[0];
-	}
-
-	std::vector<double> getMultipleSolutionErrorEst()
-	{
-		return FERR;
-	}
-
-/*
-	BERR is DOUBLE PRECISION array, dimension (NRHS)
-	The componentwise relative backward error of each solution
-	vector X(j) (i.e., the smallest relative change in
-	any element of A or B that makes X(j) an exact solution).
-*/
-	double getSolutionBackwardErrorEst()
-	{
-		return BERR[0];
-	}
-
-	std::vector<double> getMultipleSolutionBackwardErrorEst()
-	{
-		return BERR;
-	}
-
-
-
-    double          RCOND;
-	std::vector<double>    FERR;
-	std::vector<double>    BERR;
-
-	LapackBandMatrixCmplx16    A;
-	LapackMatrixCmplx16       AF;
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class ZPBSV : Created for solving A*X = B using the Cholesky factorization
+//               when A is a complex Hermitian positive definite band matrix.
+//
+// ZPBSV is the instance PBSV<std::complex<double>> of the cached band
+// Cholesky class template defined in SCC_LapackSymBandRoutines.h.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-};
+typedef PBSV< std::complex<double> > ZPBSV;
 
 
 } // SCC namespace
@@ -591,4 +448,13 @@ Author
     NAG Ltd.
 */
 
+//
+// The LAPACK documentation for ZPBTRF, ZPBTRS and ZPBCON is that of
+// DPBTRF, DPBTRS and DPBCON contained in SCC_LapackSymBandRoutines.h
+// with COMPLEX*16 replacing DOUBLE PRECISION, a Hermitian matrix
+// replacing a symmetric matrix, and U**H replacing U**T. The ZPBCON
+// work arrays are WORK, COMPLEX*16 of dimension 2*N, and RWORK,
+// DOUBLE PRECISION of dimension N.
+//
+
 #endif /* SCC_LapackBandRoutines__ */
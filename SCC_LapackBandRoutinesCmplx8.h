@@ -0,0 +1,93 @@
+/*
+ * SCC_LapackBandRoutinesCmplx8.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Single precision versions of the complex band matrix routine classes.
+// The classes are used with instances of LapackBandMatrixCmplx8 and
+// LapackMatrixCmplx8 and have the interface of the corresponding
+// COMPLEX*16 classes, with float replacing double.
+//
+// Data mapping being used for direct invocation of
+// Fortran routines
+//
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  float  ==  Fortran REAL
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class CGBSV : Created for solving A*X = B using cached LU factors
+//               when A is a complex band matrix (CGBTRF/CGBTRS/CGBCON).
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class CGBSVX : Created for solving A*X = B using LU factorization
+//                when A is a complex band matrix (single precision
+//                version of ZGBSVX).
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class CPBSV : Created for solving A*X = B using the Cholesky
+//               factorization when A is a complex Hermitian positive
+//               definite band matrix (single precision version of ZPBSV).
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include "SCC_LapackMatrixCmplx8.h"
+#include "SCC_LapackBandMatrixCmplx8.h"
+#include "SCC_LapackBandRoutines.h"
+#include "SCC_LapackSymBandRoutines.h"
+
+#ifndef SCC_LAPACK_BAND_ROUTINES_CMPLX_8_
+#define SCC_LAPACK_BAND_ROUTINES_CMPLX_8_
+
+namespace SCC
+{
+
+// CGBSV, CGBSVX and CPBSV are the COMPLEX instances of the class templates
+// GBSV<T> and GBSVX<T> defined in SCC_LapackBandRoutines.h and PBSV<T>
+// defined in SCC_LapackSymBandRoutines.h.
+
+typedef GBSV< std::complex<float> >  CGBSV;
+typedef GBSVX< std::complex<float> > CGBSVX;
+typedef PBSV< std::complex<float> >  CPBSV;
+
+} // Namespace SCC
+
+//
+// The LAPACK documentation for CGBTRF, CGBTRS, CGBCON, CGBSVX, CPBTRF,
+// CPBTRS and CPBCON is that of the corresponding Z prefixed routines,
+// contained in SCC_LapackBandRoutinesCmplx16.h and at
+// https://netlib.org/lapack/explore-html, with COMPLEX replacing COMPLEX*16.
+//
+
+#endif /* SCC_LAPACK_BAND_ROUTINES_CMPLX_8_ */
@@ -0,0 +1,84 @@
+/*
+ * SCC_LapackBandRoutinesFloat.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Single precision versions of the band matrix routine classes.
+//
+// Data mapping being used for direct invocation of
+// Fortran routines
+//
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  float  ==  Fortran REAL
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SGBSV : Created for solving A*X = B using LU factorization
+//               when A is a single precision band matrix.
+// LAPACK base routines description:
+// SGBTRF computes an LU factorization of a real m-by-n band matrix A
+// using partial pivoting with row interchanges.
+// SGBTRS solves a system of linear equations
+//     A * X = B  or  A**T * X = B
+// with a general band matrix A using the LU factorization computed
+// by SGBTRF.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include "SCC_LapackMatrixFloat.h"
+#include "SCC_LapackBandMatrixFloat.h"
+#include "SCC_LapackBandRoutines.h"
+
+#ifndef SCC_LAPACK_BAND_ROUTINES_FLOAT_
+#define SCC_LAPACK_BAND_ROUTINES_FLOAT_
+
+namespace SCC
+{
+
+// SGBSV is the single precision instance of the class template GBSV<T>
+// defined in SCC_LapackBandRoutines.h.
+
+typedef GBSV<float> SGBSV;
+
+} // Namespace SCC
+
+//
+// The LAPACK documentation for SGBTRF, SGBTRS and SGBCON is that of
+// DGBTRF, DGBTRS and DGBCON contained in SCC_LapackBandRoutines.h
+// with REAL replacing DOUBLE PRECISION.
+//
+
+#endif /* SCC_LAPACK_BAND_ROUTINES_FLOAT_ */
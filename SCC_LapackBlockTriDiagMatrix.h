@@ -0,0 +1,315 @@
+/*
+ * SCC_LapackBlockTriDiagMatrix.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Instances of this class are N x N block tridiagonal matrices whose
+// non-zero blocks are dense SCC::LapackMatrix instances.
+//
+// The matrix consists of blockCount block rows, where block row k has
+// blockSize[k] rows, and contains the blocks
+//
+// Lower[k-1] : block (k,k-1) of size blockSize[k] x blockSize[k-1] (k >= 1)
+// Diag[k]    : block (k,k)   of size blockSize[k] x blockSize[k]
+// Upper[k]   : block (k,k+1) of size blockSize[k] x blockSize[k+1] (k < blockCount-1)
+//
+// The blocks are accessed with getLowerBlock(k), getDiagonalBlock(k)
+// and getUpperBlock(k), where k is the index of the block row. Vectors
+// are indexed by the global unknown index, the unknowns of block row k
+// being those with indices blockOffset[k] through blockOffset[k] + blockSize[k] - 1.
+//
+// The indexing of blocks starts at 0, consistent with the indexing of
+// the other LapackInterface matrix classes.
+//
+// Lapack routine dependencies : dgemm_
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "SCC_LapackHeaders.h"
+#include "SCC_LapackMatrix.h"
+
+#ifndef SCC_LAPACK_BLOCK_TRI_DIAG_MATRIX_
+#define SCC_LAPACK_BLOCK_TRI_DIAG_MATRIX_
+
+namespace SCC
+{
+class LapackBlockTriDiagMatrix
+{
+	public:
+
+	LapackBlockTriDiagMatrix()
+	{
+	initialize();
+	}
+
+	LapackBlockTriDiagMatrix(const LapackBlockTriDiagMatrix& A)
+	{
+	initialize(A);
+	}
+
+	LapackBlockTriDiagMatrix(long blockCount, long blockSize)
+	{
+	initialize(blockCount,blockSize);
+	}
+
+	LapackBlockTriDiagMatrix(const std::vector<long>& blockSizes)
+	{
+	initialize(blockSizes);
+	}
+
+	void initialize()
+	{
+	N = 0;
+	blockSize.clear();
+	blockOffset.clear();
+	Lower.clear();
+	Diag.clear();
+	Upper.clear();
+	}
+
+	void initialize(const LapackBlockTriDiagMatrix& A)
+	{
+	N           = A.N;
+	blockSize   = A.blockSize;
+	blockOffset = A.blockOffset;
+
+	Diag.resize(A.Diag.size());
+	Lower.resize(A.Lower.size());
+	Upper.resize(A.Upper.size());
+
+	for(size_t k = 0; k < Diag.size();  k++) {Diag[k].initialize(A.Diag[k]);}
+	for(size_t k = 0; k < Lower.size(); k++) {Lower[k].initialize(A.Lower[k]); Upper[k].initialize(A.Upper[k]);}
+	}
+
+	void initialize(long blockCount, long blockSize)
+	{
+	initialize(std::vector<long>(blockCount,blockSize));
+	}
+
+	//
+	// Allocates the blocks, with all entries set to zero, for a matrix
+	// whose k'th block row has blockSizes[k] rows.
+	//
+	void initialize(const std::vector<long>& blockSizes)
+	{
+	long blockCount = (long)blockSizes.size();
+
+	blockSize = blockSizes;
+	blockOffset.resize(blockCount+1);
+
+	blockOffset[0] = 0;
+	for(long k = 0; k < blockCount; k++) {blockOffset[k+1] = blockOffset[k] + blockSize[k];}
+	N = blockOffset[blockCount];
+
+	Diag.resize(blockCount);
+	Lower.resize(std::max(blockCount-1,(long)0));
+	Upper.resize(std::max(blockCount-1,(long)0));
+
+	for(long k = 0; k < blockCount; k++)
+	{
+	Diag[k].initialize(blockSize[k],blockSize[k]);
+	}
+
+	for(long k = 0; k < blockCount-1; k++)
+	{
+	Lower[k].initialize(blockSize[k+1],blockSize[k]);
+	Upper[k].initialize(blockSize[k],blockSize[k+1]);
+	}
+	}
+
+	// Block (k,k-1), k >= 1
+
+	LapackMatrix& getLowerBlock(long k)
+	{
+	assert(blockBoundsCheck(k,1,getBlockCount()-1));
+	return Lower[k-1];
+	}
+
+	const LapackMatrix& getLowerBlock(long k) const
+	{
+	assert(blockBoundsCheck(k,1,getBlockCount()-1));
+	return Lower[k-1];
+	}
+
+	// Block (k,k)
+
+	LapackMatrix& getDiagonalBlock(long k)
+	{
+	assert(blockBoundsCheck(k,0,getBlockCount()-1));
+	return Diag[k];
+	}
+
+	const LapackMatrix& getDiagonalBlock(long k) const
+	{
+	assert(blockBoundsCheck(k,0,getBlockCount()-1));
+	return Diag[k];
+	}
+
+	// Block (k,k+1), k < blockCount-1
+
+	LapackMatrix& getUpperBlock(long k)
+	{
+	assert(blockBoundsCheck(k,0,getBlockCount()-2));
+	return Upper[k];
+	}
+
+	const LapackMatrix& getUpperBlock(long k) const
+	{
+	assert(blockBoundsCheck(k,0,getBlockCount()-2));
+	return Upper[k];
+	}
+
+	long getDimension() const
+	{return N;}
+
+	long getBlockCount() const
+	{return (long)blockSize.size();}
+
+	long getBlockSize(long k) const
+	{return blockSize[k];}
+
+	long getBlockOffset(long k) const
+	{return blockOffset[k];}
+
+    void setToValue(double val)
+    {
+    for(size_t k = 0; k < Diag.size();  k++) {Diag[k].setToValue(val);}
+    for(size_t k = 0; k < Lower.size(); k++) {Lower[k].setToValue(val); Upper[k].setToValue(val);}
+    }
+
+    //
+    // Y = alpha*A*X + beta*Y where X and Y are N x m matrices.
+    //
+    // If beta = 0 then Y need not be initialized.
+    //
+    void apply(const LapackMatrix& X, LapackMatrix& Y, double alpha = 1.0, double beta = 0.0) const
+    {
+    assert(sizeCheck(X.rows,N));
+    assert(sizeCheck(Y.rows,N));
+    assert(sizeCheck(X.cols,Y.cols));
+
+    long blockCount = getBlockCount();
+
+    char TRANSA = 'N';
+    char TRANSB = 'N';
+    long   M;
+    long   K;
+    long   NRHS = X.cols;
+    long   LDX  = N;
+    long   LDY  = N;
+    double BETA;
+
+    for(long k = 0; k < blockCount; k++)
+    {
+    M    = blockSize[k];
+    BETA = beta;
+
+    K = blockSize[k];
+    dgemm_(&TRANSA,&TRANSB,&M,&NRHS,&K,&alpha,Diag[k].dataPtr,&M,
+    X.dataPtr + blockOffset[k],&LDX,&BETA,Y.dataPtr + blockOffset[k],&LDY);
+
+    BETA = 1.0;
+
+    if(k > 0)
+    {
+    K = blockSize[k-1];
+    dgemm_(&TRANSA,&TRANSB,&M,&NRHS,&K,&alpha,Lower[k-1].dataPtr,&M,
+    X.dataPtr + blockOffset[k-1],&LDX,&BETA,Y.dataPtr + blockOffset[k],&LDY);
+    }
+
+    if(k < blockCount-1)
+    {
+    K = blockSize[k+1];
+    dgemm_(&TRANSA,&TRANSB,&M,&NRHS,&K,&alpha,Upper[k].dataPtr,&M,
+    X.dataPtr + blockOffset[k+1],&LDX,&BETA,Y.dataPtr + blockOffset[k],&LDY);
+    }
+    }
+    }
+
+    LapackMatrix operator*(const LapackMatrix& X) const
+    {
+    LapackMatrix Y(N,X.cols);
+    apply(X,Y);
+    return Y;
+    }
+
+    std::vector<double> operator*(const std::vector<double>& x) const
+    {
+    std::vector<double> y(N,0.0);
+    LapackMatrix X(N,1,const_cast<double*>(&x[0]));
+    LapackMatrix Y(N,1,&y[0]);
+    apply(X,Y);
+    return y;
+    }
+
+#ifdef _DEBUG
+    bool blockBoundsCheck(long k, long kMin, long kMax) const
+    {
+    if((k < kMin)||(k > kMax))
+    {
+    std::cerr << "LapackBlockTriDiagMatrix block index out of bounds " << std::endl;
+    std::cerr << "Offending index value : " << k << " Acceptable Range [" << kMin << "," << kMax << "] " << std::endl;
+    return false;
+    }
+    return true;
+    }
+
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "LapackBlockTriDiagMatrix sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool blockBoundsCheck(long, long, long) const {return true;}
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+    long N;
+
+    std::vector<long>   blockSize;
+    std::vector<long> blockOffset;
+
+    std::vector<SCC::LapackMatrix> Lower;
+    std::vector<SCC::LapackMatrix>  Diag;
+    std::vector<SCC::LapackMatrix> Upper;
+};
+
+} // Namespace SCC
+
+#endif /* SCC_LAPACK_BLOCK_TRI_DIAG_MATRIX_ */
@@ -0,0 +1,430 @@
+/*
+ * SCC_LapackBlockTriDiagRoutines.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// SCC::LapackBlockTriDiagRoutines
+//
+// A collection of utility classes whose functionality is
+// based upon LAPACK routines. These routines are meant
+// to be used with instances of LapackBlockTriDiagMatrix. The documentation
+// for the each of the base LAPACK routines is contained at the
+// end of this file or can be found at
+//
+// https://netlib.org/lapack/explore-html
+//
+// Data mapping being used for direct invocation of
+// Fortran routines
+//
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  double ==  Fortran DOUBLE PRECISION
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class BlockTriDiagSolver : Created for solving A*X = B when A is a
+//                            block tridiagonal matrix with dense blocks
+//                            using a block LU factorization.
+// LAPACK base routine description:
+// DGETRF computes an LU factorization of a general M-by-N matrix A
+// using partial pivoting with row interchanges.
+//
+// DGETRS solves a system of linear equations
+//    A * X = B  or  A**T * X = B
+// with a general N-by-N matrix A using the LU factorization computed
+// by DGETRF.
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "SCC_LapackHeaders.h"
+#include "SCC_LapackMatrix.h"
+#include "SCC_LapackBlockTriDiagMatrix.h"
+
+#ifndef SCC_LAPACK_BLOCK_TRI_DIAG_ROUTINES_
+#define SCC_LAPACK_BLOCK_TRI_DIAG_ROUTINES_
+
+namespace SCC
+{
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class BlockTriDiagSolver
+//
+// Block LU (block Thomas) factorization of a block tridiagonal matrix
+// with block rows k = 0, ..., n-1
+//
+//  S_0 = D_0
+//  W_k = S_k^{-1} U_k                   k = 0, ..., n-2
+//  S_k = D_k - L_k W_{k-1}              k = 1, ..., n-1
+//
+// where D_k, L_k and U_k are the diagonal, lower and upper blocks of
+// block row k. Each S_k is factored with DGETRF, W_k is obtained with
+// DGETRS, and the Schur complement updates are computed with DGEMM.
+//
+// The solution of A*X = B is then obtained by the forward and
+// backward substitutions
+//
+//  Y_0 = S_0^{-1} B_0,  Y_k = S_k^{-1} (B_k - L_k Y_{k-1})
+//  X_{n-1} = Y_{n-1},   X_k = Y_k - W_k X_{k+1}
+//
+// The factors are cached so that, once created, any number of
+// solves with any number of right hand sides can be performed.
+//
+// Pivoting is only performed within the diagonal blocks, so the
+// factorization is stable for block diagonally dominant matrices, but
+// may fail (a singular S_k) for general non-singular matrices.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class BlockTriDiagSolver
+{
+public:
+
+	BlockTriDiagSolver()
+	{
+	initialize();
+	}
+
+	BlockTriDiagSolver(const BlockTriDiagSolver& B)
+	{
+	initialize(B);
+	}
+
+	void initialize()
+	{
+	N = 0;
+	blockSize.clear();
+	blockOffset.clear();
+	L.clear();
+	S.clear();
+	W.clear();
+	IPIV.clear();
+	}
+
+	void initialize(const BlockTriDiagSolver& B)
+	{
+	N           = B.N;
+	blockSize   = B.blockSize;
+	blockOffset = B.blockOffset;
+	IPIV        = B.IPIV;
+
+	L.resize(B.L.size());
+	S.resize(B.S.size());
+	W.resize(B.W.size());
+
+	for(size_t k = 0; k < S.size(); k++) {S[k].initialize(B.S[k]);}
+	for(size_t k = 0; k < L.size(); k++) {L[k].initialize(B.L[k]); W[k].initialize(B.W[k]);}
+	}
+
+	void applyInverse(const LapackBlockTriDiagMatrix& A, std::vector<double>& f)
+	{
+	createFactors(A);
+	applyInverse(&f[0]);
+	}
+
+	void applyInverse(const LapackBlockTriDiagMatrix& A, LapackMatrix& F)
+	{
+	createFactors(A);
+	applyInverse(F);
+	}
+
+	void applyInverse(std::vector<double>& f)
+	{
+	assert(sizeCheck((long)f.size(),1));
+	applyInverse(&f[0]);
+	}
+
+	void applyInverse(LapackMatrix& F)
+	{
+	assert(sizeCheck(F.rows,F.cols));
+	applyInverse(F.dataPtr,F.cols);
+	}
+
+	void createFactors(const LapackBlockTriDiagMatrix& A)
+	{
+	long blockCount = A.getBlockCount();
+
+	N           = A.N;
+	blockSize   = A.blockSize;
+	blockOffset = A.blockOffset;
+
+	S.resize(blockCount);
+	IPIV.resize(blockCount);
+	L.resize(std::max(blockCount-1,(long)0));
+	W.resize(std::max(blockCount-1,(long)0));
+
+	char TRANS  = 'N';
+	char TRANSA = 'N';
+	char TRANSB = 'N';
+	double ALPHA = -1.0;
+	double BETA  =  1.0;
+
+	long M; long K; long NRHS;
+	long INFO = 0;
+
+	for(long k = 0; k < blockCount; k++)
+	{
+	M = blockSize[k];
+	S[k].initialize(A.Diag[k]);
+
+	// Schur complement update S_k = D_k - L_k W_{k-1}
+
+	if(k > 0)
+	{
+	L[k-1].initialize(A.Lower[k-1]);
+	K = blockSize[k-1];
+	dgemm_(&TRANSA,&TRANSB,&M,&M,&K,&ALPHA,L[k-1].dataPtr,&M,W[k-1].dataPtr,&K,&BETA,S[k].dataPtr,&M);
+	}
+
+	IPIV[k].resize(M);
+
+	dgetrf_(&M,&M,S[k].dataPtr,&M,&IPIV[k][0],&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBlockTriDiagSolver (dgetrf) \nError INFO = " << INFO << "\n";
+		if(INFO > 0) {sout << "Singular pivot block encountered in block row " << k << "\n";}
+		throw std::runtime_error(sout.str());
+	}
+
+	// W_k = S_k^{-1} U_k
+
+	if(k < blockCount-1)
+	{
+	W[k].initialize(A.Upper[k]);
+	NRHS = blockSize[k+1];
+
+	dgetrs_(&TRANS,&M,&NRHS,S[k].dataPtr,&M,&IPIV[k][0],W[k].dataPtr,&M,&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBlockTriDiagSolver (dgetrs) \nError INFO = " << INFO << "\n";
+		throw std::runtime_error(sout.str());
+	}
+	}
+	}
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions.
+	//
+	void applyInverse(double* f, long NRHS = 1)
+	{
+	long blockCount = (long)blockSize.size();
+
+	char TRANS  = 'N';
+	char TRANSA = 'N';
+	char TRANSB = 'N';
+	double ALPHA = -1.0;
+	double BETA  =  1.0;
+
+	long LDB  = N;
+	long M; long K;
+	long INFO = 0;
+
+	// Forward substitution
+
+	for(long k = 0; k < blockCount; k++)
+	{
+	M = blockSize[k];
+
+	if(k > 0)
+	{
+	K = blockSize[k-1];
+	dgemm_(&TRANSA,&TRANSB,&M,&NRHS,&K,&ALPHA,L[k-1].dataPtr,&M,
+	f + blockOffset[k-1],&LDB,&BETA,f + blockOffset[k],&LDB);
+	}
+
+	dgetrs_(&TRANS,&M,&NRHS,S[k].dataPtr,&M,&IPIV[k][0],f + blockOffset[k],&LDB,&INFO);
+
+	if(INFO != 0)
+	{
+		std::stringstream sout;
+		sout << "\nBlockTriDiagSolver (dgetrs) \nError INFO = " << INFO << "\n";
+		throw std::runtime_error(sout.str());
+	}
+	}
+
+	// Backward substitution
+
+	for(long k = blockCount-2; k >= 0; k--)
+	{
+	M = blockSize[k];
+	K = blockSize[k+1];
+	dgemm_(&TRANSA,&TRANSB,&M,&NRHS,&K,&ALPHA,W[k].dataPtr,&M,
+	f + blockOffset[k+1],&LDB,&BETA,f + blockOffset[k],&LDB);
+	}
+	}
+
+	long getDimension() const
+	{
+	return N;
+	}
+
+#ifdef _DEBUG
+    bool sizeCheck(long rows, long cols) const
+    {
+    if((rows != N) || (cols < 1))
+    {
+    std::cerr  <<  "BlockTriDiagSolver error                "  << "\n";
+    std::cerr  <<  "Right hand side must have N rows        "  << "\n";
+    std::cerr  <<  "N    : "  << N    << "\n";
+    std::cerr  <<  "rows : "  << rows << "\n";
+    std::cerr  <<  "cols : "  << cols << "\n";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+	long N;
+
+	std::vector<long>   blockSize;
+	std::vector<long> blockOffset;
+
+	// For caching factors
+
+	std::vector<SCC::LapackMatrix>       L;  // Lower blocks
+	std::vector<SCC::LapackMatrix>       S;  // LU factors of the pivot blocks
+	std::vector<SCC::LapackMatrix>       W;  // S_k^{-1} U_k
+	std::vector< std::vector<long> >  IPIV;
+};
+
+} // Namespace SCC
+
+#endif /* SCC_LAPACK_BLOCK_TRI_DIAG_ROUTINES_ */
+
+//
+// LAPACK documentation
+//
+/////////////////////////////////////////////////////////////////////////////
+// DGETRF
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dgetrf	(	integer 	m,
+integer 	n,
+double precision, dimension( lda, * ) 	a,
+integer 	lda,
+integer, dimension( * ) 	ipiv,
+integer 	info
+)
+
+Purpose:
+ DGETRF computes an LU factorization of a general M-by-N matrix A
+ using partial pivoting with row interchanges.
+
+ The factorization has the form
+    A = P * L * U
+ where P is a permutation matrix, L is lower triangular with unit
+ diagonal elements (lower trapezoidal if m > n), and U is upper
+ triangular (upper trapezoidal if m < n).
+Parameters
+[in,out]	A
+          A is DOUBLE PRECISION array, dimension (LDA,N)
+          On entry, the M-by-N matrix to be factored.
+          On exit, the factors L and U from the factorization
+          A = P*L*U; the unit diagonal elements of L are not stored.
+[out]	IPIV
+          IPIV is INTEGER array, dimension (min(M,N))
+          The pivot indices; for 1 <= i <= min(M,N), row i of the
+          matrix was interchanged with row IPIV(i).
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  if INFO = i, U(i,i) is exactly zero. The factorization
+                has been completed, but the factor U is exactly
+                singular, and division by zero will occur if it is used
+                to solve a system of equations.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DGETRS
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dgetrs	(	character 	trans,
+integer 	n,
+integer 	nrhs,
+double precision, dimension( lda, * ) 	a,
+integer 	lda,
+integer, dimension( * ) 	ipiv,
+double precision, dimension( ldb, * ) 	b,
+integer 	ldb,
+integer 	info
+)
+
+Purpose:
+ DGETRS solves a system of linear equations
+    A * X = B  or  A**T * X = B
+ with a general N-by-N matrix A using the LU factorization computed
+ by DGETRF.
+Parameters
+[in]	TRANS
+          TRANS is CHARACTER*1
+          Specifies the form of the system of equations:
+          = 'N':  A * X = B  (No transpose)
+          = 'T':  A**T* X = B  (Transpose)
+          = 'C':  A**T* X = B  (Conjugate transpose = Transpose)
+[in]	A
+          A is DOUBLE PRECISION array, dimension (LDA,N)
+          The factors L and U from the factorization A = P*L*U
+          as computed by DGETRF.
+[in]	IPIV
+          IPIV is INTEGER array, dimension (N)
+          The pivot indices from DGETRF.
+[in,out]	B
+          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+          On entry, the right hand side matrix B.
+          On exit, the solution matrix X.
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
@@ -53,6 +53,10 @@ extern "C" void dgbmv_(char* TRANS, long* M, long* N, long* kl, long* ku, double
 extern "C" void dsbmv_(char* UPLO, long* N, long* K, double* alpha, double* Aptr,
 						long* LDA, double* Xptr, long* INCX, double* BETA, double* Yptr, long* INCY);
 
+// double symmetric packed
+extern "C" void dspmv_(char* UPLO, long* N, double* alpha, double* APptr,
+                       double* Xptr, long* INCX, double* BETA, double* Yptr, long* INCY);
+
 // complex general
 extern "C" void zgemv_(char* TRANS, long* M, long* N, double* alpha, double* Aptr,
                        long* LDA, double* Xptr, long* INCX, double* BETA, double* Yptr, long* INCY);
@@ -61,6 +65,10 @@ extern "C" void zgemv_(char* TRANS, long* M, long* N, double* alpha, double* Apt
 extern "C" void zgbmv_(char* TRANS, long* M, long* N, long* kl, long* ku, double* alpha, double* Aptr,
                        long* LDA, double* Xptr, long* INCX, double* BETA, double* Yptr, long* INCY);
 
+// complex Hermitian packed
+extern "C" void zhpmv_(char* UPLO, long* N, double* alpha, double* APptr,
+                       double* Xptr, long* INCX, double* BETA, double* Yptr, long* INCY);
+
 // Matrix-Matrix multiplication
 
 // double general
@@ -80,17 +88,106 @@ extern "C" void dgesvx_(char* FACT, char* TRANS, long* N, long* NRHS, double* Ap
 						double* FERR, double* BERR, double* WORKptr,
 		                long* IWORKptr, long* INFO);
 
+// double general (LU factorization)
+extern "C" void dgetrf_(long* M, long* N, double* A, long* LDA, long* IPIV, long* INFO);
+
+// double general (solution using LU factors)
+extern "C" void dgetrs_(char* TRANS, long* N, long* NRHS, double* A, long* LDA, long* IPIV,
+                        double* B, long* LDB, long* INFO);
+
+// double general (condition number estimate using LU factors)
+extern "C" void dgecon_(char* NORM, long* N, double* A, long* LDA, double* ANORM, double* RCOND,
+                        double* WORK, long* IWORK, long* INFO);
+
 // double general banded
 extern "C" void dgbsvx_(char* FACT, char* TRANS, long* N, long* KL, long*  	KU, long*  	NRHS,
 						double* AB, long* LDAB, double* AFB, long* LDAFB, long* IPIV, char* EQUED,
 						double* R, double* C, double* B, long* LDB, double* X, long* LDX, double* RCOND, double* FERR,
 						double*   BERR, double *WORK, long*	IWORK, long* INFO);
 
+// double general banded (LU factorization)
+extern "C" void dgbtrf_(long* M, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV, long* INFO);
+
+// double general banded (solution using LU factors)
+extern "C" void dgbtrs_(char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* AB, long* LDAB,
+                        long* IPIV, double* B, long* LDB, long* INFO);
+
+// double general banded (condition number estimate using LU factors)
+extern "C" void dgbcon_(char* NORM, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV,
+                        double* ANORM, double* RCOND, double* WORK, long* IWORK, long* INFO);
+
+// double general (reduction to upper Hessenberg form)
+extern "C" void dgehrd_(long* N, long* ILO, long* IHI, double* A, long* LDA, double* TAU,
+                        double* WORK, long* LWORK, long* INFO);
+
+// double general (application of the orthogonal matrix from dgehrd)
+extern "C" void dormhr_(char* SIDE, char* TRANS, long* M, long* N, long* ILO, long* IHI, double* A, long* LDA,
+                        double* TAU, double* C, long* LDC, double* WORK, long* LWORK, long* INFO);
+
+// double general banded (matrix norm)
+extern "C" double dlangb_(char* NORM, long* N, long* KL, long* KU, double* AB, long* LDAB, double* WORK);
+
+// double symmetric positive definite banded (Cholesky factorization)
+extern "C" void dpbtrf_(char* UPLO, long* N, long* KD, double* AB, long* LDAB, long* INFO);
+
+// double symmetric positive definite banded (solution using Cholesky factors)
+extern "C" void dpbtrs_(char* UPLO, long* N, long* KD, long* NRHS, double* AB, long* LDAB,
+                        double* B, long* LDB, long* INFO);
+
+// double symmetric positive definite banded (condition number estimate using Cholesky factors)
+extern "C" void dpbcon_(char* UPLO, long* N, long* KD, double* AB, long* LDAB, double* ANORM,
+                        double* RCOND, double* WORK, long* IWORK, long* INFO);
+
+// double symmetric banded (matrix norm)
+extern "C" double dlansb_(char* NORM, char* UPLO, long* N, long* K, double* AB, long* LDAB, double* WORK);
+
+// double symmetric banded (selected eigenvalues and eigenvectors)
+extern "C" void dsbevx_(char* JOBZ, char* RANGE, char* UPLO, long* N, long* KD, double* AB, long* LDAB,
+                        double* Q, long* LDQ, double* VL, double* VU, long* IL, long* IU, double* ABSTOL,
+                        long* M, double* W, double* Z, long* LDZ, double* WORK, long* IWORK, long* IFAIL, long* INFO);
+
+// double symmetric banded (all eigenvalues and eigenvectors, divide and conquer)
+extern "C" void dsbevd_(char* JOBZ, char* UPLO, long* N, long* KD, double* AB, long* LDAB, double* W,
+                        double* Z, long* LDZ, double* WORK, long* LWORK, long* IWORK, long* LIWORK, long* INFO);
+
 // complex general banded
 extern "C" void zgbsvx_(char* FACT, char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* Aptr, long* LDA, double* AFptr, long* LDAF,
 						long* IPIVptr,char* EQED, double* Rptr, double* Cptr, double* Bptr, long* LDB, double* Xptr, long* LDX,  double* RCOND,
 						double* FERR, double* BERR, double* WORKptr, double* RWORKptr, long* INFO);
 
+// complex general banded (LU factorization)
+extern "C" void zgbtrf_(long* M, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV, long* INFO);
+
+// complex general banded (solution using LU factors)
+extern "C" void zgbtrs_(char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* AB, long* LDAB,
+                        long* IPIV, double* B, long* LDB, long* INFO);
+
+// complex general banded (condition number estimate using LU factors)
+extern "C" void zgbcon_(char* NORM, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV,
+                        double* ANORM, double* RCOND, double* WORK, double* RWORK, long* INFO);
+
+// complex general (reduction to upper Hessenberg form)
+extern "C" void zgehrd_(long* N, long* ILO, long* IHI, double* A, long* LDA, double* TAU,
+                        double* WORK, long* LWORK, long* INFO);
+
+// complex general (application of the unitary matrix from zgehrd)
+extern "C" void zunmhr_(char* SIDE, char* TRANS, long* M, long* N, long* ILO, long* IHI, double* A, long* LDA,
+                        double* TAU, double* C, long* LDC, double* WORK, long* LWORK, long* INFO);
+
+// complex Hermitian positive definite banded (Cholesky factorization)
+extern "C" void zpbtrf_(char* UPLO, long* N, long* KD, double* AB, long* LDAB, long* INFO);
+
+// complex Hermitian positive definite banded (solution using Cholesky factors)
+extern "C" void zpbtrs_(char* UPLO, long* N, long* KD, long* NRHS, double* AB, long* LDAB,
+                        double* B, long* LDB, long* INFO);
+
+// complex Hermitian positive definite banded (condition number estimate using Cholesky factors)
+extern "C" void zpbcon_(char* UPLO, long* N, long* KD, double* AB, long* LDAB, double* ANORM,
+                        double* RCOND, double* WORK, double* RWORK, long* INFO);
+
+// complex Hermitian banded (matrix norm)
+extern "C" double zlanhb_(char* NORM, char* UPLO, long* N, long* K, double* AB, long* LDAB, double* WORK);
+
 // double symmetric
 extern "C"  void dsyevx_(char*JOBZ, char* RANGE, char* UPLO,long* N, double* A, long* LDA, double* VL, double* VU,
                          long*   IL, long*   IU, double*   ABSTOL, long*   M, double* W, double* Z, long* LDZ,
@@ -99,6 +196,38 @@ extern "C"  void dsyevx_(char*JOBZ, char* RANGE, char* UPLO,long* N, double* A,
 // double symmetric positive definite (Choleski factorization)
 extern "C" void dposv_(char* UPLO, long* N, long* NRHS, double* Aptr, long* LDA, double* Bptr, long* LDB, long* INFO);
 
+// double symmetric positive definite (Cholesky factorization)
+extern "C" void dpotrf_(char* UPLO, long* N, double* A, long* LDA, long* INFO);
+
+// double symmetric positive definite (solution using Cholesky factors)
+extern "C" void dpotrs_(char* UPLO, long* N, long* NRHS, double* A, long* LDA, double* B, long* LDB, long* INFO);
+
+// double symmetric positive definite (condition number estimate using Cholesky factors)
+extern "C" void dpocon_(char* UPLO, long* N, double* A, long* LDA, double* ANORM, double* RCOND,
+                        double* WORK, long* IWORK, long* INFO);
+
+// double symmetric indefinite (Bunch-Kaufman factorization)
+extern "C" void dsytrf_(char* UPLO, long* N, double* A, long* LDA, long* IPIV, double* WORK, long* LWORK, long* INFO);
+
+// double symmetric indefinite (solution using Bunch-Kaufman factors)
+extern "C" void dsytrs_(char* UPLO, long* N, long* NRHS, double* A, long* LDA, long* IPIV,
+                        double* B, long* LDB, long* INFO);
+
+// double symmetric indefinite packed (Bunch-Kaufman factorization)
+extern "C" void dsptrf_(char* UPLO, long* N, double* AP, long* IPIV, long* INFO);
+
+// double symmetric indefinite packed (solution using Bunch-Kaufman factors)
+extern "C" void dsptrs_(char* UPLO, long* N, long* NRHS, double* AP, long* IPIV,
+                        double* B, long* LDB, long* INFO);
+
+// double with single precision factorization and double precision iterative refinement
+
+extern "C" void dsgesv_(long* N, long* NRHS, double* Aptr, long* LDA, long* IPIVptr, double* Bptr, long* LDB,
+                        double* Xptr, long* LDX, double* WORKptr, float* SWORKptr, long* ITER, long* INFO);
+
+extern "C" void dsposv_(char* UPLO, long* N, long* NRHS, double* Aptr, long* LDA, double* Bptr, long* LDB,
+                        double* Xptr, long* LDX, double* WORKptr, float* SWORKptr, long* ITER, long* INFO);
+
 // complex general 
 
 extern "C" void zgesvx_(char* FACT, char* TRANS, long* N, long* NRHS, double* Aptr, long* LDA, double* AFptr, long* LDAF, long* IPIVptr,
@@ -106,6 +235,26 @@ extern "C" void zgesvx_(char* FACT, char* TRANS, long* N, long* NRHS, double* Ap
 	       double* FERR, double* BERR, double* WORKptr,
 		   double* RWORKptr, long* INFO);
 
+// complex Hermitian positive definite (Cholesky factorization)
+extern "C" void zpotrf_(char* UPLO, long* N, double* A, long* LDA, long* INFO);
+
+// complex Hermitian positive definite (solution using Cholesky factors)
+extern "C" void zpotrs_(char* UPLO, long* N, long* NRHS, double* A, long* LDA, double* B, long* LDB, long* INFO);
+
+// complex Hermitian positive definite (condition number estimate using Cholesky factors)
+extern "C" void zpocon_(char* UPLO, long* N, double* A, long* LDA, double* ANORM, double* RCOND,
+                        double* WORK, double* RWORK, long* INFO);
+
+// complex Hermitian (matrix norm)
+extern "C" double zlanhe_(char* NORM, char* UPLO, long* N, double* A, long* LDA, double* WORK);
+
+// complex Hermitian indefinite packed (Bunch-Kaufman factorization)
+extern "C" void zhptrf_(char* UPLO, long* N, double* AP, long* IPIV, long* INFO);
+
+// complex Hermitian indefinite packed (solution using Bunch-Kaufman factors)
+extern "C" void zhptrs_(char* UPLO, long* N, long* NRHS, double* AP, long* IPIV,
+                        double* B, long* LDB, long* INFO);
+
 // double triangular
 
 extern "C" void dtrtrs_(char* UPLO, char* TRANS, char* DIAG, long* N, long* NRHS, double* A, long* LDA, double* B,
@@ -134,7 +283,17 @@ extern "C" int   dgeev_(char* JOBVL, char* JOBVR, long* N,double* A, long* LDA,d
 extern "C" void dsyev_(char* JOBZ,char* UPLO, long*N, double* Aptr, long* LDA, double* Wptr,
 						double* WORKptr, long* LWORK, long* INFO);
 
-// complex Hermitian
+// double symmetric packed
+extern "C"  void dspevx_(char*JOBZ, char* RANGE, char* UPLO,long* N, double* AP, double* VL, double* VU,
+                         long*   IL, long*   IU, double*   ABSTOL, long*   M, double* W, double* Z, long* LDZ,
+                         double* WORK, long* IWORK, long* IFAIL, long* INFO);
+
+// complex Hermitian (relatively robust representations)
+extern "C"  void zheevr_(char* JOBZ, char* RANGE, char* UPLO, long* N, double* A, long* LDA, double* VL, double* VU,
+                         long* IL, long* IU, double* ABSTOL, long* M, double* W, double* Z, long* LDZ, long* ISUPPZ,
+                         double* WORK, long* LWORK, double* RWORK, long* LRWORK, long* IWORK, long* LIWORK, long* INFO);
+
+// complex Hermitian packed
 extern "C"  void zhpevx_(char*JOBZ, char* RANGE, char* UPLO,long* N, double* AP, double* VL, double* VU,
                         long*   IL, long*   IU, double*   ABSTOL, long*   M, double* W, double* Z, long* LDZ,
              			double* WORK, double* RWORK, long* IWORK, long* IFAIL, long* INFO);
@@ -151,6 +310,11 @@ extern "C" void zgeesx_(char* jobvs, char* 	sort,  int(*eigSelect)(double* C), c
 long*	n, double* a, long* 	lda, long* 	sdim, double* w, double* vs, long*	ldvs,
 double* rconde, double* rcondv, double* work, long* lwork, double* rwork, int*  bwork, long* info);
 
+// complex Schur form reordering
+
+extern "C" void ztrsen_(char* job, char* compq, int* select, long* n, double* t, long* ldt,
+double* q, long* ldq, double* w, long* m, double* s, double* sep, double* work, long* lwork, long* info);
+
              			
 // double symmetric tri-diagonal
 extern "C" int dsteqr_(char *compz, long *n, double *d, double *e, double *z,
@@ -169,6 +333,11 @@ extern "C" int dstebz_(char *range, char *order, long *n, double
                        double *d__, double *e, long *m, long *nsplit, double *w, long *iblock,
                        long *isplit, double *work, long *iwork, long *info);
 
+// double symmetric tri-diagonal (eigenvectors by inverse iteration)
+extern "C" int dstein_(long *n, double *d__, double *e, long *m, double *w,
+                       long *iblock, long *isplit, double *z__, long *ldz,
+                       double *work, long *iwork, long *ifail, long *info);
+
 // QR factorization
 
 // double general (create QR factors, Q stored as elementary reflectors)
@@ -199,6 +368,131 @@ extern "C" int dgttrs_(char* TRANS, long* N, long* NRHS,double* DL,double* D, do
 
 
 
+// Single precision (REAL and COMPLEX) versions of the routines above.
+//
+// C++  float  ==  Fortran REAL
+//
+// Complex values are passed as pairs of consecutive floats.
+
+// Matrix-Vector
+
+// float general
+extern "C" void sgemv_(char* TRANS, long* M, long* N, float* alpha, float* Aptr,
+				long* LDA, float* Xptr, long* INCX, float* BETA, float* Yptr, long* INCY);
+
+// float general banded
+extern "C" void sgbmv_(char* TRANS, long* M, long* N, long* kl, long* ku, float* alpha, float* Aptr,
+                       long* LDA, float* Xptr, long* INCX, float* BETA, float* Yptr, long* INCY);
+
+// complex float general banded
+extern "C" void cgbmv_(char* TRANS, long* M, long* N, long* kl, long* ku, float* alpha, float* Aptr,
+                       long* LDA, float* Xptr, long* INCX, float* BETA, float* Yptr, long* INCY);
+
+// complex float general
+extern "C" void cgemv_(char* TRANS, long* M, long* N, float* alpha, float* Aptr,
+                       long* LDA, float* Xptr, long* INCX, float* BETA, float* Yptr, long* INCY);
+
+// Matrix-Matrix multiplication
+
+// float general
+extern "C" void sgemm_(char* TRANSA,char* TRANSB,long* M, long*N ,long* K,float* ALPHA,
+                       float* A,long* LDA,float* B, long* LDB,float* BETA,float* C,long* LDC);
+
+// complex float general
+extern "C" void cgemm_(char* TRANSA,char* TRANSB,long* M, long*N ,long* K,float* ALPHA,
+                       float* A,long* LDA,float* B, long* LDB,float* BETA,float* C,long* LDC);
+
+// Solution of systems
+
+// float general
+extern "C" void sgesvx_(char* FACT, char* TRANS, long* N, long* NRHS, float* Aptr, long* LDA, float* AFptr, long* LDAF, long* IPIVptr,
+		                char* EQED, float* Rptr, float* Cptr, float* Bptr, long* LDB, float* Xptr, long* LDX,  float* RCOND,
+						float* FERR, float* BERR, float* WORKptr, long* IWORKptr, long* INFO);
+
+// complex float general
+extern "C" void cgesvx_(char* FACT, char* TRANS, long* N, long* NRHS, float* Aptr, long* LDA, float* AFptr, long* LDAF, long* IPIVptr,
+		                char* EQED, float* Rptr, float* Cptr, float* Bptr, long* LDB, float* Xptr, long* LDX,  float* RCOND,
+						float* FERR, float* BERR, float* WORKptr, float* RWORKptr, long* INFO);
+
+// float general (LU factorization, solution using LU factors, condition estimate)
+extern "C" void sgetrf_(long* M, long* N, float* A, long* LDA, long* IPIV, long* INFO);
+
+extern "C" void sgetrs_(char* TRANS, long* N, long* NRHS, float* A, long* LDA, long* IPIV,
+                        float* B, long* LDB, long* INFO);
+
+extern "C" void sgecon_(char* NORM, long* N, float* A, long* LDA, float* ANORM, float* RCOND,
+                        float* WORK, long* IWORK, long* INFO);
+
+// float symmetric indefinite (Bunch-Kaufman factorization, solution using factors)
+extern "C" void ssytrf_(char* UPLO, long* N, float* A, long* LDA, long* IPIV, float* WORK, long* LWORK, long* INFO);
+
+extern "C" void ssytrs_(char* UPLO, long* N, long* NRHS, float* A, long* LDA, long* IPIV,
+                        float* B, long* LDB, long* INFO);
+
+// float symmetric positive definite (Choleski factorization)
+extern "C" void sposv_(char* UPLO, long* N, long* NRHS, float* Aptr, long* LDA, float* Bptr, long* LDB, long* INFO);
+
+// float symmetric positive definite (Cholesky factorization, solution using factors, condition estimate)
+extern "C" void spotrf_(char* UPLO, long* N, float* A, long* LDA, long* INFO);
+
+extern "C" void spotrs_(char* UPLO, long* N, long* NRHS, float* A, long* LDA, float* B, long* LDB, long* INFO);
+
+extern "C" void spocon_(char* UPLO, long* N, float* A, long* LDA, float* ANORM, float* RCOND,
+                        float* WORK, long* IWORK, long* INFO);
+
+// complex float Hermitian positive definite (Cholesky factorization, solution using factors, condition estimate)
+extern "C" void cpotrf_(char* UPLO, long* N, float* A, long* LDA, long* INFO);
+
+extern "C" void cpotrs_(char* UPLO, long* N, long* NRHS, float* A, long* LDA, float* B, long* LDB, long* INFO);
+
+extern "C" void cpocon_(char* UPLO, long* N, float* A, long* LDA, float* ANORM, float* RCOND,
+                        float* WORK, float* RWORK, long* INFO);
+
+// float general banded (LU factorization, solution using LU factors, condition estimate)
+extern "C" void sgbtrf_(long* M, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV, long* INFO);
+
+extern "C" void sgbtrs_(char* TRANS, long* N, long* KL, long* KU, long* NRHS, float* AB, long* LDAB,
+                        long* IPIV, float* B, long* LDB, long* INFO);
+
+extern "C" void sgbcon_(char* NORM, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV,
+                        float* ANORM, float* RCOND, float* WORK, long* IWORK, long* INFO);
+
+// complex float general banded (LU factorization, solution using LU factors, condition estimate)
+extern "C" void cgbtrf_(long* M, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV, long* INFO);
+
+extern "C" void cgbtrs_(char* TRANS, long* N, long* KL, long* KU, long* NRHS, float* AB, long* LDAB,
+                        long* IPIV, float* B, long* LDB, long* INFO);
+
+extern "C" void cgbcon_(char* NORM, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV,
+                        float* ANORM, float* RCOND, float* WORK, float* RWORK, long* INFO);
+
+// complex float general banded (expert driver)
+extern "C" void cgbsvx_(char* FACT, char* TRANS, long* N, long* KL, long* KU, long* NRHS, float* Aptr, long* LDA, float* AFptr, long* LDAF,
+						long* IPIVptr,char* EQED, float* Rptr, float* Cptr, float* Bptr, long* LDB, float* Xptr, long* LDX,  float* RCOND,
+						float* FERR, float* BERR, float* WORKptr, float* RWORKptr, long* INFO);
+
+// complex float Hermitian positive definite banded (Cholesky factorization, solution using factors, condition estimate)
+extern "C" void cpbtrf_(char* UPLO, long* N, long* KD, float* AB, long* LDAB, long* INFO);
+
+extern "C" void cpbtrs_(char* UPLO, long* N, long* KD, long* NRHS, float* AB, long* LDAB,
+                        float* B, long* LDB, long* INFO);
+
+extern "C" void cpbcon_(char* UPLO, long* N, long* KD, float* AB, long* LDAB, float* ANORM,
+                        float* RCOND, float* WORK, float* RWORK, long* INFO);
+
+// Eigensystems
+
+// float symmetric
+extern "C" void ssyev_(char* JOBZ,char* UPLO, long*N, float* Aptr, long* LDA, float* Wptr,
+						float* WORKptr, long* LWORK, long* INFO);
+
+// SVD
+
+// float general
+extern "C" void sgesvd_(char* JOBU,char* JOBVT, long* M, long* N, float* APtr, long* LDA, float* SPtr, float* UPtr, long* LDU, float* VTPtr, long* LDVT,
+                       float* WORKtmp, long* LWORK, long* INFO);
+
+
 #endif /* SCC_LAPACKHEADERS_H_ */
 
 
@@ -0,0 +1,313 @@
+/*
+ * SCC_LapackHermPackedMatrix.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+
+// A class for representing an N x N complex Hermitian matrix in Lapack
+// packed storage.
+//
+// Only the upper triangular portion of the matrix is stored, by columns,
+// so that the matrix occupies N*(N+1)/2 complex values, approximately half
+// of the storage required by an N x N LapackMatrixCmplx16. With 0 based
+// indexing the entry A(i,j), i <= j, is located at packed index
+//
+//     i + (j*(j+1))/2
+//
+// Note: LapackHermPackedMatrix stores the upper triangular
+// data of a Hermitian matrix so the UPLO parameter in the
+// Lapack Hermitian packed routines should be specified as "U".
+//
+// The access operator()(i,j) is restricted to the stored entries,
+// i.e. i <= j; the remaining entries are conj(A(j,i)) and are not stored,
+// so no reference to them can be returned. When compiled with the _DEBUG
+// pre-processor directive, access of an entry with i > j triggers an
+// exception (using assert(...)); in other builds no check is performed and
+// the value returned for i > j is NOT A(i,j).
+//
+// Use get(i,j) to read an arbitrary entry, 0 <= i,j < N. It returns
+// A(i,j) for i <= j and conj(A(j,i)) for i > j.
+//
+// This differs from LapackSymPackedMatrix, whose operator()(i,j) accepts
+// any pair of indices since A(i,j) = A(j,i) for a real symmetric matrix.
+//
+// The data pointer obtained using getDataPointer() can be passed
+// directly to Lapack routines that assume a Hermitian matrix stored
+// using the Lapack packed storage convention (e.g. zhpmv, zhpevx,
+// zhptrf and zhptrs), so no conversion of the matrix is required.
+//
+// Lapack dependencies : zhpmv_
+//
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include <cstring>
+#include <complex>
+#include <vector>
+#include <iostream>
+
+#include "LapackInterface/SCC_LapackHeaders.h"
+#include "LapackInterface/SCC_LapackMatrixCmplx16.h"
+
+#ifndef LAPACK_HERM_PACKED_MATRIX_
+#define LAPACK_HERM_PACKED_MATRIX_
+
+namespace SCC
+{
+class LapackHermPackedMatrix
+{
+	public:
+
+	LapackHermPackedMatrix()
+	{
+	initialize();
+	}
+
+    LapackHermPackedMatrix(const LapackHermPackedMatrix& H)
+	{
+    	initialize(H);
+	}
+
+	LapackHermPackedMatrix(long N)
+	{
+	    initialize(N);
+	}
+
+	LapackHermPackedMatrix(const LapackMatrixCmplx16& M)
+	{
+	    initialize(M);
+	}
+
+	void initialize()
+	{
+		AP.initialize();
+    	N  = 0;
+	}
+
+	void initialize(const LapackHermPackedMatrix& H)
+	{
+		N  = H.N;
+	    AP.initialize(H.AP);
+	}
+
+    void initialize(long N)
+	{
+    	this->N  = N;
+    	AP.initialize((N*(N+1))/2,1);
+	}
+
+    //
+    // Initialize with externally defined packed data of N*(N+1)/2 complex
+    // values stored as interleaved real and imaginary parts. Deleting or
+    // re-initializing this instance will not delete the data. Any locally
+    // allocated data is released first.
+    //
+    void initialize(long N, double* APdata)
+	{
+    	AP.initialize();
+    	this->N  = N;
+    	AP.rows  = (N*(N+1))/2;
+    	AP.cols  = 1;
+    	AP.mData.initialize(2*AP.rows,1,APdata);
+	}
+
+    //
+    // Initializes with the upper triangular entries of the square matrix M;
+    // the entries of M below the diagonal are not referenced.
+    //
+    // Column j of the upper triangle of M is contiguous in both M and
+    // the packed data, so each column is copied with a single memcpy.
+    //
+    void initialize(const LapackMatrixCmplx16& M)
+	{
+    	assert(sizeCheck(M.getRowDimension(),M.getColDimension()));
+
+    	initialize(M.getRowDimension());
+
+    	double* APptr = AP.mData.dataPtr;
+    	double* Mptr  = M.mData.dataPtr;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	std::memcpy(APptr + j*(j+1), Mptr + 2*j*N, 2*(j+1)*sizeof(double));
+    	}
+	}
+
+    //
+    // Returns the matrix as a dense N x N matrix
+    //
+    LapackMatrixCmplx16 getDenseMatrix() const
+    {
+    	LapackMatrixCmplx16 M(N,N);
+
+    	double* APptr = AP.mData.dataPtr;
+    	double* Mptr  = M.mData.dataPtr;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	std::memcpy(Mptr + 2*j*N, APptr + j*(j+1), 2*(j+1)*sizeof(double));
+    	}
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	for(long i = 0; i < j; i++)
+    	{
+    		M(j,i) = std::conj(M(i,j));
+    	}}
+    	return M;
+    }
+
+	#ifdef _DEBUG
+	std::complex<double>& operator()(long i, long j)
+	{
+		assert(boundsCheck(i,j));
+		return AP(i + (j*(j+1))/2);
+	}
+
+    const std::complex<double>& operator()(long i, long j) const
+	{
+    	assert(boundsCheck(i,j));
+		return AP(i + (j*(j+1))/2);
+	}
+
+	#else
+	inline std::complex<double>& operator()(long i, long j)
+	{
+		return AP(i + (j*(j+1))/2);
+	}
+
+    inline const std::complex<double>& operator()(long i, long j) const
+	{
+		return AP(i + (j*(j+1))/2);
+	}
+	#endif
+
+    //
+    // Returns the value of A(i,j) for any 0 <= i,j < N; for i > j the
+    // value is conj(A(j,i)).
+    //
+    std::complex<double> get(long i, long j) const
+    {
+    	if(i > j) {return std::conj((*this)(j,i));}
+    	return (*this)(i,j);
+    }
+
+	double* getDataPointer() const {return AP.mData.dataPtr;}
+
+    void setToValue(double val)
+	{
+		AP.setToValue(val);
+	}
+
+    long getDimension() const
+    {
+    	return N;
+    }
+
+//
+//  y := alpha*A*x + beta*y where x and y are arrays of N complex values
+//  stored as interleaved real and imaginary parts.
+//
+//  If beta = 0 then y need not be initialized.
+//
+    void zhpmv(std::complex<double> alpha, const double* x, std::complex<double> beta, double* y) const
+    {
+    char UPLO    = 'U';
+    long Nloc    = N;
+    long INCX    = 1;
+    long INCY    = 1;
+
+    zhpmv_(&UPLO,&Nloc,reinterpret_cast<double*>(&alpha),AP.mData.dataPtr,const_cast<double*>(x),&INCX,
+           reinterpret_cast<double*>(&beta),y,&INCY);
+    }
+
+    void applyHermitianPackedMatrix(const std::vector<std::complex<double>>& x, std::vector<std::complex<double>>& y) const
+    {
+    assert(sizeCheck((long)x.size(),N));
+	if((long)y.size() != N)  {y.resize(N,0.0);}
+	zhpmv(1.0,reinterpret_cast<const double*>(&x[0]),0.0,reinterpret_cast<double*>(&y[0]));
+    }
+
+    std::vector<std::complex<double>> operator*(const std::vector<std::complex<double>>& x) const
+    {
+    std::vector<std::complex<double>> y(N,0.0);
+    applyHermitianPackedMatrix(x,y);
+    return y;
+    }
+
+//
+//  Y = alpha*A*X + beta*Y, applied column by column to the N x m matrix X
+//
+    void apply(const LapackMatrixCmplx16& X, LapackMatrixCmplx16& Y,
+               std::complex<double> alpha = 1.0, std::complex<double> beta = 0.0) const
+    {
+    assert(sizeCheck(X.getRowDimension(),N));
+    assert(sizeCheck(Y.getRowDimension(),N));
+    assert(sizeCheck(X.getColDimension(),Y.getColDimension()));
+
+    for(long c = 0; c < X.getColDimension(); c++)
+    {
+    zhpmv(alpha,X.mData.dataPtr + 2*c*N,beta,Y.mData.dataPtr + 2*c*N);
+    }
+    }
+
+    LapackMatrixCmplx16 operator*(const LapackMatrixCmplx16& X) const
+    {
+    LapackMatrixCmplx16 Y(N,X.getColDimension());
+    apply(X,Y,1.0,0.0);
+    return Y;
+    }
+
+#ifdef _DEBUG
+	bool boundsCheck(long i, long j) const
+	{
+        if((i < 0)||(i > j)||(j >= N))
+	    {
+	    std::cerr  <<  "Hermitian packed matrix storage error " << std::endl;
+	    std::cerr  <<  "N  =  " << N   <<  std::endl;
+	    std::cerr  <<  "Offending indices " << "(" << i << ", " << j << ")" << std::endl;
+	    return false;
+	    }
+	    return true;
+	}
+
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "LapackHermPackedMatrix sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
+#else
+        bool boundsCheck(long, long) const {return true;}
+        bool sizeCheck(long, long) const {return true;}
+#endif
+
+    SCC::LapackMatrixCmplx16 AP;
+	long  N;
+};
+
+} // Namespace SCC
+
+#endif /* LAPACK_HERM_PACKED_MATRIX_ */
@@ -6,6 +6,7 @@
  *
  *  Updated    : July 27, 2018 (C.R. Anderson)
  *  Updated    : Dec. 09, 2023 (C.R. Anderson)
+ *  Updated    : Oct. 18, 2026 (C.R. Anderson)
  */
 //
 //  A matrix class that facilitates the invocation of LAPACK
@@ -26,7 +27,13 @@
 //
 // Linking to the Fortran routines using -llapack -lblas
 //
-// Lapack routine dependencies : dgemm_ and dgemv_
+// Lapack routine dependencies : dgemm_ and dgemv_ (sgemm_ and sgemv_ for
+// single precision).
+//
+// The class is a template, LapackMatrixT<T>, with T = double or T = float.
+// The BLAS routines are selected at compile time using LapackTraits<T>.
+// LapackMatrix is LapackMatrixT<double>. The specialization for complex
+// T is defined in SCC_LapackMatrixCmplx16.h.
 /*
 #############################################################################
 #
@@ -67,17 +74,19 @@ typedef unsigned int uint;   // Define uint to be unsigned int
 #include <iomanip>
 
 #include "SCC_LapackHeaders.h"
+#include "SCC_LapackTraits.h"
 
 #ifndef SCC_LAPACK_MATRIX_
 #define SCC_LAPACK_MATRIX_
 
 namespace SCC
 {
-class LapackMatrix
+template <class T>
+class LapackMatrixT
 {
 public:
 
-	LapackMatrix()
+	LapackMatrixT()
 	{
 	dataPtr        = nullptr;
 	externDataFlag = false;
@@ -85,7 +94,7 @@ public:
 	cols           = 0;
 	}
 
-	LapackMatrix(long rows, long cols)
+	LapackMatrixT(long rows, long cols)
 	{
 	dataPtr        = nullptr;
 	externDataFlag = false;
@@ -96,17 +105,17 @@ public:
 	// defined data. Deleting or re-initializing
 	// this instance will not delete the external data.
 	//
-	// double* must point to a single double array
+	// T* must point to a single T array
 	// of size rows*cols. The data is assumeed to
 	// be stored in column major order (Fortran convention)
 	//
 
-	LapackMatrix(long rows, long cols, double* dataPtr)
+	LapackMatrixT(long rows, long cols, T* dataPtr)
 	{
 	initialize(rows,cols,dataPtr);
 	}
 
-	LapackMatrix(const LapackMatrix& M)
+	LapackMatrixT(const LapackMatrixT& M)
 	{
 	dataPtr        = nullptr;
 	externDataFlag = false;
@@ -118,7 +127,7 @@ public:
 	}
 
 
-	LapackMatrix(LapackMatrix&& V)
+	LapackMatrixT(LapackMatrixT&& V)
     {
       dataPtr        = V.dataPtr;
       externDataFlag = V.externDataFlag;
@@ -130,7 +139,7 @@ public:
     }
 
 
-	~LapackMatrix()
+	~LapackMatrixT()
 	{
 		if((dataPtr != nullptr)&&(not externDataFlag)) delete [] dataPtr;
 	}
@@ -164,13 +173,13 @@ public:
 			if( (this->rows*this->cols) != rows*cols)
 			{
 				delete [] dataPtr;
-				dataPtr = new double[rows*cols];
+				dataPtr = new T[rows*cols];
 			}
 		}
 
 		if((dataPtr == nullptr)||(externDataFlag))
 		{
-		dataPtr        = new double[rows*cols];
+		dataPtr        = new T[rows*cols];
 		externDataFlag = false;
 		}
 
@@ -184,20 +193,20 @@ public:
     // local memory allocation.
     //
 
-	void initialize(const LapackMatrix& M)
+	void initialize(const LapackMatrixT& M)
 	{
 		if((dataPtr != nullptr)&&(not externDataFlag))
 		{
 			if( (this->rows*this->cols) != M.rows*M.cols)
 			{
 				delete [] dataPtr;
-				dataPtr = new double[M.rows*M.cols];
+				dataPtr = new T[M.rows*M.cols];
 			}
 		}
 
 		if((dataPtr == nullptr)||(externDataFlag))
 		{
-		dataPtr        = new double[M.rows*M.cols];
+		dataPtr        = new T[M.rows*M.cols];
 		externDataFlag = false;
 		}
 
@@ -219,12 +228,12 @@ public:
 	// Deleting or re-initializing this instance
 	// will not delete the data.
 	//
-	// double* must point to a single double array
+	// T* must point to a single T array
 	// of size rows*cols. There is no error checking
-	// on the size of the double* array.
+	// on the size of the T* array.
 	//
 
-	void initialize(long rows, long cols, double* dataPtr)
+	void initialize(long rows, long cols, T* dataPtr)
 	{
 		externDataFlag = true;
 		this->rows     = rows;
@@ -233,14 +242,14 @@ public:
 	}
 
 #ifdef _DEBUG
-    double&  operator()(long i1, long i2)
+    T&  operator()(long i1, long i2)
     {
     assert(boundsCheck(i1, 0, rows-1,1));
     assert(boundsCheck(i2, 0, cols-1,2));
     return *(dataPtr +  i1 + i2*rows);
     };
 
-    const double&  operator()(long i1, long i2) const
+    const T&  operator()(long i1, long i2) const
     {
     assert(boundsCheck(i1, 0, rows-1,1));
     assert(boundsCheck(i2, 0, cols-1,2));
@@ -252,7 +261,7 @@ public:
     Returns a reference to the element with index (i1,i2) - indexing
     starting at (0,0).
     */
-    inline double&  operator()(long i1, long i2)
+    inline T&  operator()(long i1, long i2)
     {
     return *(dataPtr +  i1 + i2*rows);
     };
@@ -261,7 +270,7 @@ public:
     Returns a reference to the element with index (i1,i2) - indexing
     starting at (0,0).
      */
-    inline const double&  operator()(long i1, long i2) const
+    inline const T&  operator()(long i1, long i2) const
     {
     return *(dataPtr +   i1  + i2*rows);
     };
@@ -276,7 +285,7 @@ public:
 //
 //
 #ifdef _DEBUG
-    double&  operator()(long i)
+    T&  operator()(long i)
     {
     assert(singleRowOrColCheck());
 
@@ -291,7 +300,7 @@ public:
     return *(dataPtr +  i1 + i2*rows);
     };
 
-    const double&  operator()(long i) const
+    const T&  operator()(long i) const
     {
     assert(singleRowOrColCheck());
     long i1 = i;
@@ -306,11 +315,11 @@ public:
 #else
 
     /*!
-    Returns a reference to the element with index (i) in a LapackMatrix
+    Returns a reference to the element with index (i) in a LapackMatrixT
     with a single row or column.
     Indexing starting at (0)
     */
-    inline double&  operator()(long i)
+    inline T&  operator()(long i)
     {
     long i1 = i;
     long i2 = i;
@@ -321,11 +330,11 @@ public:
     };
 
     /*!
-    Returns a reference to the element with index (i) in a LapackMatrix
+    Returns a reference to the element with index (i) in a LapackMatrixT
     with a single row or column.
     Indexing starting at (0)
      */
-    inline const double&  operator()(long i) const
+    inline const T&  operator()(long i) const
     {
 
     long i1 = i;
@@ -340,13 +349,13 @@ public:
 #endif
 
 
-    inline void operator=(const LapackMatrix& B)
+    inline void operator=(const LapackMatrixT& B)
 	{
     	if(dataPtr == nullptr)
     	{
     		rows    = B.rows;
     		cols    = B.cols;
-    		dataPtr = new double[rows*cols];
+    		dataPtr = new T[rows*cols];
     	}
 
         assert(sizeCheck(this->rows,B.rows));
@@ -358,7 +367,7 @@ public:
 	}
 
 
-    inline void operator+=(const  LapackMatrix& B)
+    inline void operator+=(const  LapackMatrixT& B)
     {
     	assert(sizeCheck(this->rows,B.rows));
     	assert(sizeCheck(this->cols,B.cols));
@@ -368,17 +377,17 @@ public:
     	}
     }
 
-    LapackMatrix operator+(const LapackMatrix& B)
+    LapackMatrixT operator+(const LapackMatrixT& B)
     {
     	assert(sizeCheck(this->rows,B.rows));
     	assert(sizeCheck(this->cols,B.cols));
 
-    	LapackMatrix C(*this);
+    	LapackMatrixT C(*this);
     	C += B;
         return C;
     }
 
-    inline void operator-=(const  LapackMatrix& D)
+    inline void operator-=(const  LapackMatrixT& D)
     {
       assert(sizeCheck(this->rows,D.rows));
       assert(sizeCheck(this->cols,D.cols));
@@ -388,18 +397,18 @@ public:
       }
     }
 
-    LapackMatrix operator-(const LapackMatrix& B)
+    LapackMatrixT operator-(const LapackMatrixT& B)
     {
     	assert(sizeCheck(this->rows,B.rows));
     	assert(sizeCheck(this->cols,B.cols));
 
-    	LapackMatrix C(*this);
+    	LapackMatrixT C(*this);
     	C -= B;
     	return C;
     }
 
 
-    inline void operator*=(const double alpha)
+    inline void operator*=(const T alpha)
     {
     for(long i = 0; i < rows*cols; i++)
     {
@@ -407,21 +416,21 @@ public:
     }
     }
 
-    LapackMatrix operator*(const double alpha)
+    LapackMatrixT operator*(const T alpha)
     {
-    LapackMatrix R(*this);
+    LapackMatrixT R(*this);
     R *= alpha;
     return R;
     }
 
-    friend LapackMatrix operator*(const double alpha, const LapackMatrix& B)
+    friend LapackMatrixT operator*(const T alpha, const LapackMatrixT& B)
     {
-    LapackMatrix R(B);
+    LapackMatrixT R(B);
     R *= alpha;
     return R;
     }
 
-    inline void operator/=(const double alpha)
+    inline void operator/=(const T alpha)
     {
     for(long i = 0; i < rows*cols; i++)
     {
@@ -429,9 +438,9 @@ public:
     }
     }
 
-    LapackMatrix operator/(const double alpha)
+    LapackMatrixT operator/(const T alpha)
     {
-    LapackMatrix R(*this);
+    LapackMatrixT R(*this);
     R /= alpha;
     return R;
     }
@@ -443,7 +452,7 @@ public:
     return false;
     }
 
-    void setToValue(double val)
+    void setToValue(T val)
     {
       for(long i = 0; i < rows*cols; i++)
       {
@@ -463,7 +472,7 @@ public:
 
     }
 
-    void setDiagonal(const std::vector<double>& diag)
+    void setDiagonal(const std::vector<T>& diag)
     {
     	long kMax = (rows < cols) ? rows : cols;
     	kMax      = ((long)diag.size() < kMax) ? (long)diag.size() : kMax;
@@ -473,7 +482,7 @@ public:
     	}
     }
 
-    void scaleRows(const std::vector<double>& rowScaleFactors)
+    void scaleRows(const std::vector<T>& rowScaleFactors)
     {
     	assert(sizeCheck(this->rows,(long)rowScaleFactors.size()));
     	for(long i = 0; i < rows; i++)
@@ -485,7 +494,7 @@ public:
     	}
     }
 
-    void scaleCols(const std::vector<double>& colScaleFactors)
+    void scaleCols(const std::vector<T>& colScaleFactors)
     {
     	assert(sizeCheck(this->cols,(long)colScaleFactors.size()));
     	for(long j = 0; j < cols; j++)
@@ -500,11 +509,11 @@ public:
 
     //  C := alpha*op( A )*op( B ) + beta*C,
 
-LapackMatrix operator*(const LapackMatrix& B) const
+LapackMatrixT operator*(const LapackMatrixT& B) const
 {
     assert(sizeCheck(this->cols,B.rows));
 
-    LapackMatrix C(this->rows,B.cols);
+    LapackMatrixT C(this->rows,B.cols);
 
     char TRANSA = 'N';
     char TRANSB = 'N';
@@ -512,55 +521,55 @@ LapackMatrix operator*(const LapackMatrix& B) const
     long M       = this->rows;
     long N       = B.cols;
     long K       = this->cols;
-    double ALPHA = 1.0;
-    double BETA  = 0.0;
-    double*Aptr  = dataPtr;
-    double*Bptr  = B.dataPtr;
-    double*Cptr  = C.dataPtr;
+    T ALPHA = 1.0;
+    T BETA  = 0.0;
+    T*Aptr  = dataPtr;
+    T*Bptr  = B.dataPtr;
+    T*Cptr  = C.dataPtr;
     long LDA     = this->rows;
     long LDB     = B.rows;
     long LDC     = C.rows;
 
-    dgemm_(&TRANSA,&TRANSB,&M,&N,&K,&ALPHA, Aptr,&LDA,Bptr,&LDB,&BETA,Cptr,&LDC);
+    LapackTraits<T>::gemm(&TRANSA,&TRANSB,&M,&N,&K,&ALPHA, Aptr,&LDA,Bptr,&LDB,&BETA,Cptr,&LDC);
     return C;
 }
 
 
-std::vector<double> operator*(const std::vector<double>& x)
+std::vector<T> operator*(const std::vector<T>& x)
 {
-	std::vector<double> y(rows,0.0);
+	std::vector<T> y(rows,0.0);
 
     char TRANS     = 'N';
-    double ALPHA   = 1.0;
-    double BETA    = 0.0;
+    T ALPHA   = 1.0;
+    T BETA    = 0.0;
     long INCX      = 1;
     long INCY      = 1;
 
-    dgemv_(&TRANS,&rows,&cols,&ALPHA,dataPtr,&rows,const_cast<double*>(&x[0]),&INCX,&BETA,&y[0],&INCY);
+    LapackTraits<T>::gemv(&TRANS,&rows,&cols,&ALPHA,dataPtr,&rows,const_cast<T*>(&x[0]),&INCX,&BETA,&y[0],&INCY);
 	return y;
 }
 
 
 
 
-std::vector<double> applyTranspose(const std::vector<double>& x)
+std::vector<T> applyTranspose(const std::vector<T>& x)
 {
-	std::vector<double> y(cols,0.0);
+	std::vector<T> y(cols,0.0);
 
     char TRANS     = 'T';
-    double ALPHA   = 1.0;
-    double BETA    = 0.0;
+    T ALPHA   = 1.0;
+    T BETA    = 0.0;
     long INCX      = 1;
     long INCY      = 1;
 
-    dgemv_(&TRANS,&rows,&cols,&ALPHA,dataPtr,&rows,const_cast<double*>(&x[0]),&INCX,&BETA,&y[0],&INCY);
+    LapackTraits<T>::gemv(&TRANS,&rows,&cols,&ALPHA,dataPtr,&rows,const_cast<T*>(&x[0]),&INCX,&BETA,&y[0],&INCY);
 	return y;
 }
 
 
-LapackMatrix transpose() const
+LapackMatrixT transpose() const
 {
-	LapackMatrix R(cols,rows);
+	LapackMatrixT R(cols,rows);
 	for(long i = 0; i < rows; i++)
 	{
 		for(long j = 0; j < cols; j++)
@@ -571,20 +580,23 @@ LapackMatrix transpose() const
 	return R;
 }
 
-double normFrobenius() const
+//
+// The sum of squares is accumulated in double precision
+//
+T normFrobenius() const
 {
 	double valSum = 0.0;
     for(long i = 0; i < rows*cols; i++)
     {
-    		valSum += dataPtr[i]*dataPtr[i];
+    		valSum += (double)dataPtr[i]*(double)dataPtr[i];
     }
-    return std::sqrt(valSum);
+    return (T)std::sqrt(valSum);
 }
 
-double elementMaxAbs() const
+T elementMaxAbs() const
 {
     if(rows*cols == 0) return 0.0;
-	double val = std::abs(dataPtr[0]);
+	T val = std::abs(dataPtr[0]);
     for(long i = 0; i < rows*cols; i++)
     {
     		val = (val > std::abs(dataPtr[i])) ? val : std::abs(dataPtr[i]);
@@ -592,9 +604,9 @@ double elementMaxAbs() const
     return val;
 }
 
-std::vector<double> getColumn(long colIndex) const
+std::vector<T> getColumn(long colIndex) const
 {
-	std::vector<double> r(rows,0.0);
+	std::vector<T> r(rows,0.0);
 	for(long i = 0; i < rows; i++)
 	{
 	r[i]=operator()(i,colIndex);
@@ -602,7 +614,7 @@ std::vector<double> getColumn(long colIndex) const
 	return r;
 }
 
-void insertColumn(const std::vector<double> colVals, long colIndex)
+void insertColumn(const std::vector<T> colVals, long colIndex)
 {
 	for(long i = 0; i < rows; i++)
 	{
@@ -612,7 +624,7 @@ void insertColumn(const std::vector<double> colVals, long colIndex)
 
 void swapColumns(long colA, long colB)
 {
-	double val;
+	T val;
 
     for(long i = 0; i < rows; i++)
 	{
@@ -622,9 +634,9 @@ void swapColumns(long colA, long colB)
     }
 }
 
-LapackMatrix getRowSlice(long rowStartIndex, long rowEndIndex)
+LapackMatrixT getRowSlice(long rowStartIndex, long rowEndIndex)
 {
-	LapackMatrix M((rowEndIndex-rowStartIndex)+1,this->cols);
+	LapackMatrixT M((rowEndIndex-rowStartIndex)+1,this->cols);
 
 	for(long i = rowStartIndex; i <= rowEndIndex; i++)
 	{
@@ -636,9 +648,9 @@ LapackMatrix getRowSlice(long rowStartIndex, long rowEndIndex)
 	return M;
 }
 
-LapackMatrix getColSlice(long colStartIndex, long colEndIndex)
+LapackMatrixT getColSlice(long colStartIndex, long colEndIndex)
 {
-	LapackMatrix M(this->rows, (colEndIndex-colStartIndex)+1);
+	LapackMatrixT M(this->rows, (colEndIndex-colStartIndex)+1);
 
 	for(long i = 0; i < this->rows; i++)
 	{
@@ -654,7 +666,7 @@ LapackMatrix getColSlice(long colStartIndex, long colEndIndex)
 
 void printDense(std::ostream& outStream, int precision = 3)
 {
-	    double val;
+	    T val;
 	    std::ios_base::fmtflags ff = outStream.flags();
 	    int precisionCache = outStream.precision(precision);
 
@@ -673,7 +685,7 @@ void printDense(std::ostream& outStream, int precision = 3)
 
 /*!  Outputs the matrix values to the screen with the (0,0) element in the upper left corner  */
 
-friend std::ostream& operator<<(std::ostream& outStream, const LapackMatrix&  V)
+friend std::ostream& operator<<(std::ostream& outStream, const LapackMatrixT&  V)
 {
 	    std::ios_base::fmtflags ff = outStream.flags();
         long i; long j;
@@ -697,7 +709,7 @@ long getRowDimension() const
 long getColDimension() const
 {return cols;}
 
-double* getDataPointer() const
+T* getDataPointer() const
 {return dataPtr;}
 
 bool getExternalDataFlag() const
@@ -714,15 +726,23 @@ bool getExternalDataFlag() const
 // y = alpha*(*this)*x + beta*y
 //
 
-void dgemv(char trans, double alpha, double*x, double beta, double* y)
+void gemv(char trans, T alpha, T*x, T beta, T* y)
 {
 	char TRANS     = trans;
-    double ALPHA   = alpha;
-    double BETA    = beta ;
+    T ALPHA   = alpha;
+    T BETA    = beta ;
     long INCX      = 1;
     long INCY      = 1;
 
-    dgemv_(&TRANS,&rows,&cols,&ALPHA,dataPtr,&rows,x,&INCX,&BETA,y,&INCY);
+    LapackTraits<T>::gemv(&TRANS,&rows,&cols,&ALPHA,dataPtr,&rows,x,&INCX,&BETA,y,&INCY);
+}
+
+//
+// Retained for code written for the double precision class
+//
+void dgemv(char trans, T alpha, T*x, T beta, T* y)
+{
+	gemv(trans,alpha,x,beta,y);
 }
 
 
@@ -754,7 +774,7 @@ void dgemv(char trans, double alpha, double*x, double beta, double* y)
         if((rows != 1)&&(cols != 1))
         {
         std::cerr << "LapackMatrix Error: Use of single index access"  << std::endl;
-        std::cerr << "for LapackMatrix that is not a single row or column" << std::endl;
+        std::cerr << "for LapackMatrixT that is not a single row or column" << std::endl;
         return false;
         }
         return true;
@@ -790,7 +810,7 @@ void dgemv(char trans, double alpha, double*x, double beta, double* y)
 
 
 
-    double*       dataPtr;
+    T*       dataPtr;
 	long             rows;
 	long             cols;
 
@@ -798,6 +818,7 @@ void dgemv(char trans, double alpha, double*x, double beta, double* y)
 
 };
 
+typedef LapackMatrixT<double> LapackMatrix;
 
 }
 
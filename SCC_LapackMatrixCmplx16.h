@@ -4,6 +4,7 @@
  *  Modified on: June 1, 2023
  *      Author: anderson
  *   Updated   : Dec. 9, 2023 (C.R. Anderson)
+ *   Updated   : Oct. 18, 2026 (C.R. Anderson)
  */
 //
 // A matrix class to facilitate the use of LAPACK routines for COMPLEX*16 Fortran data
@@ -23,7 +24,12 @@
 // Internally the data storage uses an SCC::LapackMatrix to facilitate the implementation
 // of algebraic operations.
 //
-// Lapack routine dependencies : zgemm_ and zgemv_
+// Lapack routine dependencies : zgemm_ and zgemv_ (cgemm_ and cgemv_ for
+// single precision).
+//
+// The class is the specialization of LapackMatrixT<T> for T = std::complex<RT>
+// with RT = double or RT = float. LapackMatrixCmplx16 is
+// LapackMatrixT<std::complex<double>>.
 /*
 #############################################################################
 #
@@ -56,29 +62,30 @@
 
 namespace SCC
 {
-class LapackMatrixCmplx16
+template <class RT>
+class LapackMatrixT< std::complex<RT> >
 {
 public:
 
-    LapackMatrixCmplx16()
+    LapackMatrixT()
 	{
     	this->rows = 0;
     	this->cols = 0;
 	}
 
-    LapackMatrixCmplx16(const LapackMatrixCmplx16& C)
+    LapackMatrixT(const LapackMatrixT& C)
     {
     	this->rows  = C.rows;
     	this->cols  = C.cols;
     	this->mData = C.mData;
     }
 
-	LapackMatrixCmplx16(long M, long N)
+	LapackMatrixT(long M, long N)
 	{
 		initialize(M,N);
 	}
 
-	LapackMatrixCmplx16(const SCC::LapackMatrix& realA, const SCC::LapackMatrix& imagA)
+	LapackMatrixT(const LapackMatrixT<RT>& realA, const LapackMatrixT<RT>& imagA)
 	{
 		initialize(realA,imagA);
 	}
@@ -98,14 +105,27 @@ public:
 		mData.setToValue(0.0);
 	}
 
-	void initialize(const LapackMatrixCmplx16& C)
+	void initialize(const LapackMatrixT& C)
     {
     	this->rows  = C.rows;
     	this->cols  = C.cols;
     	this->mData.initialize(C.mData);
     }
 
-	void initialize(const SCC::LapackMatrix& realA, const SCC::LapackMatrix& imagA)
+	//
+	// Initialize using external data. dataPtr must point to rows*cols
+	// complex values stored by columns (Fortran convention) as alternating
+	// real and imaginary parts. Deleting or re-initializing this instance
+	// will not delete the data.
+	//
+	void initialize(long rows, long cols, RT* dataPtr)
+	{
+	    this->rows = rows;
+		this->cols = cols;
+		mData.initialize(2*rows,cols,dataPtr);
+	}
+
+	void initialize(const LapackMatrixT<RT>& realA, const LapackMatrixT<RT>& imagA)
 	{
 	    this->rows = realA.getRowDimension();
 		this->cols = realA.getColDimension();
@@ -126,7 +146,7 @@ public:
 		}}
 	}
 
-	void setToValue(double val)
+	void setToValue(RT val)
 	{
 	    for(long j = 0; j < cols; j++)
 		{
@@ -137,7 +157,7 @@ public:
 		}}
 	}
 
-    void setToValue(const std::complex<double>& val)
+    void setToValue(const std::complex<RT>& val)
 	{
 	    for(long j = 0; j < cols; j++)
 		{
@@ -152,27 +172,27 @@ public:
 	long getRowDimension() const {return rows;}
 	long getColDimension() const {return cols;}
 
-	inline void insert(long i, long j, double vReal, double vCplx)
+	inline void insert(long i, long j, RT vReal, RT vCplx)
 	{
 		 mData(2*i,j)      = vReal;
 		 mData(2*i + 1,j)  = vCplx;
 	}
 
-	inline void extract(long i, long j, double& vReal, double& vCplx) const
+	inline void extract(long i, long j, RT& vReal, RT& vCplx) const
 	{
 	     vReal = mData(2*i,j);
 		 vCplx = mData(2*i + 1,j);
 	}
 
-    inline void insert(long i, long j, std::complex<double> z)
+    inline void insert(long i, long j, std::complex<RT> z)
 	{
 		 mData(2*i,j)      = z.real();
 		 mData(2*i + 1,j)  = z.imag();
 	}
 
-	inline void extract(long i, long j, std::complex<double>& z) const
+	inline void extract(long i, long j, std::complex<RT>& z) const
 	{
-	     z = std::complex<double>(mData(2*i,j),mData(2*i + 1,j));
+	     z = std::complex<RT>(mData(2*i,j),mData(2*i + 1,j));
 	}
 
 
@@ -182,7 +202,7 @@ public:
 	{
 	    std::ios_base::fmtflags ff = outStream.flags();
 	    int precisionCache = outStream.precision(precision);
-	    std::complex<double> val;
+	    std::complex<RT> val;
 
         for(long i = 0;  i < rows; i++)
         {
@@ -199,7 +219,7 @@ public:
 
 	/*!  Outputs the matrix values to the screen with the (0,0) element in the upper left corner  */
 
-	friend std::ostream& operator<<(std::ostream& outStream, const LapackMatrixCmplx16&  V)
+	friend std::ostream& operator<<(std::ostream& outStream, const LapackMatrixT&  V)
 	{
         long i; long j;
 
@@ -222,40 +242,40 @@ public:
 
     /*!
     Returns a reference to the element with index (i,j) - indexing
-    starting at (0,0). Using the fact that the pointer to a complex<double> value
+    starting at (0,0). Using the fact that the pointer to a complex<RT> value
     is a pointer to the first of two consecutive doubles storing the
     complex value.
     */
 
 	#ifdef _DEBUG
-    std::complex<double>&  operator()(long i, long j)
+    std::complex<RT>&  operator()(long i, long j)
     {
     assert(boundsCheck(i, 0, rows-1,1));
     assert(boundsCheck(j, 0, cols-1,2));
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i) + j*(2*rows))));
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i) + j*(2*rows))));
     };
 
-    const std::complex<double>&  operator()(long i, long j) const
+    const std::complex<RT>&  operator()(long i, long j) const
     {
     assert(boundsCheck(i, 0, rows-1,1));
     assert(boundsCheck(j, 0, cols-1,2));
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i) + j*(2*rows))));
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i) + j*(2*rows))));
     };
 #else
     /*!
     Returns a reference to the element with index (i,j) - indexing
-    starting at (0,0). Using the fact that the pointer to a complex<double> value
+    starting at (0,0). Using the fact that the pointer to a complex<RT> value
     is a pointer to the first of two consecutive doubles storing the
     complex value.
     */
-    inline std::complex<double>&  operator()(long i, long j)
+    inline std::complex<RT>&  operator()(long i, long j)
     {
-    	return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i) + j*(2*rows))));
+    	return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i) + j*(2*rows))));
     };
 
-    inline const std::complex<double>&  operator()(long i, long j) const
+    inline const std::complex<RT>&  operator()(long i, long j) const
     {
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i) + j*(2*rows))));;
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i) + j*(2*rows))));;
     };
 #endif
 
@@ -268,7 +288,7 @@ public:
 //
 //
 #ifdef _DEBUG
-    std::complex<double>&  operator()(long i)
+    std::complex<RT>&  operator()(long i)
     {
     assert(singleRowOrColCheck());
 
@@ -280,10 +300,10 @@ public:
     assert(boundsCheck(i1, 0, rows-1,1));
     assert(boundsCheck(i2, 0, cols-1,2));
 
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
     };
 
-    const std::complex<double>&  operator()(long i) const
+    const std::complex<RT>&  operator()(long i) const
     {
     assert(singleRowOrColCheck());
     long i1 = i;
@@ -293,31 +313,31 @@ public:
 
     assert(boundsCheck(i1, 0, rows-1,1));
     assert(boundsCheck(i2, 0, cols-1,2));
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
     };
 #else
 
     /*!
-    Returns a reference to the element with index (i) in a LapackMatrixCmplx16
+    Returns a reference to the element with index (i) in a LapackMatrixT
     with a single row or column.
     Indexing starting at (0)
     */
-    inline std::complex<double>&  operator()(long i)
+    inline std::complex<RT>&  operator()(long i)
     {
     long i1 = i;
     long i2 = i;
     if     (cols == 1) {i2 = 0;}
     else if(rows == 1) {i1 = 0;}
 
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
     };
 
     /*!
-    Returns a reference to the element with index (i) in a LapackMatrixCmplx16
+    Returns a reference to the element with index (i) in a LapackMatrixT
     with a single row or column.
     Indexing starting at (0)
      */
-    inline const std::complex<double>&  operator()(long i) const
+    inline const std::complex<RT>&  operator()(long i) const
     {
 
     long i1 = i;
@@ -325,7 +345,7 @@ public:
     if     (cols == 1) {i2 = 0;}
     else if(rows == 1) {i1 = 0;}
 
-    return *(reinterpret_cast<std::complex<double>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
+    return *(reinterpret_cast<std::complex<RT>*>((mData.dataPtr +  (2*i1) + i2*(2*rows))));
     };
 
 
@@ -333,7 +353,10 @@ public:
 
 
 
-    double normFrobenius() const
+    //
+    // The sum of squares is accumulated in double precision
+    //
+    RT normFrobenius() const
     {
 	double valSum = 0.0;
 
@@ -341,12 +364,12 @@ public:
 	{
 	for(long i = 0; i < rows; i++)
 	{
-    		valSum += std::norm(this->operator()(i,j));
+    		valSum += (double)std::norm(this->operator()(i,j));
     }}
-    return std::sqrt(valSum);
+    return (RT)std::sqrt(valSum);
     }
 
-    void getColumn(long colIndex, std::vector< std::complex<double>> & Mcol)
+    void getColumn(long colIndex, std::vector< std::complex<RT>> & Mcol)
     {
     	Mcol.resize(rows);
     	for(long i = 0; i < rows; i++)
@@ -355,7 +378,7 @@ public:
     	}
     }
 
-    void getColumn(long colIndex, LapackMatrixCmplx16 & Mcol)
+    void getColumn(long colIndex, LapackMatrixT & Mcol)
     {
     	Mcol.initialize(rows,1);
     	for(long i = 0; i < rows; i++)
@@ -364,7 +387,7 @@ public:
     	}
     }
 
-	void getRealAndCmplxMatrix(LapackMatrix& realA, LapackMatrix& imagA) const
+	void getRealAndCmplxMatrix(LapackMatrixT<RT>& realA, LapackMatrixT<RT>& imagA) const
 	{
 		realA.initialize(rows,cols);
 		imagA.initialize(rows,cols);
@@ -378,7 +401,7 @@ public:
 		}}
 	}
 
-	void getRealAndCmplxColumn(long colIndex, std::vector<double>& realCol, std::vector<double>& imagCol)
+	void getRealAndCmplxColumn(long colIndex, std::vector<RT>& realCol, std::vector<RT>& imagCol)
 	{
 		assert(boundsCheck(colIndex, 0, cols-1,2));
 		realCol.resize(rows);
@@ -391,7 +414,7 @@ public:
 		}
 	}
 
-    void getRealAndCmplxColumn(long colIndex, LapackMatrix& realCol, LapackMatrix& imagCol)
+    void getRealAndCmplxColumn(long colIndex, LapackMatrixT<RT>& realCol, LapackMatrixT<RT>& imagCol)
 	{
 		assert(boundsCheck(colIndex, 0, cols-1,2));
 
@@ -407,17 +430,17 @@ public:
 	}
 
 
-	LapackMatrixCmplx16 createUpperTriPacked()
+	LapackMatrixT createUpperTriPacked()
 	{
 		if(rows != cols)
 		{
 			throw std::runtime_error("\nLapackMatrixCmplx16: No conversion of non-square matrix \nto upper traingular packed form.\n");
 		}
 
-		LapackMatrixCmplx16 AP((rows*(rows+1))/2,1);
+		LapackMatrixT AP((rows*(rows+1))/2,1);
 
 		long     ind; long     jnd;
-		double vReal; double vImag;
+		RT vReal; RT vImag;
 
 		for(long j = 1; j <=cols; j++)
 		{
@@ -437,7 +460,7 @@ public:
 
 //  Algebraic operators
 
-    inline void operator=(const LapackMatrixCmplx16& B)
+    inline void operator=(const LapackMatrixT& B)
 	{
     	if(mData.dataPtr == nullptr)
     	{
@@ -452,36 +475,36 @@ public:
 	}
 
 
-    inline void operator+=(const  LapackMatrixCmplx16& B)
+    inline void operator+=(const  LapackMatrixT& B)
     {
     	assert(sizeCheck(this->rows,B.rows));
     	assert(sizeCheck(this->cols,B.cols));
     	mData += B.mData;
     }
 
-    LapackMatrixCmplx16 operator+(const LapackMatrixCmplx16& B)
+    LapackMatrixT operator+(const LapackMatrixT& B)
     {
     	assert(sizeCheck(this->rows,B.rows));
     	assert(sizeCheck(this->cols,B.cols));
 
-    	LapackMatrixCmplx16  C(*this);
+    	LapackMatrixT  C(*this);
 
     	C.mData += B.mData;
         return C;
     }
 
-    LapackMatrixCmplx16 operator-(const LapackMatrixCmplx16& B)
+    LapackMatrixT operator-(const LapackMatrixT& B)
     {
     	assert(sizeCheck(this->rows,B.rows));
     	assert(sizeCheck(this->cols,B.cols));
 
-    	LapackMatrixCmplx16  C(*this);
+    	LapackMatrixT  C(*this);
 
     	C.mData -= B.mData;
     	return C;
     }
 
-    inline void operator-=(const  LapackMatrixCmplx16& D)
+    inline void operator-=(const  LapackMatrixT& D)
     {
       assert(sizeCheck(this->rows,D.rows));
       assert(sizeCheck(this->cols,D.cols));
@@ -489,16 +512,16 @@ public:
       mData -= D.mData;
     }
 
-    inline void operator*=(const double alpha)
+    inline void operator*=(const RT alpha)
     {
     		mData *= alpha;
     }
 
-    inline void operator*=(const std::complex<double> alpha)
+    inline void operator*=(const std::complex<RT> alpha)
     {
-            double cReal; double cImag;
-            double aReal = alpha.real();
-            double aImag = alpha.imag();
+            RT cReal; RT cImag;
+            RT aReal = alpha.real();
+            RT aImag = alpha.imag();
 
             for(long i = 0; i < rows; i++)
             {
@@ -511,48 +534,48 @@ public:
             }}
     }
 
-    LapackMatrixCmplx16 operator*(const double alpha)
+    LapackMatrixT operator*(const RT alpha)
     {
-    LapackMatrixCmplx16 R(*this);
+    LapackMatrixT R(*this);
     R *= alpha;
     return R;
     }
 
-    LapackMatrixCmplx16 operator*(const std::complex<double> alpha)
+    LapackMatrixT operator*(const std::complex<RT> alpha)
     {
-    LapackMatrixCmplx16 R(*this);
+    LapackMatrixT R(*this);
     R *= alpha;
     return R;
     }
 
 
-    friend LapackMatrixCmplx16 operator*(const double alpha, const LapackMatrixCmplx16& B)
+    friend LapackMatrixT operator*(const RT alpha, const LapackMatrixT& B)
     {
-    LapackMatrixCmplx16 R(B);
+    LapackMatrixT R(B);
     R *= alpha;
     return R;
     }
 
-    friend LapackMatrixCmplx16 operator*(const std::complex<double> alpha, const LapackMatrixCmplx16& B)
+    friend LapackMatrixT operator*(const std::complex<RT> alpha, const LapackMatrixT& B)
     {
-    LapackMatrixCmplx16 R(B);
+    LapackMatrixT R(B);
     R *= alpha;
     return R;
     }
 
 
-    inline void operator/=(const double alpha)
+    inline void operator/=(const RT alpha)
     {
     		mData /= alpha;
     }
 
-    inline void operator/=(const std::complex<double> alpha)
+    inline void operator/=(const std::complex<RT> alpha)
     {
-            double cReal; double cImag;
-            std::complex<double> alphaInv = 1.0/alpha;
+            RT cReal; RT cImag;
+            std::complex<RT> alphaInv = RT(1)/alpha;
 
-            double aReal = alphaInv.real();
-            double aImag = alphaInv.imag();
+            RT aReal = alphaInv.real();
+            RT aImag = alphaInv.imag();
 
             for(long i = 0; i < rows; i++)
             {
@@ -566,16 +589,16 @@ public:
     }
 
 
-    LapackMatrixCmplx16 operator/(const double alpha)
+    LapackMatrixT operator/(const RT alpha)
     {
-    LapackMatrixCmplx16 R(*this);
+    LapackMatrixT R(*this);
     R /= alpha;
     return R;
     }
 
-    LapackMatrixCmplx16 operator/(const std::complex<double> alpha)
+    LapackMatrixT operator/(const std::complex<RT> alpha)
     {
-    LapackMatrixCmplx16 R(*this);
+    LapackMatrixT R(*this);
     R /= alpha;
     return R;
     }
@@ -590,11 +613,11 @@ public:
 
 //  C := alpha*op( A )*op( B ) + beta*C,
 
-LapackMatrixCmplx16 operator*(const LapackMatrixCmplx16& B) const
+LapackMatrixT operator*(const LapackMatrixT& B) const
 {
     assert(sizeCheck(this->cols,B.rows));
 
-    LapackMatrixCmplx16 C(this->rows,B.cols);
+    LapackMatrixT C(this->rows,B.cols);
 
     char TRANSA = 'N';
     char TRANSB = 'N';
@@ -603,40 +626,40 @@ LapackMatrixCmplx16 operator*(const LapackMatrixCmplx16& B) const
     long N       = B.cols;
     long K       = this->cols;
 
-    std::complex<double> ALPHA = {1.0,0.0};
-    std::complex<double> BETA  = {0.0,0.0};
+    std::complex<RT> ALPHA = {1.0,0.0};
+    std::complex<RT> BETA  = {0.0,0.0};
 
-    double*Aptr  = mData.getDataPointer();
-    double*Bptr  = B.mData.getDataPointer();
-    double*Cptr  = C.mData.getDataPointer();
+    RT*Aptr  = mData.getDataPointer();
+    RT*Bptr  = B.mData.getDataPointer();
+    RT*Cptr  = C.mData.getDataPointer();
     long LDA     = this->rows;
     long LDB     = B.rows;
     long LDC     = C.rows;
 
-    zgemm_(&TRANSA,&TRANSB,&M,&N,&K,reinterpret_cast<double*>(&ALPHA), Aptr,&LDA,Bptr,&LDB,reinterpret_cast<double*>(&BETA),Cptr,&LDC);
+    LapackTraits< std::complex<RT> >::gemm(&TRANSA,&TRANSB,&M,&N,&K,reinterpret_cast<RT*>(&ALPHA), Aptr,&LDA,Bptr,&LDB,reinterpret_cast<RT*>(&BETA),Cptr,&LDC);
     return C;
 }
 
 
-std::vector< std::complex<double> > operator*(const std::vector< std::complex<double> >& x)
+std::vector< std::complex<RT> > operator*(const std::vector< std::complex<RT> >& x)
 {
-	std::vector< std::complex<double> > y(rows,0.0);
+	std::vector< std::complex<RT> > y(rows,0.0);
 
     char TRANS     = 'N';
-    std::complex<double> ALPHA = {1.0,0.0};
-    std::complex<double> BETA  = {0.0,0.0};
+    std::complex<RT> ALPHA = {1.0,0.0};
+    std::complex<RT> BETA  = {0.0,0.0};
     long INCX      = 1;
     long INCY      = 1;
 
-    zgemv_(&TRANS,&rows,&cols,reinterpret_cast<double*>(&ALPHA),mData.getDataPointer(),&rows,
-    reinterpret_cast<double*>(const_cast< std::complex<double>* >(&x[0])),&INCX,reinterpret_cast<double*>(&BETA),reinterpret_cast<double*>(&y[0]),&INCY);
+    LapackTraits< std::complex<RT> >::gemv(&TRANS,&rows,&cols,reinterpret_cast<RT*>(&ALPHA),mData.getDataPointer(),&rows,
+    reinterpret_cast<RT*>(const_cast< std::complex<RT>* >(&x[0])),&INCX,reinterpret_cast<RT*>(&BETA),reinterpret_cast<RT*>(&y[0]),&INCY);
 	return y;
 }
 
 
-LapackMatrixCmplx16 conjugateTranspose() const
+LapackMatrixT conjugateTranspose() const
 {
-	LapackMatrixCmplx16 R(cols,rows);
+	LapackMatrixT R(cols,rows);
 	for(long i = 0; i < rows; i++)
 	{
 		for(long j = 0; j < cols; j++)
@@ -647,6 +670,12 @@ LapackMatrixCmplx16 conjugateTranspose() const
 	return R;
 }
 
+//
+// Pointer to the matrix data: alternating real and imaginary parts
+// of the entries stored by columns.
+//
+RT* getDataPointer() const
+{return mData.dataPtr;}
 
 #ifdef _DEBUG
         bool boundsCheck(long i, long begin, long end,int coordinate) const
@@ -708,9 +737,11 @@ LapackMatrixCmplx16 conjugateTranspose() const
 
 	long rows;
 	long cols;
-	SCC::LapackMatrix mData;
+	LapackMatrixT<RT> mData;
 
 };
+
+typedef LapackMatrixT< std::complex<double> > LapackMatrixCmplx16;
 };
 
 // LAPACK documentation
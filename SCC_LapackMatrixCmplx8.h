@@ -0,0 +1,48 @@
+/*
+ * SCC_LapackMatrixCmplx8.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// A matrix class to facilitate the use of LAPACK routines for COMPLEX (COMPLEX*8) Fortran
+// data types. The class has the same interface as SCC::LapackMatrixCmplx16 with float
+// replacing double.
+//
+// LapackMatrixCmplx8 is the instance LapackMatrixT<std::complex<float>> of the
+// complex matrix class template defined in SCC_LapackMatrixCmplx16.h.
+//
+// Lapack routine dependencies : cgemm_ and cgemv_
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include "LapackInterface/SCC_LapackMatrixFloat.h"
+#include "LapackInterface/SCC_LapackMatrixCmplx16.h"
+
+#ifndef LAPACK_MATRIX_CMPLX_8_H_
+#define LAPACK_MATRIX_CMPLX_8_H_
+
+namespace SCC
+{
+typedef LapackMatrixT< std::complex<float> > LapackMatrixCmplx8;
+};
+
+#endif
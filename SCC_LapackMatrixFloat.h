@@ -0,0 +1,54 @@
+/*
+ * SCC_LapackMatrixFloat.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+//  A single precision matrix class that facilitates the invocation of
+//  the single precision (s prefixed) LAPACK routines. The class has the
+//  same interface as SCC::LapackMatrix with float replacing double.
+//
+//  LapackMatrixFloat is the instance LapackMatrixT<float> of the matrix
+//  class template defined in SCC_LapackMatrix.h.
+//
+// Data type mapping used:
+//
+// C++  char   ==  Fortran character
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  float  ==  Fortran REAL
+//
+// Lapack routine dependencies : sgemm_ and sgemv_
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include "SCC_LapackMatrix.h"
+
+#ifndef SCC_LAPACK_MATRIX_FLOAT_
+#define SCC_LAPACK_MATRIX_FLOAT_
+
+namespace SCC
+{
+typedef LapackMatrixT<float> LapackMatrixFloat;
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include "SCC_LapackMatrix.h"
 #include "SCC_LapackHeaders.h"
+#include "SCC_LapackTraits.h"
 //
 // SCC::LapackMatrixRoutines
 //
@@ -26,6 +27,12 @@
 // C++  long   ==  Fortran INTEGER
 // C++  double ==  Fortran DOUBLE PRECISION
 //
+// The classes DGESVD, DSYEV, DGESVX, DPOSV, DGESV and DSYSV are the double
+// precision instances of the class templates GESVD<T>, SYEV<T>, GESVX<T>,
+// POSV<T>, GESV<T> and SYSV<T>.
+// The LAPACK routine for the data type T is selected at compile time
+// using LapackTraits<T> (SCC_LapackTraits.h).
+//
 // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 // Current class list
 // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -63,6 +70,12 @@
 // real symmetric matrix A.
 //
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SymmetricSpectralOperator : Created for applying functions
+// f(A) = U diag(f(lambda)) U**T of a real symmetric matrix A, e.g.
+// (A - sigma I)^(-1), exp(tA) or A^(1/2), to vectors using the
+// eigensystem of A computed once with DSYEV.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Class DGESVX : Created for solving general  systems of equations
 // LAPACK base routine description:
 // DGESVX uses the LU factorization to compute the solution to a real
@@ -75,12 +88,56 @@
 //
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Class DPOSV : Created for solving symmetric positive definite systems
-// of equations
+// of equations using cached Cholesky factors
+// LAPACK base routines description:
+// DPOTRF computes the Cholesky factorization of a real symmetric
+// positive definite matrix A, DPOTRS solves A * X = B using the
+// factors and DPOCON estimates the reciprocal condition number.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DGESV : Created for solving general systems of equations
+// using cached LU factors, without equilibration or refinement
+// LAPACK base routines description:
+// DGETRF computes an LU factorization of a general M-by-N matrix A
+// using partial pivoting with row interchanges.
+// DGETRS solves a system of linear equations A * X = B or A**T * X = B
+// using the LU factorization computed by DGETRF.
+// DGECON estimates the reciprocal of the condition number of a general
+// real matrix A using the LU factorization computed by DGETRF.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSYSV : Created for solving symmetric indefinite systems
+// of equations using cached Bunch-Kaufman factors, and for the
+// inertia of symmetric matrices
+// LAPACK base routines description:
+// DSYTRF computes the factorization of a real symmetric matrix A using
+// the Bunch-Kaufman diagonal pivoting method.
+// DSYTRS solves a system of linear equations A*X = B with a real
+// symmetric matrix A using the factorization computed by DSYTRF.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSGESV : Created for solving general systems of equations
+// using a single precision LU factorization and double precision
+// iterative refinement.
+// LAPACK base routine description:
+// DSGESV computes the solution to a real system of linear equations
+//    A * X = B,
+// where A is an N-by-N matrix and X and B are N-by-NRHS matrices.
+// The matrix is factored in single precision and the solution is
+// refined to double precision accuracy. If the refinement does not
+// converge the solution is computed with a double precision
+// factorization.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSPOSV : Created for solving symmetric positive definite systems
+// of equations using a single precision Cholesky factorization and
+// double precision iterative refinement.
 // LAPACK base routine description:
-// DPOSV computes the solution to a real system of linear equations
+// DSPOSV computes the solution to a real system of linear equations
 //    A * X = B,
 // where A is an N-by-N symmetric positive definite matrix and X and B
-// are N-by-NRHS matrices.
+// are N-by-NRHS matrices, with the same single precision factorization,
+// refinement and double precision fallback as DSGESV.
 //
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Class NORMALEQ creates the solution of the normal equations using
@@ -103,6 +160,23 @@
 // of a real symmetric matrix A.  Eigenvalues and eigenvectors can be
 // selected by specifying either a range of values or a range of indices
 // for the desired eigenvalues.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DGEEVX : Created for computing eigensystem components of a
+// real nonsymmetric matrix.
+// LAPACK base routine description:
+// DGEEVX computes for an N-by-N real nonsymmetric matrix A, the
+// eigenvalues and, optionally, the left and/or right eigenvectors.
+// Optionally also, it computes a balancing transformation, reciprocal
+// condition numbers for the eigenvalues, and reciprocal condition
+// numbers for the right eigenvectors.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSHIFTSV : Created for solving the shifted systems
+//    (A - sigma I) X = B
+// for many shifts sigma with the same matrix A. A is reduced once
+// to upper Hessenberg form with DGEHRD, after which each shift
+// requires O(N^2) operations.
 /*
 #############################################################################
 #
@@ -133,6 +207,11 @@
 #include <limits>
 #include <cstring>
 #include <stdexcept>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <thread>
 
 #ifndef  SCC_LAPACK_MATRIX_ROUTINES_
 #define  SCC_LAPACK_MATRIX_ROUTINES_
@@ -324,21 +403,25 @@ public:
 //  are the singular values of A; they are real and non-negative, and
 //  are returned in descending order.  The first min(m,n) columns of
 //  U and V are the left and right singular vectors of A.
+//
+// The class is a template, GESVD<T>, with T = double or T = float
+// invoking DGESVD or SGESVD respectively. DGESVD is GESVD<double>.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-class DGESVD
+template <class T>
+class GESVD
 {
 public:
 
-    DGESVD()
+    GESVD()
     {
         initialize();
     }
 
 
-    DGESVD(const DGESVD& dgesvd)
+    GESVD(const GESVD& gesvd)
     {
-        initialize(dgesvd);
+        initialize(gesvd);
     }
 
     void initialize()
@@ -354,25 +437,25 @@ public:
     this->overwriteExtDataFlag = false;
     }
 
-    void initialize(const DGESVD& dgesvd)
+    void initialize(const GESVD& gesvd)
     {
-    this->A = dgesvd.A;
-    this->U = dgesvd.U;
+    this->A = gesvd.A;
+    this->U = gesvd.U;
 
-    this->singularValues       = dgesvd.singularValues;
-    this->VT                   = dgesvd.VT;
-    this->svdDim               = dgesvd.svdDim;
-    this->overwriteExtDataFlag = dgesvd.overwriteExtDataFlag;
+    this->singularValues       = gesvd.singularValues;
+    this->VT                   = gesvd.VT;
+    this->svdDim               = gesvd.svdDim;
+    this->overwriteExtDataFlag = gesvd.overwriteExtDataFlag;
     }
 
 
-    bool equalMatrixDimensions(const SCC::LapackMatrix& A, const SCC::LapackMatrix& B)
+    bool equalMatrixDimensions(const LapackMatrixT<T>& A, const LapackMatrixT<T>& B)
     {
         if((A.rows != B.rows)||(A.cols != B.cols)) return false;
         return true;
     }
 
-    void computeSVD(const SCC::LapackMatrix& A)
+    void computeSVD(const LapackMatrixT<T>& A)
     {
 
         if(not this->overwriteExtDataFlag)
@@ -415,24 +498,24 @@ public:
         long LWORK = -1;
         INFO       = 0;
 
-        double WORKtmp;
-        dgesvd_(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0],
+        T WORKtmp;
+        LapackTraits<T>::gesvd(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0],
                 U.dataPtr, &LDU, VT.dataPtr, &LDVT, &WORKtmp, &LWORK, &INFO);
 
         LWORK = (long)(WORKtmp + 100);
         WORK.resize(LWORK);
 
-        double* WORKptr =    &WORK[0];
+        T* WORKptr =    &WORK[0];
 
         // Second call to create svd
 
         INFO       = 0;
-        dgesvd_(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0], U.dataPtr,
+        LapackTraits<T>::gesvd(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0], U.dataPtr,
                 &LDU, VT.dataPtr, &LDVT, WORKptr, &LWORK, &INFO);
 
         if(INFO != 0)
         {
-        std::cerr << "DGESVD  Failed : INFO = " << INFO  << std::endl;
+        std::cerr << LapackTraits<T>::prefix() << "gesvd  Failed : INFO = " << INFO  << std::endl;
         exit(1);
         }
     }
@@ -449,7 +532,7 @@ public:
 //  This routine is added to avoid the need for extraneous copying
 //  of input matrix data.
 //
-    void computeSVD(long Arows, long Acols, double* Adata)
+    void computeSVD(long Arows, long Acols, T* Adata)
     {
         this->overwriteExtDataFlag = true;
         this->A.initialize(Arows,Acols,Adata);
@@ -457,7 +540,7 @@ public:
         this->overwriteExtDataFlag = false;
     }
 
-    void computeThinSVD(const SCC::LapackMatrix& A)
+    void computeThinSVD(const LapackMatrixT<T>& A)
     {
         if(not this->overwriteExtDataFlag)
         {
@@ -500,25 +583,25 @@ public:
         long LWORK = -1;
         INFO       = 0;
 
-        double WORKtmp;
-        dgesvd_(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0], U.dataPtr, &LDU, VT.dataPtr, &LDVT,
+        T WORKtmp;
+        LapackTraits<T>::gesvd(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0], U.dataPtr, &LDU, VT.dataPtr, &LDVT,
                &WORKtmp, &LWORK, &INFO);
 
         LWORK = (long)(WORKtmp + 100);
         WORK.resize(LWORK);
 
-        double* WORKptr =    &WORK[0];
+        T* WORKptr =    &WORK[0];
 
         // Second call to create svd
 
         INFO       = 0;
 
-        dgesvd_(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0], U.dataPtr, &LDU, VT.dataPtr, &LDVT,
+        LapackTraits<T>::gesvd(&JOBU, &JOBVT, &M, &N, this->A.dataPtr, &LDA, &singularValues[0], U.dataPtr, &LDU, VT.dataPtr, &LDVT,
                WORKptr, &LWORK, &INFO);
 
         if(INFO != 0)
         {
-        std::cerr << "THIN DGESVD  Failed : INFO = " << INFO  << std::endl;
+        std::cerr << "THIN " << LapackTraits<T>::prefix() << "gesvd  Failed : INFO = " << INFO  << std::endl;
         exit(1);
         }
     }
@@ -535,7 +618,7 @@ public:
 //  This routine is added to avoid the need for extraneous copying
 //  of input matrix data.
 //
-    void computeThinSVD(long Arows, long Acols, double* Adata)
+    void computeThinSVD(long Arows, long Acols, T* Adata)
     {
         this->overwriteExtDataFlag = true;
         this->A.initialize(Arows,Acols,Adata);
@@ -545,10 +628,10 @@ public:
 
     long getSVDdim(){return svdDim;}
 
-    std::vector<double> applyPseudoInverse(std::vector<double>& b, double svdCutoff = -1.0)
+    std::vector<T> applyPseudoInverse(std::vector<T>& b, T svdCutoff = -1.0)
     {
 
-        std::vector<double> x(A.cols,0.0);
+        std::vector<T> x(A.cols,0.0);
 
         svdDim = 0;
 
@@ -567,32 +650,32 @@ public:
         // Construct pseudo-inverse using components of SVD
         //
 
-        std::vector<double> xStar;
+        std::vector<T> xStar;
 
         /*
-        LapackMatrix   Ustar = U.getColSlice(0,svdDim-1);
+        LapackMatrixT<T>   Ustar = U.getColSlice(0,svdDim-1);
         xStar = Ustar.applyTranspose(b);
         */
 
         char TRANS     = 'T';
         long Mstar     = U.rows;
         long Nstar     = svdDim;
-        double ALPHA   = 1.0;
-        double BETA    = 0.0;
+        T ALPHA   = 1.0;
+        T BETA    = 0.0;
         long LDA       = Mstar;
         long INCX      = 1;
         long INCY      = 1;
 
         xStar.resize(svdDim,0.0);
 
-        dgemv_(&TRANS,&Mstar,&Nstar,&ALPHA,U.dataPtr,&LDA,&b[0],&INCX,&BETA,&xStar[0],&INCY);
+        LapackTraits<T>::gemv(&TRANS,&Mstar,&Nstar,&ALPHA,U.dataPtr,&LDA,&b[0],&INCX,&BETA,&xStar[0],&INCY);
 
         for(long i = 0; i < svdDim; i++)
         {
             xStar[i] /= singularValues[i];
         }
 
-        SCC::LapackMatrix Vstar;
+        LapackMatrixT<T> Vstar;
 
         /*
         Vstar = VT.getRowSlice(0,svdDim-1);
@@ -609,7 +692,7 @@ public:
         LDA       = Mstar;
         INCX      = 1;
         INCY      = 1;
-        dgemv_(&TRANS,&Mstar,&Nstar,&ALPHA,VT.dataPtr,&LDA,&xStar[0],&INCX,&BETA,&x[0],&INCY);
+        LapackTraits<T>::gemv(&TRANS,&Mstar,&Nstar,&ALPHA,VT.dataPtr,&LDA,&xStar[0],&INCX,&BETA,&x[0],&INCY);
         }
         else // Extract columns of Vstar as first svdDim rows of VT
         {
@@ -629,23 +712,23 @@ public:
         LDA       = Mstar;
         INCX      = 1;
         INCY      = 1;
-        dgemv_(&TRANS,&Mstar,&Nstar,&ALPHA,Vstar.dataPtr,&LDA,&xStar[0],&INCX,&BETA,&x[0],&INCX);
+        LapackTraits<T>::gemv(&TRANS,&Mstar,&Nstar,&ALPHA,Vstar.dataPtr,&LDA,&xStar[0],&INCX,&BETA,&x[0],&INCX);
         }
 
         return x;
     }
 
-    SCC::LapackMatrix     A;
-    SCC::LapackMatrix     U;
+    LapackMatrixT<T>     A;
+    LapackMatrixT<T>     U;
 
-    std::vector<double> singularValues;
+    std::vector<T> singularValues;
 
-    SCC::LapackMatrix     VT;
+    LapackMatrixT<T>     VT;
 
     char                 JOBU;
     char                JOBVT;
     long                 INFO;
-    std::vector<double>  WORK;
+    std::vector<T>  WORK;
 
     long               svdDim;
     bool overwriteExtDataFlag;
@@ -656,13 +739,17 @@ public:
 // LAPACK base routine description:
 // DSYEV computes all eigenvalues and, optionally, eigenvectors of a
 // real symmetric matrix A.
+//
+// The class is a template, SYEV<T>, with T = double or T = float
+// invoking DSYEV or SSYEV respectively. DSYEV is SYEV<double>.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-class DSYEV
+template <class T>
+class SYEV
 {
 public:
 
-    DSYEV()
+    SYEV()
     {
         JOBZ = 'N';
         UPLO = 'U';            // Using upper triangular part of A
@@ -675,7 +762,7 @@ public:
         JOBZ = 'N';
         UPLO = 'U';            // Using upper triangular part of A
     }
-    void computeEigenvalues(const LapackMatrix& A, std::vector<double>& eigenValues)
+    void computeEigenvalues(const LapackMatrixT<T>& A, std::vector<T>& eigenValues)
     {
         assert(A.sizeCheck(A.rows,A.cols));
 
@@ -684,47 +771,47 @@ public:
         UPLO = 'U';            // Using upper triangular part of A
 
         long N       = A.rows;
-        double* Uptr = U.dataPtr;
+        T* Uptr = U.dataPtr;
 
         long LDA = N;
 
         eigenValues.resize(N);
-        double*Wptr = &eigenValues[0];
+        T*Wptr = &eigenValues[0];
 
         long LWORK = -1;
 
-        double WORKtmp;
+        T WORKtmp;
 
         long INFO = 0;
 
         // First call to get optimal workspace
 
-        dsyev_(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, &WORKtmp, &LWORK, &INFO);
+        LapackTraits<T>::syev(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, &WORKtmp, &LWORK, &INFO);
 
         LWORK = (long)(WORKtmp + 100);
-        std::vector<double>    WORK(LWORK);
-        double* WORKptr =    &WORK[0];
+        std::vector<T>    WORK(LWORK);
+        T* WORKptr =    &WORK[0];
 
         // Second call to create eigensystem
 
-        dsyev_(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, WORKptr, &LWORK, &INFO);
+        LapackTraits<T>::syev(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, WORKptr, &LWORK, &INFO);
 
         if(INFO != 0)
         {
-        std::cerr << "dsyev  Failed : INFO = " << INFO  << std::endl;
+        std::cerr << LapackTraits<T>::prefix() << "syev  Failed : INFO = " << INFO  << std::endl;
         exit(1);
         }
 
     }
 
-    void computeEigensystem(const LapackMatrix& A, std::vector<double>& eigenValues, std::vector < std::vector < double> >& eigenVectors)
+    void computeEigensystem(const LapackMatrixT<T>& A, std::vector<T>& eigenValues, std::vector < std::vector < T> >& eigenVectors)
     {
         assert(A.sizeCheck(A.rows,A.cols));
         computeEigensystem(A,eigenValues, U);
 
         // Pack eigenvectors into return argument
 
-        std::vector <double> eigVector(A.rows);
+        std::vector <T> eigVector(A.rows);
 
         eigenVectors.clear();
         eigenVectors.resize(A.cols,eigVector);
@@ -740,7 +827,7 @@ public:
     }
 
    
-    void computeEigensystem(const LapackMatrix& A, std::vector<double>& eigenValues, LapackMatrix& eigenVectors)
+    void computeEigensystem(const LapackMatrixT<T>& A, std::vector<T>& eigenValues, LapackMatrixT<T>& eigenVectors)
     {
         assert(A.sizeCheck(A.rows,A.cols));
 
@@ -749,45 +836,258 @@ public:
         UPLO = 'U';            // Using upper triangular part of A
 
         long N       = A.rows;
-        double* Uptr = eigenVectors.dataPtr;
+        T* Uptr = eigenVectors.dataPtr;
 
         long LDA = N;
 
         eigenValues.resize(N);
-        double*Wptr = &eigenValues[0];
+        T*Wptr = &eigenValues[0];
 
         long LWORK = -1;
 
-        double WORKtmp;
+        T WORKtmp;
 
         long INFO = 0;
 
         // First call to get optimal workspace
 
-        dsyev_(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, &WORKtmp, &LWORK, &INFO);
+        LapackTraits<T>::syev(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, &WORKtmp, &LWORK, &INFO);
 
         LWORK = (long)(WORKtmp + 100);
-        std::vector<double>    WORK(LWORK);
-        double* WORKptr =    &WORK[0];
+        std::vector<T>    WORK(LWORK);
+        T* WORKptr =    &WORK[0];
 
         // Second call to create eigensystem
 
-        dsyev_(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, WORKptr, &LWORK, &INFO);
+        LapackTraits<T>::syev(&JOBZ,&UPLO,&N, Uptr, &LDA, Wptr, WORKptr, &LWORK, &INFO);
 
         if(INFO != 0)
         {
-        std::cerr << "dsyev  Failed : INFO = " << INFO  << std::endl;
+        std::cerr << LapackTraits<T>::prefix() << "syev  Failed : INFO = " << INFO  << std::endl;
         exit(1);
         }
     }
 
-    LapackMatrix                 U;
-    std::vector<double>  eigValues;
+    LapackMatrixT<T>                 U;
+    std::vector<T>  eigValues;
     char            JOBZ;
     char            UPLO;
 
 };
 
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class SymmetricSpectralOperator : Created for applying functions
+// of a real symmetric matrix A
+//
+//    f(A) = U diag(f(lambda_1), ... ,f(lambda_N)) U**T
+//
+// where the columns of U are the eigenvectors of A and lambda_k the
+// eigenvalues, e.g. (A - sigma I)^(-1), exp(tA), A^(1/2) or A^(-1/2).
+//
+// The eigensystem is computed once using DSYEV, or specified using
+// eigenvalues and eigenvectors obtained from DSYEV::computeEigensystem,
+// and is retained. Each application of f(A) requires two invocations
+// of dgemv (dgemm for a matrix of vectors) and a diagonal scaling, i.e.
+// O(N^2) operations per vector.
+//
+// The apply(...) member functions are const and only use local work
+// arrays, so they may be invoked concurrently from separate threads.
+//
+// The values f(lambda_k) are not checked, so, for example, a shift
+// sigma equal to an eigenvalue, or A^(1/2) of a matrix with a negative
+// eigenvalue, produces non-finite results.
+//
+// The class is a template, SymmetricSpectralOperatorT<T>, with T = double
+// or T = float. SymmetricSpectralOperator is SymmetricSpectralOperatorT<double>.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <class T>
+class SymmetricSpectralOperatorT
+{
+public:
+
+    SymmetricSpectralOperatorT()
+    {
+    initialize();
+    }
+
+    SymmetricSpectralOperatorT(const LapackMatrixT<T>& A)
+    {
+    initialize(A);
+    }
+
+    void initialize()
+    {
+    N = 0;
+    U.initialize();
+    eigValues.clear();
+    }
+
+    // Computes and retains the eigensystem of the symmetric matrix A.
+    // Only the upper triangular part of A is referenced.
+
+    void initialize(const LapackMatrixT<T>& A)
+    {
+    assert(A.sizeCheck(A.rows,A.cols));
+
+    SYEV<T> syev;
+    syev.computeEigensystem(A,eigValues,U);
+    N = A.rows;
+    }
+
+    // Initializes with the eigenvalues and orthonormal eigenvectors
+    // (stored as columns) of a symmetric matrix, e.g. those
+    // obtained with DSYEV::computeEigensystem(...).
+
+    void initialize(const std::vector<T>& eigenValues, const LapackMatrixT<T>& eigenVectors)
+    {
+    assert(eigenVectors.sizeCheck(eigenVectors.rows,eigenVectors.cols));
+    assert(eigenVectors.sizeCheck(eigenVectors.rows,(long)eigenValues.size()));
+
+    N         = eigenVectors.rows;
+    U.initialize(eigenVectors);
+    eigValues = eigenValues;
+    }
+
+    // y = f(A) x
+
+    void apply(const std::function<T(T)>& f, const std::vector<T>& x, std::vector<T>& y) const
+    {
+    assert(U.sizeCheck(N,(long)x.size()));
+    if((long)y.size() != N) {y.resize(N,0.0);}
+    if(N == 0) {return;}
+    apply(f,&x[0],&y[0],1);
+    }
+
+    // Y = f(A) X
+
+    void apply(const std::function<T(T)>& f, const LapackMatrixT<T>& X, LapackMatrixT<T>& Y) const
+    {
+    assert(U.sizeCheck(N,X.rows));
+    if((Y.rows != N)||(Y.cols != X.cols)) {Y.initialize(N,X.cols);}
+    if((N == 0)||(X.cols == 0)) {return;}
+    apply(f,X.dataPtr,Y.dataPtr,X.cols);
+    }
+
+    //
+    // y = f(A) x for NRHS vectors of length N stored contiguously.
+    // x and y may be the same array.
+    //
+    void apply(const std::function<T(T)>& f, const T* x, T* y, long NRHS = 1) const
+    {
+    std::vector<T> fLambda(N);
+    for(long k = 0; k < N; k++) {fLambda[k] = f(eigValues[k]);}
+
+    std::vector<T> W(N*NRHS);
+
+    char TRANS_T = 'T';
+    char TRANS_N = 'N';
+    long Nloc    = N;
+    long Ncols   = NRHS;
+    long LDU     = N;
+    T    ALPHA   = 1.0;
+    T    BETA    = 0.0;
+    T*   Uptr    = U.dataPtr;
+
+    if(NRHS == 1)
+    {
+    long INC = 1;
+
+    // W = U**T x
+
+    LapackTraits<T>::gemv(&TRANS_T,&Nloc,&Nloc,&ALPHA,Uptr,&LDU,const_cast<T*>(x),&INC,&BETA,&W[0],&INC);
+
+    for(long i = 0; i < N; i++) {W[i] *= fLambda[i];}
+
+    // y = U W
+
+    LapackTraits<T>::gemv(&TRANS_N,&Nloc,&Nloc,&ALPHA,Uptr,&LDU,&W[0],&INC,&BETA,y,&INC);
+    return;
+    }
+
+    // W = U**T X
+
+    LapackTraits<T>::gemm(&TRANS_T,&TRANS_N,&Nloc,&Ncols,&Nloc,&ALPHA,Uptr,&LDU,
+                          const_cast<T*>(x),&Nloc,&BETA,&W[0],&Nloc);
+
+    for(long j = 0; j < NRHS; j++)
+    {
+    for(long i = 0; i < N; i++)
+    {
+    W[i + j*N] *= fLambda[i];
+    }}
+
+    // Y = U W
+
+    LapackTraits<T>::gemm(&TRANS_N,&TRANS_N,&Nloc,&Ncols,&Nloc,&ALPHA,Uptr,&LDU,
+                          &W[0],&Nloc,&BETA,y,&Nloc);
+    }
+
+    // y = (A - sigma I)^(-1) x
+
+    void applyShiftedInverse(T sigma, const std::vector<T>& x, std::vector<T>& y) const
+    {
+    apply([sigma](T lambda){return T(1.0)/(lambda - sigma);},x,y);
+    }
+
+    void applyShiftedInverse(T sigma, const LapackMatrixT<T>& X, LapackMatrixT<T>& Y) const
+    {
+    apply([sigma](T lambda){return T(1.0)/(lambda - sigma);},X,Y);
+    }
+
+    // y = exp(t A) x
+
+    void applyExp(T t, const std::vector<T>& x, std::vector<T>& y) const
+    {
+    apply([t](T lambda){return std::exp(t*lambda);},x,y);
+    }
+
+    void applyExp(T t, const LapackMatrixT<T>& X, LapackMatrixT<T>& Y) const
+    {
+    apply([t](T lambda){return std::exp(t*lambda);},X,Y);
+    }
+
+    // y = A^(1/2) x, A positive semi-definite
+
+    void applySqrt(const std::vector<T>& x, std::vector<T>& y) const
+    {
+    apply([](T lambda){return std::sqrt(lambda);},x,y);
+    }
+
+    void applySqrt(const LapackMatrixT<T>& X, LapackMatrixT<T>& Y) const
+    {
+    apply([](T lambda){return std::sqrt(lambda);},X,Y);
+    }
+
+    // y = A^(-1/2) x, A positive definite
+
+    void applyInverseSqrt(const std::vector<T>& x, std::vector<T>& y) const
+    {
+    apply([](T lambda){return T(1.0)/std::sqrt(lambda);},x,y);
+    }
+
+    void applyInverseSqrt(const LapackMatrixT<T>& X, LapackMatrixT<T>& Y) const
+    {
+    apply([](T lambda){return T(1.0)/std::sqrt(lambda);},X,Y);
+    }
+
+    long getDimension() const
+    {
+    return N;
+    }
+
+    const std::vector<T>& getEigenvalues() const
+    {
+    return eigValues;
+    }
+
+    LapackMatrixT<T>          U; // Orthonormal eigenvectors
+    std::vector<T>    eigValues;
+    long                      N;
+};
+
+typedef SymmetricSpectralOperatorT<double> SymmetricSpectralOperator;
+
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 // Class DGESVX : Created for solving general  systems of equations
 // LAPACK base routine description:
@@ -798,13 +1098,28 @@ public:
 //
 // Error bounds on the solution and a condition estimate are also
 // provided.
+//
+// The class is a template, GESVX<T>, for the four LAPACK data types
+//
+// T = double               : DGESVX = GESVX<double>
+// T = float                : SGESVX = GESVX<float>
+// T = std::complex<double> : ZGESVX = GESVX<std::complex<double>>
+// T = std::complex<float>  : CGESVX = GESVX<std::complex<float>>
+//
+// with the LAPACK routine selected at compile time using LapackTraits<T>.
+// Complex data is passed to the RealType* applyInverse(...) member function
+// as alternating real and imaginary parts. The condition number and error
+// estimates are of type RealType.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-class DGESVX
+template <class T>
+class GESVX
 {
 public:
 
-    DGESVX()
+    typedef typename LapackTraits<T>::RealType RealType;
+
+    GESVX()
     {
     initialize();
     }
@@ -819,31 +1134,35 @@ public:
     }
 
 
-    void applyInverse(const LapackMatrix& A,std::vector <double >& b)
+    void applyInverse(const LapackMatrixT<T>& A,std::vector <T>& b)
     {
-            applyInverse(A,&b[0]);
+            assert(A.sizeCheck(A.cols,(long)b.size()));
+            applyInverse(A,reinterpret_cast<RealType*>(&b[0]));
     }
 
-    void applyInverse(const LapackMatrix& A,LapackMatrix& b)
+    void applyInverse(const LapackMatrixT<T>& A,LapackMatrixT<T>& b)
     {
-            applyInverse(A,b.dataPtr,b.cols);
+            assert(A.sizeCheck(A.cols,b.rows));
+            applyInverse(A,b.getDataPointer(),b.cols);
     }
 
-    void applyInverse(const LapackMatrix& A, double* b, long NRHS = 1)
+    void applyInverse(const LapackMatrixT<T>& A, RealType* b, long NRHS = 1)
     {
         assert(A.sizeCheck(A.rows,A.cols));
 
         char FACT  = 'E'; // Equilibrate, then factor
         char TRANS = 'N'; // No transpose
         long N     = A.rows;
+        long nc    = LapackTraits<T>::realComponents;
 
-        // Allocate temporaries
+        // Duplicate input matrix (since the input matrix is
+        // overwritten by the equilibration) and create temporaries
 
         this->A.initialize(A);
         this->AF.initialize(N,N);
 
-        double* Aptr  =  A.dataPtr;
-        double* AFptr = AF.dataPtr;
+        RealType* Aptr  = this->A.getDataPointer();
+        RealType* AFptr = AF.getDataPointer();
 
         long LDA   = N;
         long LDAF  = N;
@@ -853,50 +1172,44 @@ public:
 
         char  EQED;
 
-        std::vector<double>   R(N);
-        double* Rptr  = &R[0];
+        std::vector<RealType>   R(N);
+        RealType* Rptr  = &R[0];
 
-        std::vector<double>    C(N);
-        double* Cptr  =  &C[0];
+        std::vector<RealType>    C(N);
+        RealType* Cptr  =  &C[0];
 
-        std::vector<double>   B(N*NRHS);
-        double* Bptr  =       &B[0];
-        long LDB      =          N;
+        std::vector<RealType>   B(nc*N*NRHS);
+        RealType* Bptr  =      &B[0];
+        long LDB        =          N;
 
 
         // b will be overwritten with the solution
         // so no need to declare X separately
 
-        double* Xptr = b;
-        long LDX     = N;
+        RealType* Xptr = b;
+        long LDX       = N;
 
         FERR.resize(NRHS);
         BERR.resize(NRHS);
 
-        std::vector<double>   WORK(4*N);
-        double* WORKptr = &WORK[0];
-
-        std::vector<long>       IWORK(N);
-        long* IWORKptr  = &IWORK[0];
-
         long   INFO = 0;
 
 
         // Assign right hand side to B
 
-        for(long i = 0; i < N*NRHS; i++)
+        for(long i = 0; i < nc*N*NRHS; i++)
         {
             Bptr[i] = b[i];
         }
 
-        dgesvx_(&FACT, &TRANS, &N, &NRHS, Aptr, &LDA, AFptr, &LDAF, IPIVptr,
+        LapackTraits<T>::gesvx(&FACT, &TRANS, &N, &NRHS, Aptr, &LDA, AFptr, &LDAF, IPIVptr,
                 &EQED, Rptr, Cptr, Bptr,&LDB, Xptr, &LDX, &RCOND,
-                &FERR[0], &BERR[0], WORKptr, IWORKptr, &INFO);
+                &FERR[0], &BERR[0], &INFO);
 
 
         if(INFO != 0)
         {
-        std::cerr << "dgesvx  Failed : INFO = " << INFO  << std::endl;
+        std::cerr << LapackTraits<T>::prefix() << "gesvx  Failed : INFO = " << INFO  << std::endl;
         exit(1);
         }
     }
@@ -910,7 +1223,7 @@ public:
 *  indicated by a return code of INFO > 0.
 */
 
-    double getReciprocalConditionNumber()
+    RealType getReciprocalConditionNumber()
     {
         return RCOND;
     }
@@ -927,12 +1240,12 @@ public:
 *  overestimate of the true error.
 */
 
-    double getSolutionErrorEst()
+    RealType getSolutionErrorEst()
     {
         return FERR[0];
     }
 
-    std::vector<double> getMultipleSolutionErrorEst()
+    std::vector<RealType> getMultipleSolutionErrorEst()
     {
         return FERR;
     }
@@ -943,139 +1256,1306 @@ public:
 *  vector X(j) (i.e., the smallest relative change in
 *   any element of A or B that makes X(j) an exact solution).
 */
-    double getSolutionBackwardErrorEst()
+    RealType getSolutionBackwardErrorEst()
     {
         return BERR[0];
     }
 
-    std::vector<double> getMultipleSolutionBackwardErrorEst()
+    std::vector<RealType> getMultipleSolutionBackwardErrorEst()
     {
         return BERR;
     }
 
 
 
-    double              RCOND;
-    std::vector<double>  FERR;
-    std::vector<double>  BERR;
+    RealType              RCOND;
+    std::vector<RealType>  FERR;
+    std::vector<RealType>  BERR;
 
-    LapackMatrix       A;
-    LapackMatrix      AF;
+    LapackMatrixT<T>       A;
+    LapackMatrixT<T>      AF;
 
 };
 
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
-// Class DPOSV : Created for solving symmetric positive definite systems
-// of equations
-// LAPACK base routine description:
-// DPOSV computes the solution to a real system of linear equations
-//    A * X = B,
-// where A is an N-by-N symmetric positive definite matrix and X and B
-// are N-by-NRHS matrices.
+// Class DPOSV : Created for solving A*X = B using the Cholesky factorization
+//               when A is a symmetric positive definite matrix.
+// LAPACK base routines description:
+// DPOTRF computes the Cholesky factorization of a real symmetric
+// positive definite matrix A.
+// DPOTRS solves a system of linear equations A*X = B with a symmetric
+// positive definite matrix A using the Cholesky factorization
+// A = U**T*U or A = L*L**T computed by DPOTRF.
+// DPOCON estimates the reciprocal of the condition number (in the
+// 1-norm) of a real symmetric positive definite matrix using the
+// Cholesky factorization computed by DPOTRF.
+//
+// The Cholesky factors A = U**T*U (A = U**H*U when A is complex Hermitian)
+// are computed from the upper triangle of A, cached, and then used for
+// any number of subsequent solves with any number of right hand sides.
+// applyInverse(A,B) creates the factors of a copy of A and then solves.
+// No pivoting, equilibration or iterative refinement is performed; use
+// DGESVX when these are required.
+//
+// The reciprocal condition number is computed with DPOCON only when
+// requested. A matrix that is not positive definite, or an error returned
+// by DPOTRF, DPOTRS or DPOCON, results in a std::runtime_error exception.
+//
+// The factors can be created in a copy of the input matrix data, or, to
+// avoid the copy, in place in the data of the input matrix.
+//
+// The class is a template, POSV<T>, for the four LAPACK data types
+//
+// T = double               : DPOSV = POSV<double>
+// T = float                : SPOSV = POSV<float>
+// T = std::complex<double> : ZPOSV = POSV<std::complex<double>>
+// T = std::complex<float>  : CPOSV = POSV<std::complex<float>>
+//
+// with the LAPACK routines selected at compile time using LapackTraits<T>.
+// Complex data is passed to the RealType* member functions as alternating
+// real and imaginary parts.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
-class DPOSV
-{
-public:
 
-    DPOSV()
-    {initialize();}
+template <class T>
+class POSV
+{
+	public:
+
+    typedef typename LapackTraits<T>::RealType RealType;
+
+	POSV()
+	{
+	initialize();
+	}
+
+	POSV(const POSV& posv)
+	{
+	initialize(posv);
+	}
+
+	void initialize()
+	{
+	UPLO  = 'U';
+	N     = 0;
+	ANORM = 0.0;
+	RCOND = -1.0;
+	Afactors.initialize();
+	}
+
+	void initialize(const POSV& posv)
+	{
+	UPLO  = posv.UPLO;
+	N     = posv.N;
+	ANORM = posv.ANORM;
+	RCOND = posv.RCOND;
+	Afactors.initialize(posv.Afactors);
+	}
+
+	void applyInverse(const LapackMatrixT<T>& A, std::vector<T>& f)
+	{
+	createFactors(A);
+	applyInverse(f);
+	}
+
+	void applyInverse(const LapackMatrixT<T>& A, LapackMatrixT<T>& F)
+	{
+	createFactors(A);
+	applyInverse(F);
+	}
+
+	void applyInverse(const LapackMatrixT<T>& A, RealType* f, long NRHS = 1)
+	{
+	createFactors(A);
+	applyInverse(f,NRHS);
+	}
+
+	void applyInverse(std::vector<T>& f)
+	{
+	assert(sizeCheck((long)f.size(),1));
+	applyInverse(reinterpret_cast<RealType*>(&f[0]));
+	}
+
+	void applyInverse(LapackMatrixT<T>& F)
+	{
+	assert(sizeCheck(F.rows,F.cols));
+	applyInverse(F.getDataPointer(),F.cols);
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions.
+	//
+	void applyInverse(RealType* f, long NRHS = 1)
+	{
+    long LDA  = N;
+    long LDB  = N;
+    long INFO = 0;
 
-    void initialize(){}
+    LapackTraits<T>::potrs(&UPLO, &N, &NRHS, Afactors.getDataPointer(), &LDA, f, &LDB, &INFO);
 
-    void applyInverse(const LapackMatrix& A,std::vector <double >& b)
+    if(INFO != 0)
     {
-            applyInverse(A,&b[0]);
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "potrs \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
     }
+	}
+
+	//
+	// Creates the Cholesky factors of a copy of A.
+	//
+	void createFactors(const LapackMatrixT<T>& A)
+	{
+	if(A.rows != A.cols)
+	{
+		throw std::runtime_error("\nPOSV : Non-square matrix input argument  \n");
+	}
+	Afactors.initialize(A);
+	factor();
+	}
+
+	//
+	// Creates the Cholesky factors in place.
+	//
+	// !!! Important: Adata, the N x N matrix data stored by columns
+	// (with alternating real and imaginary parts when T is complex),
+	// e.g. A.getDataPointer() for a LapackMatrixT<T> A, has its upper
+	// triangle overwritten by the factors and must remain allocated while
+	// the factors are in use. No bounds checking is performed.
+	//
+	void createFactors(long N, RealType* Adata)
+	{
+	Afactors.initialize();  // release any locally allocated factors before adopting Adata
+	Afactors.initialize(N,N,Adata);
+	factor();
+	}
+
+	//
+	// Returns an estimate of the reciprocal of the condition number (in the 1-norm)
+	// of the factored matrix. The estimate is computed on first request.
+	//
+	RealType getReciprocalCondNumber()
+	{
+	if(RCOND >= 0.0) {return RCOND;}
 
-    void applyInverse(const LapackMatrix& A,LapackMatrix& b)
+    long LDA  = N;
+    long INFO = 0;
+
+    LapackTraits<T>::pocon(&UPLO, &N, Afactors.getDataPointer(), &LDA, &ANORM, &RCOND, &INFO);
+
+    if(INFO != 0)
     {
-            applyInverse(A,b.dataPtr,b.cols);
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "pocon \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
     }
+    return RCOND;
+	}
 
-    void applyInverse(const LapackMatrix& A, double* b, long NRHS = 1)
+	long getDimension() const
+	{
+	return N;
+	}
+
+#ifdef _DEBUG
+    bool sizeCheck(long rows, long cols) const
     {
-        assert(A.sizeCheck(A.rows,A.cols));
+    if((rows != N) || (cols < 1))
+    {
+    std::cerr  <<  "POSV error                              "  << "\n";
+    std::cerr  <<  "Right hand side must have N rows        "  << "\n";
+    std::cerr  <<  "N    : "  << N    << "\n";
+    std::cerr  <<  "rows : "  << rows << "\n";
+    std::cerr  <<  "cols : "  << cols << "\n";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool sizeCheck(long, long) const {return true;}
+#endif
 
-        char UPLO  = 'U'; // A = U**T* U
-        long N     = A.rows;
+	char       UPLO;
+	long          N;
+	RealType  ANORM;
+	RealType  RCOND;
 
-        double* Aptr  =  A.dataPtr;
+    // For caching factors
 
-        long LDA    = N;
-        double* Bptr = b;
-        long LDB    = N;
-        long   INFO = 0;
+	LapackMatrixT<T> Afactors;
 
-        dposv_(&UPLO, &N, &NRHS,Aptr,&LDA,Bptr,&LDB,&INFO);
+	private:
 
-        if(INFO != 0)
-        {
-        std::cerr << "dposv Failed : INFO = " << INFO  << std::endl;
-        exit(1);
-        }
+	void factor()
+	{
+    N = Afactors.rows;
+
+    long LDA  = N;
+    long INFO = 0;
+
+    // 1-norm of A, required for condition number estimates, is
+    // computed from the upper triangle prior to overwriting A with its
+    // factors (the imaginary parts of the diagonal are assumed zero)
+
+    std::vector<RealType> colSum(N,0.0);
+    RealType a;
+    for(long j = 0; j < N; j++)
+    {
+    for(long i = 0; i < j; i++)
+    {
+    a          = std::abs(Afactors(i,j));
+    colSum[i] += a;
+    colSum[j] += a;
+    }
+    colSum[j] += std::abs(std::real(Afactors(j,j)));
+    }
+
+    ANORM = 0.0;
+    for(long j = 0; j < N; j++) {ANORM = (colSum[j] > ANORM) ? colSum[j] : ANORM;}
+    RCOND = -1.0;
+
+    LapackTraits<T>::potrf(&UPLO, &N, Afactors.getDataPointer(), &LDA, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "potrf \nError INFO = " << INFO << "\n";
+    	if(INFO > 0) {sout << "Matrix is not positive definite \n";}
+    	throw std::runtime_error(sout.str());
     }
+	}
 };
 
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
-// Class NORMALEQ creates the solution of the normal equations with the singular value
-// parameter cut-off value svdCutoff. Since the singular values of the normal
-// equations are square roots of the eigenvalues of the normal equations, the
-// accuracy of the solution is limited to problems where it is sufficient to
-// construct a solution using singular vector components associated with
-// singular values where (singular values)^2 > accuracy of the
-// eigensystem routine. Typically this limits the application to problems where
-// svdCutoff is approximately > 1.0e-07. The returned solution can only be
-// expected to have single precision accuracy for the same reasons.
+// Class DGESV : Created for solving general systems of equations
+// using the LU factors of A without equilibration or iterative refinement.
+// LAPACK base routines description:
+// DGETRF computes an LU factorization of a general M-by-N matrix A
+// using partial pivoting with row interchanges.
+// DGETRS solves a system of linear equations A * X = B or A**T * X = B
+// with a general N-by-N matrix A using the LU factorization computed
+// by DGETRF.
+// DGECON estimates the reciprocal of the condition number of a general
+// real matrix A, in either the 1-norm or the infinity-norm, using
+// the LU factorization computed by DGETRF.
 //
-// In the implementation below, the solution components are only accumulated
-// when the singular values are greater than the max(svdCutoff).
+// The factors are created with createFactors(...) and re-used by each
+// applyInverse(...) invocation, for any number of right hand sides.
+// createFactors(A) copies A into the factor array, re-using its
+// allocation when the matrix size does not change, while
+// createFactors(N,Adata) overwrites the data of A with its factors.
+// The reciprocal condition number is computed with DGECON on the first
+// request after the factors are created.
 //
-// When M < N, so the solution is underdetermined, the minimum L2
-// norm solution is returned and only M approximate singular
-// values are computed.
+// Use DGESVX when equilibration, refinement or error estimates are required.
+//
+// The class is a template, GESV<T>, with T = double or T = float
+// invoking the d or s prefixed routines respectively. DGESV is GESV<double>.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
-class NORMALEQ
+
+template <class T>
+class GESV
 {
 public:
 
-    NORMALEQ()
+    GESV()
     {
     initialize();
-    };
+    }
+
+    GESV(const GESV& gesv)
+    {
+    initialize(gesv);
+    }
 
     void initialize()
     {
-    bStar.clear();
-    bBar.clear();
-    ABnormal.initialize();
+    LU.initialize();
+    IPIV.clear();
+    N     = 0;
+    ANORM = 0.0;
+    RCOND = -1.0;
+    }
 
-    diagonalizer.initialize();
-    eigenValues.clear();
-    eigenVectors.initialize();
+    void initialize(const GESV& gesv)
+    {
+    LU.initialize(gesv.LU);
+    IPIV  = gesv.IPIV;
+    N     = gesv.N;
+    ANORM = gesv.ANORM;
+    RCOND = gesv.RCOND;
+    }
 
-    singularValues.clear();
-    svdDim = 0;
+    void createFactors(const LapackMatrixT<T>& A)
+    {
+    assert(A.sizeCheck(A.rows,A.cols));
+    LU.initialize(A);
+    factor();
     }
 
-    long getSVDdim(){return svdDim;}
+//
+//  In this call, the matrix is passed via a pointer to the
+//  N x N matrix data assumed to be stored with the Fortran convention
+//  by columns.
+//
+//  !!! Important: the input matrix data is overwritten by the LU factors
+//  and must not be modified while the factors are in use.
+//
+    void createFactors(long N, T* Adata)
+    {
+    LU.initialize();  // release any locally allocated factors before adopting Adata
+    LU.initialize(N,N,Adata);
+    factor();
+    }
 
+    void applyInverse(const LapackMatrixT<T>& A, std::vector<T>& b)
+    {
+    createFactors(A);
+    applyInverse(&b[0]);
+    }
 
-    // Normal equation solution of
-    //
-    // A*x = b
-    //
-    // with svdCutoff.
-    //
-    // Only components with singular values > svdCutoff or 1.0e-07 are accumulated.
-    //
-    // When A is M x N and M < N, then only M singular values are evaluated.
-    //
-    //
-    std::vector<double> computeNormalEquationSolution(std::vector<double>& b, LapackMatrix& AB, double svdCutoff)
+    void applyInverse(const LapackMatrixT<T>& A, LapackMatrixT<T>& B)
     {
-        // Form right hand side
+    createFactors(A);
+    applyInverse(B);
+    }
 
-        bBar = AB.applyTranspose(b);
+    void applyInverse(std::vector<T>& b)
+    {
+    assert(LU.sizeCheck(N,(long)b.size()));
+    applyInverse(&b[0]);
+    }
+
+    void applyInverse(LapackMatrixT<T>& B)
+    {
+    assert(LU.sizeCheck(N,B.rows));
+    applyInverse(B.dataPtr,B.cols);
+    }
+
+//
+//  Overwrites the N x NRHS array b, stored by columns, with the
+//  solution of A*X = b, or of A**T*X = b if trans = 'T'.
+//
+    void applyInverse(T* b, long NRHS = 1, char trans = 'N')
+    {
+    char TRANS = trans;
+    long LDA   = N;
+    long LDB   = N;
+    long INFO  = 0;
+
+    LapackTraits<T>::getrs(&TRANS, &N, &NRHS, LU.dataPtr, &LDA, &IPIV[0], b, &LDB, &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "getrs Error \n";
+        sout << -INFO << " argument had an illegal value \n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+
+    void applyInverseTranspose(T* b, long NRHS = 1)
+    {
+    applyInverse(b,NRHS,'T');
+    }
+
+/*
+*  The estimate of the reciprocal of the condition number of A
+*  in the 1-norm. The value is computed from the LU factors on the
+*  first invocation after the factors are created.
+*/
+    T getReciprocalConditionNumber()
+    {
+    if(RCOND < 0.0)
+    {
+    char NORM  = '1';
+    long LDA   = N;
+    long INFO  = 0;
+
+    LapackTraits<T>::gecon(&NORM, &N, LU.dataPtr, &LDA, &ANORM, &RCOND, &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "gecon Error \n";
+        sout << -INFO << " argument had an illegal value \n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+    return RCOND;
+    }
+
+    LapackMatrixT<T>   LU;
+    std::vector<long>  IPIV;
+
+    long       N;
+    T      ANORM;
+    T      RCOND;
+
+private:
+
+    //
+    // Factors the matrix data in LU. The 1-norm of A, required for
+    // the condition number estimate, is computed before the data
+    // is overwritten.
+    //
+    void factor()
+    {
+    N = LU.rows;
+    IPIV.resize(N);
+
+    ANORM = 0.0;
+    T colSum;
+    for(long j = 0; j < N; j++)
+    {
+        colSum = 0.0;
+        for(long i = 0; i < N; i++) {colSum += std::abs(LU.dataPtr[i + j*N]);}
+        ANORM = (colSum > ANORM) ? colSum : ANORM;
+    }
+    RCOND = -1.0;
+
+    long LDA  = N;
+    long INFO = 0;
+
+    LapackTraits<T>::getrf(&N, &N, LU.dataPtr, &LDA, &IPIV[0], &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "getrf Error \n";
+        if(INFO < 0) {sout << -INFO << " argument had an illegal value \n";}
+        if(INFO > 0) {sout << "Matrix is singular: U(" << INFO-1 << "," << INFO-1 << ") = 0 \n";}
+        throw std::runtime_error(sout.str());
+    }
+    }
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSYSV : Created for solving symmetric indefinite systems of
+// equations, e.g. saddle point (KKT) systems, using cached
+// Bunch-Kaufman factors.
+// LAPACK base routines description:
+// DSYTRF computes the factorization of a real symmetric matrix A using
+// the Bunch-Kaufman diagonal pivoting method.  The form of the
+// factorization is
+//
+//    A = U**T*D*U  or  A = L*D*L**T
+//
+// where U (or L) is a product of permutation and unit upper (lower)
+// triangular matrices, and D is symmetric and block diagonal with
+// 1-by-1 and 2-by-2 diagonal blocks.
+// DSYTRS solves a system of linear equations A*X = B with a real
+// symmetric matrix A using the factorization A = U**T*D*U or
+// A = L*D**L**T computed by DSYTRF.
+//
+// Only the upper triangular part of A is referenced. The factors and
+// pivots are created with createFactors(...) and re-used by each
+// applyInverse(...) invocation, for any number of right hand sides.
+//
+// By Sylvester's law of inertia, the numbers of positive, negative and
+// zero eigenvalues of A are those of D, and are returned by
+// getInertia(...) without additional factorization cost.
+//
+// If D is exactly singular the factors are retained, so that the inertia
+// is available, while applyInverse(...) throws an exception.
+//
+// The class is a template, SYSV<T>, with T = double or T = float
+// invoking the d or s prefixed routines respectively. DSYSV is SYSV<double>.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <class T>
+class SYSV
+{
+public:
+
+    SYSV()
+    {
+    initialize();
+    }
+
+    SYSV(const SYSV& sysv)
+    {
+    initialize(sysv);
+    }
+
+    void initialize()
+    {
+    LD.initialize();
+    IPIV.clear();
+    WORK.clear();
+    N    = 0;
+    INFO = 0;
+    }
+
+    void initialize(const SYSV& sysv)
+    {
+    LD.initialize(sysv.LD);
+    IPIV = sysv.IPIV;
+    WORK.clear();
+    N    = sysv.N;
+    INFO = sysv.INFO;
+    }
+
+    void createFactors(const LapackMatrixT<T>& A)
+    {
+    assert(A.sizeCheck(A.rows,A.cols));
+    LD.initialize(A);
+    factor();
+    }
+
+//
+//  In this call, the matrix is passed via a pointer to the
+//  N x N matrix data assumed to be stored with the Fortran convention
+//  by columns.
+//
+//  !!! Important: the upper triangular part of the input matrix data
+//  is overwritten by the factors and must not be modified while the
+//  factors are in use.
+//
+    void createFactors(long N, T* Adata)
+    {
+    LD.initialize();  // release any locally allocated factors before adopting Adata
+    LD.initialize(N,N,Adata);
+    factor();
+    }
+
+    void applyInverse(const LapackMatrixT<T>& A, std::vector<T>& b)
+    {
+    createFactors(A);
+    applyInverse(&b[0]);
+    }
+
+    void applyInverse(const LapackMatrixT<T>& A, LapackMatrixT<T>& B)
+    {
+    createFactors(A);
+    applyInverse(B);
+    }
+
+    void applyInverse(std::vector<T>& b)
+    {
+    assert(LD.sizeCheck(N,(long)b.size()));
+    applyInverse(&b[0]);
+    }
+
+    void applyInverse(LapackMatrixT<T>& B)
+    {
+    assert(LD.sizeCheck(N,B.rows));
+    applyInverse(B.dataPtr,B.cols);
+    }
+
+//
+//  Overwrites the N x NRHS array b, stored by columns, with the
+//  solution of A*X = b.
+//
+    void applyInverse(T* b, long NRHS = 1)
+    {
+    if(INFO > 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "sytrs Error \n";
+        sout << "Matrix is singular: D(" << INFO-1 << "," << INFO-1 << ") = 0 \n";
+        throw std::runtime_error(sout.str());
+    }
+
+    char UPLO  = 'U';
+    long LDA   = N;
+    long LDB   = N;
+    long INFOs = 0;
+
+    LapackTraits<T>::sytrs(&UPLO, &N, &NRHS, LD.dataPtr, &LDA, &IPIV[0], b, &LDB, &INFOs);
+
+    if(INFOs != 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "sytrs Error \n";
+        sout << -INFOs << " argument had an illegal value \n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+
+//
+//  Returns the number of positive, negative and zero eigenvalues of A
+//  using the eigenvalues of the 1x1 and 2x2 blocks of D. Eigenvalues
+//  with magnitude less than or equal to zeroTol*max|lambda(D)| are
+//  counted as zero.
+//
+    void getInertia(long& positiveCount, long& negativeCount, long& zeroCount, T zeroTol = 0.0) const
+    {
+    std::vector<T> dEig = getBlockEigenvalues();
+
+    T dMax = 0.0;
+    for(long k = 0; k < N; k++) {dMax = (std::abs(dEig[k]) > dMax) ? std::abs(dEig[k]) : dMax;}
+
+    T tol = zeroTol*dMax;
+
+    positiveCount = 0;
+    negativeCount = 0;
+    zeroCount     = 0;
+
+    for(long k = 0; k < N; k++)
+    {
+        if     (std::abs(dEig[k]) <= tol) {zeroCount++;}
+        else if(dEig[k] > 0.0)            {positiveCount++;}
+        else                              {negativeCount++;}
+    }
+    }
+
+//
+//  Returns the eigenvalues of the block diagonal matrix D. With UPLO = 'U'
+//  a 2x2 block occupies rows and columns k, k+1 when IPIV(k) = IPIV(k+1) < 0
+//  (0 based indexing), its off-diagonal element being stored in LD(k,k+1).
+//
+    std::vector<T> getBlockEigenvalues() const
+    {
+    std::vector<T> dEig(N,0.0);
+    T a; T b; T c; T m; T r;
+
+    long k = 0;
+    while(k < N)
+    {
+        if(IPIV[k] > 0)
+        {
+            dEig[k] = LD(k,k);
+            k += 1;
+        }
+        else
+        {
+            a = LD(k,k);
+            b = LD(k,k+1);
+            c = LD(k+1,k+1);
+            m = 0.5*(a + c);
+            r = std::sqrt(0.25*(a - c)*(a - c) + b*b);
+            dEig[k]   = m + r;
+            dEig[k+1] = m - r;
+            k += 2;
+        }
+    }
+    return dEig;
+    }
+
+    bool isSingular() const
+    {
+    return (INFO > 0);
+    }
+
+    LapackMatrixT<T>        LD;
+    std::vector<long>     IPIV;
+    std::vector<T>        WORK;
+
+    long     N;
+    long  INFO;
+
+private:
+
+    void factor()
+    {
+    N = LD.rows;
+    IPIV.resize(N);
+
+    char UPLO  = 'U';
+    long LDA   = N;
+    long LWORK = -1;
+    INFO       = 0;
+
+    // Query to obtain optimal work array size. The work array is
+    // retained for subsequent factorizations of the same size.
+
+    T WORKtmp;
+    LapackTraits<T>::sytrf(&UPLO, &N, LD.dataPtr, &LDA, &IPIV[0], &WORKtmp, &LWORK, &INFO);
+
+    LWORK = (long)(WORKtmp + 100);
+    if((long)WORK.size() < LWORK) {WORK.resize(LWORK);}
+    LWORK = (long)WORK.size();
+
+    INFO = 0;
+    LapackTraits<T>::sytrf(&UPLO, &N, LD.dataPtr, &LDA, &IPIV[0], &WORK[0], &LWORK, &INFO);
+
+    if(INFO < 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "sytrf Error \n";
+        sout << -INFO << " argument had an illegal value \n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSHIFTSV : Created for solving the shifted systems
+//
+//    (A - sigma I) X = B
+//
+// for a sequence of shifts sigma with the same matrix A, e.g. the
+// systems that arise in frequency response computations.
+//
+// A is reduced once to upper Hessenberg form A = Q*H*Q**T using the
+// LAPACK routine DGEHRD and Q is retained in the factored form returned
+// by DGEHRD. For each shift, H - sigma I is factored with the banded LU
+// routine DGBTRF (one sub-diagonal) and the solution is obtained with
+// DGBTRS and DORMHR. After the O(N^3) reduction each shift requires
+// O(N^2) operations, rather than the O(N^3) operations of a general
+// LU factorization.
+//
+// The applyShiftedInverse(...) member functions are const and only use
+// local work arrays, so they may be invoked concurrently from separate
+// threads. The shifts of a multiple shift invocation are split into
+// threadCount contiguous slices that are processed concurrently using
+// std::thread, each thread using its own work arrays. If threadCount <= 0
+// then std::thread::hardware_concurrency() threads are used.
+//
+// The class is a template, SHIFTSV<T>, with T = double or
+// T = std::complex<double> invoking the d or z prefixed routines
+// respectively (ZUNMHR replaces DORMHR for complex data). DSHIFTSV is
+// SHIFTSV<double>. ZSHIFTSV, SHIFTSV<std::complex<double>>, is defined
+// in SCC_LapackMatrixRoutinesCmplx16.h and is used for complex shifts
+// of a real matrix A.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <class T>
+class SHIFTSV
+{
+public:
+
+    typedef typename LapackTraits<T>::RealType RealType;
+
+    SHIFTSV()
+    {
+    initialize();
+    }
+
+    SHIFTSV(const LapackMatrixT<T>& A)
+    {
+    initialize(A);
+    }
+
+    void initialize()
+    {
+    N = 0;
+    H.initialize();
+    TAU.clear();
+    }
+
+    // Reduces A to upper Hessenberg form. The input matrix is not altered.
+
+    void initialize(const LapackMatrixT<T>& A)
+    {
+    assert(A.sizeCheck(A.rows,A.cols));
+
+    N = A.rows;
+    H.initialize(A);
+    TAU.clear();
+    TAU.resize(std::max(N-1,(long)1),T(0.0));
+
+    if(N == 0) {return;}
+
+    long ILO   = 1;
+    long IHI   = N;
+    long LDA   = N;
+    long LWORK = -1;
+    long INFO  = 0;
+
+    // Query to obtain optimal work array size
+
+    T WORKtmp;
+    LapackTraits<T>::gehrd(&N, &ILO, &IHI, H.getDataPointer(), &LDA, reinterpret_cast<RealType*>(&TAU[0]),
+                           reinterpret_cast<RealType*>(&WORKtmp), &LWORK, &INFO);
+
+    LWORK = std::max((long)std::real(WORKtmp),(long)1);
+    std::vector<T> WORK(LWORK);
+
+    LapackTraits<T>::gehrd(&N, &ILO, &IHI, H.getDataPointer(), &LDA, reinterpret_cast<RealType*>(&TAU[0]),
+                           reinterpret_cast<RealType*>(&WORK[0]), &LWORK, &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << "gehrd \nError INFO = " << INFO << "\n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+
+    // f := (A - sigma I)^(-1) f
+
+    void applyShiftedInverse(T sigma, std::vector<T>& f) const
+    {
+    assert(H.sizeCheck(N,(long)f.size()));
+    applyShiftedInverse(sigma,reinterpret_cast<RealType*>(&f[0]),1);
+    }
+
+    // F := (A - sigma I)^(-1) F
+
+    void applyShiftedInverse(T sigma, LapackMatrixT<T>& F) const
+    {
+    assert(H.sizeCheck(N,F.rows));
+    applyShiftedInverse(sigma,F.getDataPointer(),F.cols);
+    }
+
+    //
+    // Complex data is passed as alternating real and imaginary parts
+    //
+    void applyShiftedInverse(T sigma, RealType* f, long NRHS = 1) const
+    {
+    if(N == 0) {return;}
+
+    applyQ(adjointTrans(),f,NRHS);
+
+    std::vector<T>    AB;
+    std::vector<long> IPIV;
+
+    long INFO = hessenbergSolve(sigma,f,NRHS,AB,IPIV);
+    if(INFO != 0) {throwSingular(sigma,INFO);}
+
+    applyQ('N',f,NRHS);
+    }
+
+    //
+    // Column k of X is set to (A - shifts[k] I)^(-1) b.
+    //
+    // Q**T b (Q**H b) is computed once and Q is applied to all of
+    // the columns of X with a single invocation. The shifts are
+    // processed concurrently using threadCount threads.
+    //
+    void applyShiftedInverse(const std::vector<T>& shifts, const std::vector<T>& b, LapackMatrixT<T>& X,
+                             long threadCount = 0) const
+    {
+    assert(H.sizeCheck(N,(long)b.size()));
+
+    long K = (long)shifts.size();
+    X.initialize(N,K);
+
+    if((N == 0)||(K == 0)) {return;}
+
+    std::vector<T> c(b);
+    applyQ(adjointTrans(),reinterpret_cast<RealType*>(&c[0]),1);
+
+    T* Xptr = reinterpret_cast<T*>(X.getDataPointer());
+    std::vector<long> INFO(K,0);
+
+    threadCount = getSliceThreadCount(threadCount,K);
+
+    auto solveSlice = [&](long s)
+    {
+    std::vector<T>    AB;
+    std::vector<long> IPIV;
+
+    for(long k = (s*K)/threadCount; k < ((s+1)*K)/threadCount; k++)
+    {
+    std::copy(c.begin(),c.end(),Xptr + k*N);
+    INFO[k] = hessenbergSolve(shifts[k],reinterpret_cast<RealType*>(Xptr + k*N),1,AB,IPIV);
+    }
+    };
+
+    std::vector<std::thread> threads;
+    for(long s = 1; s < threadCount; s++) {threads.emplace_back(solveSlice,s);}
+    solveSlice(0);
+    for(auto& t : threads) {t.join();}
+
+    for(long k = 0; k < K; k++)
+    {
+    if(INFO[k] != 0) {throwSingular(shifts[k],INFO[k]);}
+    }
+
+    applyQ('N',X.getDataPointer(),K);
+    }
+
+    long getDimension() const
+    {
+    return N;
+    }
+
+    LapackMatrixT<T>    H; // Upper Hessenberg matrix with the Householder vectors defining Q below the sub-diagonal
+    std::vector<T>    TAU; // Householder scalar factors of Q
+    long                N;
+
+private:
+
+    static char adjointTrans()
+    {
+    return (LapackTraits<T>::realComponents == 1) ? 'T' : 'C';
+    }
+
+    static long getSliceThreadCount(long threadCount, long taskCount)
+    {
+    if(threadCount <= 0)        {threadCount = (long)std::thread::hardware_concurrency();}
+    if(threadCount > taskCount) {threadCount = taskCount;}
+    if(threadCount < 1)         {threadCount = 1;}
+    return threadCount;
+    }
+
+    //
+    // Solves (H - sigma I) Y = F using a banded LU factorization with one
+    // sub-diagonal. The work arrays AB and IPIV are supplied by the caller,
+    // and are re-used by a thread across the shifts it processes, so that
+    // concurrent invocations are independent. Returns the INFO value of the
+    // LAPACK routines.
+    //
+    long hessenbergSolve(T sigma, RealType* f, long NRHS, std::vector<T>& AB, std::vector<long>& IPIV) const
+    {
+    long M     = N;
+    long Nloc  = N;
+    long KL    = 1;
+    long KU    = std::max(N-1,(long)0);
+    long LDAB  = 2*KL + KU + 1;
+    long LDB   = N;
+    long INFO  = 0;
+    char TRANS = 'N';
+
+    // Band storage : H(i,j) is located at AB[KL + KU + i - j + j*LDAB],
+    // the first KL rows are used for fill-in created by row interchanges
+
+    AB.assign(LDAB*N,T(0.0));
+    IPIV.assign(N,0);
+
+    for(long j = 0; j < N; j++)
+    {
+    for(long i = std::max((long)0,j-KU); i <= std::min(N-1,j+1); i++)
+    {
+    AB[KL + KU + i - j + j*LDAB] = H(i,j);
+    }
+    AB[KL + KU + j*LDAB] -= sigma;
+    }
+
+    LapackTraits<T>::gbtrf(&M, &Nloc, &KL, &KU, reinterpret_cast<RealType*>(&AB[0]), &LDAB, &IPIV[0], &INFO);
+
+    if(INFO != 0) {return INFO;}
+
+    LapackTraits<T>::gbtrs(&TRANS, &Nloc, &KL, &KU, &NRHS, reinterpret_cast<RealType*>(&AB[0]), &LDAB,
+                           &IPIV[0], f, &LDB, &INFO);
+    return INFO;
+    }
+
+    // C := Q*C or C := Q**T*C (Q**H*C)
+
+    void applyQ(char TRANS, RealType* C, long NRHS) const
+    {
+    char SIDE  = 'L';
+    long M     = N;
+    long Ncols = NRHS;
+    long ILO   = 1;
+    long IHI   = N;
+    long LDA   = N;
+    long LDC   = N;
+    long LWORK = -1;
+    long INFO  = 0;
+
+    RealType* Hptr   = H.getDataPointer();
+    RealType* TAUptr = reinterpret_cast<RealType*>(const_cast<T*>(&TAU[0]));
+
+    // Query to obtain optimal work array size
+
+    T WORKtmp;
+    mhr((T*)nullptr, &SIDE, &TRANS, &M, &Ncols, &ILO, &IHI, Hptr, &LDA, TAUptr, C, &LDC,
+        reinterpret_cast<RealType*>(&WORKtmp), &LWORK, &INFO);
+
+    LWORK = std::max((long)std::real(WORKtmp),(long)1);
+    std::vector<T> WORK(LWORK);
+
+    mhr((T*)nullptr, &SIDE, &TRANS, &M, &Ncols, &ILO, &IHI, Hptr, &LDA, TAUptr, C, &LDC,
+        reinterpret_cast<RealType*>(&WORK[0]), &LWORK, &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\n" << LapackTraits<T>::prefix() << ((LapackTraits<T>::realComponents == 1) ? "ormhr" : "unmhr");
+        sout << " \nError INFO = " << INFO << "\n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+
+    // Selection of dormhr or zunmhr
+
+    static void mhr(double*, char* SIDE, char* TRANS, long* M, long* N, long* ILO, long* IHI, double* A, long* LDA,
+                    double* TAU, double* C, long* LDC, double* WORK, long* LWORK, long* INFO)
+    {LapackTraits<double>::ormhr(SIDE,TRANS,M,N,ILO,IHI,A,LDA,TAU,C,LDC,WORK,LWORK,INFO);}
+
+    static void mhr(std::complex<double>*, char* SIDE, char* TRANS, long* M, long* N, long* ILO, long* IHI, double* A, long* LDA,
+                    double* TAU, double* C, long* LDC, double* WORK, long* LWORK, long* INFO)
+    {LapackTraits< std::complex<double> >::unmhr(SIDE,TRANS,M,N,ILO,IHI,A,LDA,TAU,C,LDC,WORK,LWORK,INFO);}
+
+    void throwSingular(T sigma, long INFO) const
+    {
+    std::stringstream sout;
+    sout << "\n" << LapackTraits<T>::prefix() << "shiftsv \n";
+    sout << "A - sigma I is singular for sigma = " << sigma << "\n";
+    sout << "Error INFO = " << INFO << "\n";
+    throw std::runtime_error(sout.str());
+    }
+};
+
+typedef GESVD<double>  DGESVD;
+typedef SYEV<double>    DSYEV;
+typedef GESVX<double>  DGESVX;
+typedef POSV<double>    DPOSV;
+typedef GESV<double>    DGESV;
+typedef SYSV<double>    DSYSV;
+typedef SHIFTSV<double> DSHIFTSV;
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSGESV : Created for solving general systems of equations
+// using a single precision LU factorization and double precision
+// iterative refinement.
+//
+// For matrices that are not too ill-conditioned (condition number
+// well below 1/(single precision epsilon) ~ 10^7) the solution has the
+// same accuracy as that obtained with DGESVX, while the O(N^3)
+// factorization is carried out in single precision and the factors
+// occupy half of the memory.
+//
+// If the refinement does not converge, or the matrix cannot be
+// represented or factored in single precision, the solution is
+// computed using a double precision LU factorization. The return
+// value of getIterationCount() and getDoublePrecisionFallback()
+// indicate which of the two took place.
+//
+// The interface is that of DGESVX, i.e. the input matrix A is not
+// modified and b is overwritten with the solution. The double precision
+// copy of A required by DSGESV is local to applyInverse(...) and released
+// when the solve is complete. Errors returned by DSGESV result in a
+// std::runtime_error exception.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class DSGESV
+{
+public:
+
+    DSGESV()
+    {
+    initialize();
+    }
+
+    void initialize()
+    {
+    ITER = 0;
+    }
+
+    void applyInverse(const LapackMatrix& A,std::vector <double >& b)
+    {
+            applyInverse(A,&b[0]);
+    }
+
+    void applyInverse(const LapackMatrix& A,LapackMatrix& b)
+    {
+            applyInverse(A,b.dataPtr,b.cols);
+    }
+
+    void applyInverse(const LapackMatrix& A, double* b, long NRHS = 1)
+    {
+        assert(A.sizeCheck(A.rows,A.cols));
+
+        long N     = A.rows;
+
+        // dsgesv overwrites A with the double precision LU factors
+        // when the refinement fails, so a copy is used. The copy is
+        // local so that it is released when the solve is complete.
+
+        LapackMatrix Awork(A);
+
+        double* Aptr  =  Awork.dataPtr;
+        long LDA      =  N;
+
+        std::vector <long >   IPIV(N);
+        long* IPIVptr = &IPIV[0];
+
+        std::vector<double>   B(b, b + N*NRHS);
+        double* Bptr  = &B[0];
+        long LDB      =  N;
+
+        // b will be overwritten with the solution
+
+        double* Xptr  =  b;
+        long LDX      =  N;
+
+        std::vector<double>   WORK(N*NRHS);
+        double* WORKptr = &WORK[0];
+
+        std::vector<float>   SWORK(N*(N+NRHS));
+        float* SWORKptr = &SWORK[0];
+
+        long   INFO = 0;
+
+        dsgesv_(&N, &NRHS, Aptr, &LDA, IPIVptr, Bptr, &LDB, Xptr, &LDX,
+                WORKptr, SWORKptr, &ITER, &INFO);
+
+        if(INFO != 0)
+        {
+        std::stringstream sout;
+        sout << "\nDSGESV \nError INFO = " << INFO << "\n";
+        if(INFO > 0) {sout << "U(" << INFO << "," << INFO << ") is exactly zero: the matrix is singular \n";}
+        throw std::runtime_error(sout.str());
+        }
+    }
+
+/*
+*  ITER > 0 : the number of iterative refinement steps used.
+*  ITER < 0 : the iterative refinement failed and the solution was
+*             obtained with a double precision factorization;
+*             -2 : overflow converting A to single precision
+*             -3 : failure of the single precision factorization
+*            -31 : refinement stopped after 30 iterations
+*/
+    long getIterationCount() const
+    {
+        return ITER;
+    }
+
+    bool getDoublePrecisionFallback() const
+    {
+        return (ITER < 0);
+    }
+
+    long           ITER;
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSPOSV : Created for solving symmetric positive definite systems
+// of equations using a single precision Cholesky factorization and
+// double precision iterative refinement.
+//
+// The single precision factorization, refinement and double precision
+// fallback are as for DSGESV. Only the upper triangular part of A is
+// referenced and the input matrix A is not modified. As for DSGESV, the
+// double precision copy of A is released when the solve is complete and
+// errors result in a std::runtime_error exception.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class DSPOSV
+{
+public:
+
+    DSPOSV()
+    {
+    initialize();
+    }
+
+    void initialize()
+    {
+    ITER = 0;
+    }
+
+    void applyInverse(const LapackMatrix& A,std::vector <double >& b)
+    {
+            applyInverse(A,&b[0]);
+    }
+
+    void applyInverse(const LapackMatrix& A,LapackMatrix& b)
+    {
+            applyInverse(A,b.dataPtr,b.cols);
+    }
+
+    void applyInverse(const LapackMatrix& A, double* b, long NRHS = 1)
+    {
+        assert(A.sizeCheck(A.rows,A.cols));
+
+        char UPLO  = 'U'; // A = U**T* U
+        long N     = A.rows;
+
+        // Local copy, released when the solve is complete
+
+        LapackMatrix Awork(A);
+
+        double* Aptr  =  Awork.dataPtr;
+        long LDA      =  N;
+
+        std::vector<double>   B(b, b + N*NRHS);
+        double* Bptr  = &B[0];
+        long LDB      =  N;
+
+        double* Xptr  =  b;
+        long LDX      =  N;
+
+        std::vector<double>   WORK(N*NRHS);
+        double* WORKptr = &WORK[0];
+
+        std::vector<float>   SWORK(N*(N+NRHS));
+        float* SWORKptr = &SWORK[0];
+
+        long   INFO = 0;
+
+        dsposv_(&UPLO, &N, &NRHS, Aptr, &LDA, Bptr, &LDB, Xptr, &LDX,
+                WORKptr, SWORKptr, &ITER, &INFO);
+
+        if(INFO != 0)
+        {
+        std::stringstream sout;
+        sout << "\nDSPOSV \nError INFO = " << INFO << "\n";
+        if(INFO > 0) {sout << "The leading minor of order " << INFO << " is not positive definite \n";}
+        throw std::runtime_error(sout.str());
+        }
+    }
+
+    long getIterationCount() const
+    {
+        return ITER;
+    }
+
+    bool getDoublePrecisionFallback() const
+    {
+        return (ITER < 0);
+    }
+
+    long           ITER;
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class NORMALEQ creates the solution of the normal equations with the singular value
+// parameter cut-off value svdCutoff. Since the singular values of the normal
+// equations are square roots of the eigenvalues of the normal equations, the
+// accuracy of the solution is limited to problems where it is sufficient to
+// construct a solution using singular vector components associated with
+// singular values where (singular values)^2 > accuracy of the
+// eigensystem routine. Typically this limits the application to problems where
+// svdCutoff is approximately > 1.0e-07. The returned solution can only be
+// expected to have single precision accuracy for the same reasons.
+//
+// In the implementation below, the solution components are only accumulated
+// when the singular values are greater than the max(svdCutoff).
+//
+// When M < N, so the solution is underdetermined, the minimum L2
+// norm solution is returned and only M approximate singular
+// values are computed.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+class NORMALEQ
+{
+public:
+
+    NORMALEQ()
+    {
+    initialize();
+    };
+
+    void initialize()
+    {
+    bStar.clear();
+    bBar.clear();
+    ABnormal.initialize();
+
+    diagonalizer.initialize();
+    eigenValues.clear();
+    eigenVectors.initialize();
+
+    singularValues.clear();
+    svdDim = 0;
+    }
+
+    long getSVDdim(){return svdDim;}
+
+
+    // Normal equation solution of
+    //
+    // A*x = b
+    //
+    // with svdCutoff.
+    //
+    // Only components with singular values > svdCutoff or 1.0e-07 are accumulated.
+    //
+    // When A is M x N and M < N, then only M singular values are evaluated.
+    //
+    //
+    std::vector<double> computeNormalEquationSolution(std::vector<double>& b, LapackMatrix& AB, double svdCutoff)
+    {
+        // Form right hand side
+
+        bBar = AB.applyTranspose(b);
 
         // Form normal equations
 
@@ -1825,6 +3305,212 @@ public :
 
 };
 
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DGEEVX : Created for computing eigensystem components
+//                of a real nonsymmetric matrix.
+// LAPACK base routine description:
+// DGEEVX computes for an N-by-N real nonsymmetric matrix A, the
+// eigenvalues and, optionally, the left and/or right eigenvectors.
+//
+// Optionally also, it computes a balancing transformation to improve
+// the conditioning of the eigenvalues and eigenvectors, reciprocal
+// condition numbers for the eigenvalues, and reciprocal condition
+// numbers for the right eigenvectors.
+//
+// The computation is carried out in real arithmetic. The eigenvalues
+// are returned as complex values WR(j) + i*WI(j); complex conjugate
+// pairs appear consecutively with the eigenvalue having positive
+// imaginary part first.
+//
+// The eigenvectors are returned in the real LAPACK format: if the j-th
+// eigenvalue is real, column j of V is the eigenvector; if the j-th and
+// (j+1)-st eigenvalues form a complex conjugate pair, the eigenvectors
+// are V(:,j) + i*V(:,j+1) and V(:,j) - i*V(:,j+1). The member function
+// getComplexEigenvector(...) forms the complex eigenvector associated
+// with a given eigenvalue.
+//
+// When the left and right eigenvectors are computed, the reciprocal
+// condition numbers of the eigenvalues (RCONDE) and right eigenvectors
+// (RCONDV) are also computed unless computeConditionNumbers = false
+// (the convention of ZGEEVX), and are available as the class members
+// RCONDE and RCONDV.
+//
+// The input matrix is copied, and the work array size is obtained with
+// a workspace query.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class DGEEVX
+{
+public :
+
+    DGEEVX()
+    {
+    initialize();
+    }
+
+    void initialize()
+    {
+    AS.initialize();
+    WR.clear();
+    WI.clear();
+    SCALE.clear();
+    RCONDE.clear();
+    RCONDV.clear();
+    WORK.clear();
+    IWORK.clear();
+    ILO   = 0;
+    IHI   = 0;
+    ABNRM = 0.0;
+    }
+
+    // Computes the eigenvalues
+
+    void createEigenvalues(const SCC::LapackMatrix& A, std::vector<std::complex<double>>& eigValues)
+    {
+    dgeevx('N','N','N',A,eigValues,nullptr,nullptr);
+    }
+
+    // Computes the eigenvalues and right eigenvectors
+
+    void createEigensystem(const SCC::LapackMatrix& A, std::vector<std::complex<double>>& eigValues,
+                           SCC::LapackMatrix& eigVecRight)
+    {
+    eigVecRight.initialize(A.getRowDimension(),A.getRowDimension());
+    dgeevx('N','V','N',A,eigValues,nullptr,&eigVecRight);
+    }
+
+    // Computes the eigenvalues and left and right eigenvectors, and, unless
+    // computeConditionNumbers = false, the reciprocal condition numbers of the
+    // eigenvalues (RCONDE) and right eigenvectors (RCONDV).
+
+    void createEigensystem(const SCC::LapackMatrix& A, std::vector<std::complex<double>>& eigValues,
+                           SCC::LapackMatrix& eigVecLeft, SCC::LapackMatrix& eigVecRight,
+                           bool computeConditionNumbers = true)
+    {
+    eigVecLeft.initialize(A.getRowDimension(),A.getRowDimension());
+    eigVecRight.initialize(A.getRowDimension(),A.getRowDimension());
+    char SENSE = computeConditionNumbers ? 'B' : 'N';
+    dgeevx('V','V',SENSE,A,eigValues,&eigVecLeft,&eigVecRight);
+    }
+
+    //
+    // Returns in v the complex eigenvector associated with eigValues[k] from
+    // the eigenvectors V (left or right) in real LAPACK format.
+    //
+    static void getComplexEigenvector(long k, const std::vector<std::complex<double>>& eigValues,
+                                      const SCC::LapackMatrix& V, std::vector<std::complex<double>>& v)
+    {
+    long N = V.getRowDimension();
+    v.resize(N);
+
+    if(eigValues[k].imag() == 0.0)
+    {
+        for(long i = 0; i < N; i++) {v[i] = {V(i,k),0.0};}
+    }
+    else if(eigValues[k].imag() > 0.0)
+    {
+        for(long i = 0; i < N; i++) {v[i] = {V(i,k),V(i,k+1)};}
+    }
+    else
+    {
+        for(long i = 0; i < N; i++) {v[i] = {V(i,k-1),-V(i,k)};}
+    }
+    }
+
+    SCC::LapackMatrix     AS; // Copy of input matrix (S for scaled)
+
+    std::vector<double>     WR;
+    std::vector<double>     WI;
+    std::vector<double>  SCALE;
+    std::vector<double> RCONDE;
+    std::vector<double> RCONDV;
+    std::vector<double>   WORK;
+    std::vector<long>    IWORK;
+
+    long       ILO;
+    long       IHI;
+    double   ABNRM;
+
+private :
+
+    void dgeevx(char JOBVL, char JOBVR, char SENSE, const SCC::LapackMatrix& A,
+                std::vector<std::complex<double>>& eigValues, SCC::LapackMatrix* eigVecLeft,
+                SCC::LapackMatrix* eigVecRight)
+    {
+    if(A.getRowDimension() != A.getColDimension())
+    {
+            throw std::runtime_error("\nDGEEVX : Non-square matrix input argument  \n");
+    }
+
+    AS.initialize(A); // Copy input matrix since scaling and permuting
+
+    char BALANC = 'B';  // Both diagonally scale and permute the copy of A.
+    long N      = A.getRowDimension();
+    long LDA    = std::max(N,(long)1);
+
+    WR.resize(N,0.0);
+    WI.resize(N,0.0);
+
+    double VLdummy = 0.0;
+    double VRdummy = 0.0;
+
+    double* VLptr = (JOBVL == 'V') ? eigVecLeft->getDataPointer()  : &VLdummy;
+    double* VRptr = (JOBVR == 'V') ? eigVecRight->getDataPointer() : &VRdummy;
+    long LDVL     = (JOBVL == 'V') ? LDA : 1;
+    long LDVR     = (JOBVR == 'V') ? LDA : 1;
+
+    SCALE.resize(N,0.0);
+
+    if(SENSE != 'N')
+    {
+    RCONDE.resize(N,0.0);
+    RCONDV.resize(N,0.0);
+    }
+    else
+    {
+    RCONDE.clear();
+    RCONDV.clear();
+    }
+
+    double RCONDEdummy = 0.0;
+    double RCONDVdummy = 0.0;
+    double* RCONDEptr  = (SENSE != 'N') ? RCONDE.data() : &RCONDEdummy;
+    double* RCONDVptr  = (SENSE != 'N') ? RCONDV.data() : &RCONDVdummy;
+
+    IWORK.resize(std::max(2*N-2,(long)1),0);
+
+    long INFO = 0;
+
+    // workspace query
+
+    long LWORK = -1;
+    double WORKtmp;
+
+    dgeevx_(&BALANC,&JOBVL,&JOBVR,&SENSE,&N,AS.getDataPointer(),&LDA,WR.data(),WI.data(),
+    VLptr,&LDVL,VRptr,&LDVR,&ILO,&IHI,SCALE.data(),&ABNRM,RCONDEptr,RCONDVptr,
+    &WORKtmp,&LWORK,IWORK.data(),&INFO);
+
+    LWORK = (long)WORKtmp;
+    if((long)WORK.size() < LWORK) {WORK.resize(LWORK);}
+    LWORK = (long)WORK.size();
+
+    dgeevx_(&BALANC,&JOBVL,&JOBVR,&SENSE,&N,AS.getDataPointer(),&LDA,WR.data(),WI.data(),
+    VLptr,&LDVL,VRptr,&LDVR,&ILO,&IHI,SCALE.data(),&ABNRM,RCONDEptr,RCONDVptr,
+    WORK.data(),&LWORK,IWORK.data(),&INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\nDGEEVX \nError INFO = " << INFO << "\n";
+        if(INFO > 0) {sout << "QR algorithm failed to compute all the eigenvalues \n";}
+        throw std::runtime_error(sout.str());
+    }
+
+    eigValues.resize(N);
+    for(long j = 0; j < N; j++) {eigValues[j] = {WR[j],WI[j]};}
+    }
+};
+
 
 } // End of SCC Namespace declaration
 
@@ -2372,151 +4058,537 @@ Parameters
 
     [in,out]    R
 
-              R is DOUBLE PRECISION array, dimension (N)
-              The row scale factors for A.  If EQUED = 'R' or 'B', A is
-              multiplied on the left by diag(R); if EQUED = 'N' or 'C', R
-              is not accessed.  R is an input argument if FACT = 'F';
-              otherwise, R is an output argument.  If FACT = 'F' and
-              EQUED = 'R' or 'B', each element of R must be positive.
+              R is DOUBLE PRECISION array, dimension (N)
+              The row scale factors for A.  If EQUED = 'R' or 'B', A is
+              multiplied on the left by diag(R); if EQUED = 'N' or 'C', R
+              is not accessed.  R is an input argument if FACT = 'F';
+              otherwise, R is an output argument.  If FACT = 'F' and
+              EQUED = 'R' or 'B', each element of R must be positive.
+
+    [in,out]    C
+
+              C is DOUBLE PRECISION array, dimension (N)
+              The column scale factors for A.  If EQUED = 'C' or 'B', A is
+              multiplied on the right by diag(C); if EQUED = 'N' or 'R', C
+              is not accessed.  C is an input argument if FACT = 'F';
+              otherwise, C is an output argument.  If FACT = 'F' and
+              EQUED = 'C' or 'B', each element of C must be positive.
+
+    [in,out]    B
+
+              B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+              On entry, the N-by-NRHS right hand side matrix B.
+              On exit,
+              if EQUED = 'N', B is not modified;
+              if TRANS = 'N' and EQUED = 'R' or 'B', B is overwritten by
+              diag(R)*B;
+              if TRANS = 'T' or 'C' and EQUED = 'C' or 'B', B is
+              overwritten by diag(C)*B.
+
+    [in]    LDB
+
+              LDB is INTEGER
+              The leading dimension of the array B.  LDB >= max(1,N).
+
+    [out]    X
+
+              X is DOUBLE PRECISION array, dimension (LDX,NRHS)
+              If INFO = 0 or INFO = N+1, the N-by-NRHS solution matrix X
+              to the original system of equations.  Note that A and B are
+              modified on exit if EQUED .ne. 'N', and the solution to the
+              equilibrated system is inv(diag(C))*X if TRANS = 'N' and
+              EQUED = 'C' or 'B', or inv(diag(R))*X if TRANS = 'T' or 'C'
+              and EQUED = 'R' or 'B'.
+
+    [in]    LDX
+
+              LDX is INTEGER
+              The leading dimension of the array X.  LDX >= max(1,N).
+
+    [out]    RCOND
+
+              RCOND is DOUBLE PRECISION
+              The estimate of the reciprocal condition number of the matrix
+              A after equilibration (if done).  If RCOND is less than the
+              machine precision (in particular, if RCOND = 0), the matrix
+              is singular to working precision.  This condition is
+              indicated by a return code of INFO > 0.
+
+    [out]    FERR
+
+              FERR is DOUBLE PRECISION array, dimension (NRHS)
+              The estimated forward error bound for each solution vector
+              X(j) (the j-th column of the solution matrix X).
+              If XTRUE is the true solution corresponding to X(j), FERR(j)
+              is an estimated upper bound for the magnitude of the largest
+              element in (X(j) - XTRUE) divided by the magnitude of the
+              largest element in X(j).  The estimate is as reliable as
+              the estimate for RCOND, and is almost always a slight
+              overestimate of the true error.
+
+    [out]    BERR
+
+              BERR is DOUBLE PRECISION array, dimension (NRHS)
+              The componentwise relative backward error of each solution
+              vector X(j) (i.e., the smallest relative change in
+              any element of A or B that makes X(j) an exact solution).
+
+    [out]    WORK
+
+              WORK is DOUBLE PRECISION array, dimension (MAX(1,4*N))
+              On exit, WORK(1) contains the reciprocal pivot growth
+              factor norm(A)/norm(U). The "max absolute element" norm is
+              used. If WORK(1) is much less than 1, then the stability
+              of the LU factorization of the (equilibrated) matrix A
+              could be poor. This also means that the solution X, condition
+              estimator RCOND, and forward error bound FERR could be
+              unreliable. If factorization fails with 0<INFO<=N, then
+              WORK(1) contains the reciprocal pivot growth factor for the
+              leading INFO columns of A.
+
+    [out]    IWORK
+
+              IWORK is INTEGER array, dimension (N)
+
+    [out]    INFO
+
+              INFO is INTEGER
+              = 0:  successful exit
+              < 0:  if INFO = -i, the i-th argument had an illegal value
+              > 0:  if INFO = i, and i is
+                    <= N:  U(i,i) is exactly zero.  The factorization has
+                           been completed, but the factor U is exactly
+                           singular, so the solution and error bounds
+                           could not be computed. RCOND = 0 is returned.
+                    = N+1: U is nonsingular, but RCOND is less than machine
+                           precision, meaning that the matrix is singular
+                           to working precision.  Nevertheless, the
+                           solution and error bounds are computed because
+                           there are a number of situations where the
+                           computed solution can be more accurate than the
+                           value of RCOND would suggest.
+
+Author
+    Univ. of Tennessee
+    Univ. of California Berkeley
+    Univ. of Colorado Denver
+    NAG Ltd.
+*/
+
+/////////////////////////////////////////////////////////////////////////////
+// DPOSV
+/////////////////////////////////////////////////////////////////////////////
+/*
+DPOSV computes the solution to system of linear equations A * X = B for positive definite matrices
+subroutine dposv    (    character     uplo,
+integer     n,
+integer     nrhs,
+double precision, dimension( lda, * )     a,
+integer     lda,
+double precision, dimension( ldb, * )     b,
+integer     ldb,
+integer     info
+)
+
+
+Purpose:
+ DPOSV computes the solution to a real system of linear equations
+    A * X = B,
+ where A is an N-by-N symmetric positive definite matrix and X and B
+ are N-by-NRHS matrices.
+
+ The Cholesky decomposition is used to factor A as
+    A = U**T* U,  if UPLO = 'U', or
+    A = L * L**T,  if UPLO = 'L',
+ where U is an upper triangular matrix and L is a lower triangular
+ matrix.  The factored form of A is then used to solve the system of
+ equations A * X = B.
+Parameters
+[in]    UPLO
+          UPLO is CHARACTER*1
+          = 'U':  Upper triangle of A is stored;
+          = 'L':  Lower triangle of A is stored.
+[in]    N
+          N is INTEGER
+          The number of linear equations, i.e., the order of the
+          matrix A.  N >= 0.
+[in]    NRHS
+          NRHS is INTEGER
+          The number of right hand sides, i.e., the number of columns
+          of the matrix B.  NRHS >= 0.
+[in,out]    A
+          A is DOUBLE PRECISION array, dimension (LDA,N)
+          On entry, the symmetric matrix A.  If UPLO = 'U', the leading
+          N-by-N upper triangular part of A contains the upper
+          triangular part of the matrix A, and the strictly lower
+          triangular part of A is not referenced.  If UPLO = 'L', the
+          leading N-by-N lower triangular part of A contains the lower
+          triangular part of the matrix A, and the strictly upper
+          triangular part of A is not referenced.
+
+          On exit, if INFO = 0, the factor U or L from the Cholesky
+          factorization A = U**T*U or A = L*L**T.
+[in]    LDA
+          LDA is INTEGER
+          The leading dimension of the array A.  LDA >= max(1,N).
+[in,out]    B
+          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+          On entry, the N-by-NRHS right hand side matrix B.
+          On exit, if INFO = 0, the N-by-NRHS solution matrix X.
+[in]    LDB
+          LDB is INTEGER
+          The leading dimension of the array B.  LDB >= max(1,N).
+[out]    INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  if INFO = i, the leading principal minor of order i
+                of A is not positive, so the factorization could not
+                be completed, and the solution has not been computed.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DSGESV
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dsgesv    (    integer     n,
+integer     nrhs,
+double precision, dimension( lda, * )     a,
+integer     lda,
+integer, dimension( * )     ipiv,
+double precision, dimension( ldb, * )     b,
+integer     ldb,
+double precision, dimension( ldx, * )     x,
+integer     ldx,
+double precision, dimension( n, * )     work,
+real, dimension( * )     swork,
+integer     iter,
+integer     info
+)
+
+Purpose:
+
+     DSGESV computes the solution to a real system of linear equations
+        A * X = B,
+     where A is an N-by-N matrix and X and B are N-by-NRHS matrices.
+
+     DSGESV first attempts to factorize the matrix in SINGLE PRECISION
+     and use this factorization within an iterative refinement procedure
+     to produce a solution with DOUBLE PRECISION normwise backward error
+     quality (see below). If the approach fails the method switches to a
+     DOUBLE PRECISION factorization and solve.
+
+     The iterative refinement is not going to be a winning strategy if
+     the ratio SINGLE PRECISION performance over DOUBLE PRECISION
+     performance is too small. A reasonable strategy should take the
+     number of right-hand sides and the size of the matrix into account.
+
+     The iterative refinement process is stopped if
+         ITER > ITERMAX
+     or for all the RHS we have:
+         RNRM < SQRT(N)*XNRM*ANRM*EPS*BWDMAX
+     where
+         o ITER is the number of the current iteration in the iterative
+           refinement process
+         o RNRM is the infinity-norm of the residual
+         o XNRM is the infinity-norm of the solution
+         o ANRM is the infinity-operator-norm of the matrix A
+         o EPS is the machine epsilon returned by DLAMCH('Epsilon')
+     The value ITERMAX and BWDMAX are fixed to 30 and 1.0D+00
+     respectively.
+
+Parameters
+    [in]    N
+              N is INTEGER
+              The number of linear equations, i.e., the order of the
+              matrix A.  N >= 0.
+    [in]    NRHS
+              NRHS is INTEGER
+              The number of right hand sides, i.e., the number of columns
+              of the matrix B.  NRHS >= 0.
+    [in,out]    A
+              A is DOUBLE PRECISION array,
+              dimension (LDA,N)
+              On entry, the N-by-N coefficient matrix A.
+              On exit, if iterative refinement has been successfully used
+              (INFO = 0 and ITER >= 0, see description below), then A is
+              unchanged, if double precision factorization has been used
+              (INFO = 0 and ITER < 0, see description below), then the
+              array A contains the factors L and U from the factorization
+              A = P*L*U; the unit diagonal elements of L are not stored.
+    [in]    LDA
+              LDA is INTEGER
+              The leading dimension of the array A.  LDA >= max(1,N).
+    [out]    IPIV
+              IPIV is INTEGER array, dimension (N)
+              The pivot indices that define the permutation matrix P;
+              row i of the matrix was interchanged with row IPIV(i).
+              Corresponds either to the single precision factorization
+              (if INFO = 0 and ITER >= 0) or the double precision
+              factorization (if INFO = 0 and ITER < 0).
+    [in]    B
+              B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+              The N-by-NRHS right hand side matrix B.
+    [in]    LDB
+              LDB is INTEGER
+              The leading dimension of the array B.  LDB >= max(1,N).
+    [out]    X
+              X is DOUBLE PRECISION array, dimension (LDX,NRHS)
+              If INFO = 0, the N-by-NRHS solution matrix X.
+    [in]    LDX
+              LDX is INTEGER
+              The leading dimension of the array X.  LDX >= max(1,N).
+    [out]    WORK
+              WORK is DOUBLE PRECISION array, dimension (N,NRHS)
+              This array is used to hold the residual vectors.
+    [out]    SWORK
+              SWORK is REAL array, dimension (N*(N+NRHS))
+              This array is used to use the single precision matrix and the
+              right-hand sides or solutions in single precision.
+    [out]    ITER
+              ITER is INTEGER
+              < 0: iterative refinement has failed, double precision
+                   factorization has been performed
+                   -1 : the routine fell back to full precision for
+                        implementation- or machine-specific reasons
+                   -2 : narrowing the precision induced an overflow,
+                        the routine fell back to full precision
+                   -3 : failure of SGETRF
+                   -31: stop the iterative refinement after the 30th
+                        iterations
+              > 0: iterative refinement has been successfully used.
+                   Returns the number of iterations
+    [out]    INFO
+              INFO is INTEGER
+              = 0:  successful exit
+              < 0:  if INFO = -i, the i-th argument had an illegal value
+              > 0:  if INFO = i, U(i,i) computed in DOUBLE PRECISION is
+                    exactly zero.  The factorization has been completed,
+                    but the factor U is exactly singular, so the solution
+                    could not be computed.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DSPOSV
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dsposv    (    character     uplo,
+integer     n,
+integer     nrhs,
+double precision, dimension( lda, * )     a,
+integer     lda,
+double precision, dimension( ldb, * )     b,
+integer     ldb,
+double precision, dimension( ldx, * )     x,
+integer     ldx,
+double precision, dimension( n, * )     work,
+real, dimension( * )     swork,
+integer     iter,
+integer     info
+)
+
+Purpose:
 
-    [in,out]    C
+     DSPOSV computes the solution to a real system of linear equations
+        A * X = B,
+     where A is an N-by-N symmetric positive definite matrix and X and B
+     are N-by-NRHS matrices.
 
-              C is DOUBLE PRECISION array, dimension (N)
-              The column scale factors for A.  If EQUED = 'C' or 'B', A is
-              multiplied on the right by diag(C); if EQUED = 'N' or 'R', C
-              is not accessed.  C is an input argument if FACT = 'F';
-              otherwise, C is an output argument.  If FACT = 'F' and
-              EQUED = 'C' or 'B', each element of C must be positive.
+     DSPOSV first attempts to factorize the matrix in SINGLE PRECISION
+     and use this factorization within an iterative refinement procedure
+     to produce a solution with DOUBLE PRECISION normwise backward error
+     quality (see below). If the approach fails the method switches to a
+     DOUBLE PRECISION factorization and solve.
 
-    [in,out]    B
+     The iterative refinement process is stopped and the values of
+     ITERMAX and BWDMAX are as for DSGESV.
 
+Parameters
+    [in]    UPLO
+              UPLO is CHARACTER*1
+              = 'U':  Upper triangle of A is stored;
+              = 'L':  Lower triangle of A is stored.
+    [in]    N
+              N is INTEGER
+              The number of linear equations, i.e., the order of the
+              matrix A.  N >= 0.
+    [in]    NRHS
+              NRHS is INTEGER
+              The number of right hand sides, i.e., the number of columns
+              of the matrix B.  NRHS >= 0.
+    [in,out]    A
+              A is DOUBLE PRECISION array,
+              dimension (LDA,N)
+              On entry, the symmetric matrix A.  If UPLO = 'U', the leading
+              N-by-N upper triangular part of A contains the upper
+              triangular part of the matrix A, and the strictly lower
+              triangular part of A is not referenced.  If UPLO = 'L', the
+              leading N-by-N lower triangular part of A contains the lower
+              triangular part of the matrix A, and the strictly upper
+              triangular part of A is not referenced.
+              On exit, if iterative refinement has been successfully used
+              (INFO = 0 and ITER >= 0, see description below), then A is
+              unchanged, if double precision factorization has been used
+              (INFO = 0 and ITER < 0, see description below), then the
+              array A contains the factor U or L from the Cholesky
+              factorization A = U**T*U or A = L*L**T.
+    [in]    LDA
+              LDA is INTEGER
+              The leading dimension of the array A.  LDA >= max(1,N).
+    [in]    B
               B is DOUBLE PRECISION array, dimension (LDB,NRHS)
-              On entry, the N-by-NRHS right hand side matrix B.
-              On exit,
-              if EQUED = 'N', B is not modified;
-              if TRANS = 'N' and EQUED = 'R' or 'B', B is overwritten by
-              diag(R)*B;
-              if TRANS = 'T' or 'C' and EQUED = 'C' or 'B', B is
-              overwritten by diag(C)*B.
-
+              The N-by-NRHS right hand side matrix B.
     [in]    LDB
-
               LDB is INTEGER
               The leading dimension of the array B.  LDB >= max(1,N).
-
     [out]    X
-
               X is DOUBLE PRECISION array, dimension (LDX,NRHS)
-              If INFO = 0 or INFO = N+1, the N-by-NRHS solution matrix X
-              to the original system of equations.  Note that A and B are
-              modified on exit if EQUED .ne. 'N', and the solution to the
-              equilibrated system is inv(diag(C))*X if TRANS = 'N' and
-              EQUED = 'C' or 'B', or inv(diag(R))*X if TRANS = 'T' or 'C'
-              and EQUED = 'R' or 'B'.
-
+              If INFO = 0, the N-by-NRHS solution matrix X.
     [in]    LDX
-
               LDX is INTEGER
               The leading dimension of the array X.  LDX >= max(1,N).
-
-    [out]    RCOND
-
-              RCOND is DOUBLE PRECISION
-              The estimate of the reciprocal condition number of the matrix
-              A after equilibration (if done).  If RCOND is less than the
-              machine precision (in particular, if RCOND = 0), the matrix
-              is singular to working precision.  This condition is
-              indicated by a return code of INFO > 0.
-
-    [out]    FERR
-
-              FERR is DOUBLE PRECISION array, dimension (NRHS)
-              The estimated forward error bound for each solution vector
-              X(j) (the j-th column of the solution matrix X).
-              If XTRUE is the true solution corresponding to X(j), FERR(j)
-              is an estimated upper bound for the magnitude of the largest
-              element in (X(j) - XTRUE) divided by the magnitude of the
-              largest element in X(j).  The estimate is as reliable as
-              the estimate for RCOND, and is almost always a slight
-              overestimate of the true error.
-
-    [out]    BERR
-
-              BERR is DOUBLE PRECISION array, dimension (NRHS)
-              The componentwise relative backward error of each solution
-              vector X(j) (i.e., the smallest relative change in
-              any element of A or B that makes X(j) an exact solution).
-
     [out]    WORK
-
-              WORK is DOUBLE PRECISION array, dimension (MAX(1,4*N))
-              On exit, WORK(1) contains the reciprocal pivot growth
-              factor norm(A)/norm(U). The "max absolute element" norm is
-              used. If WORK(1) is much less than 1, then the stability
-              of the LU factorization of the (equilibrated) matrix A
-              could be poor. This also means that the solution X, condition
-              estimator RCOND, and forward error bound FERR could be
-              unreliable. If factorization fails with 0<INFO<=N, then
-              WORK(1) contains the reciprocal pivot growth factor for the
-              leading INFO columns of A.
-
-    [out]    IWORK
-
-              IWORK is INTEGER array, dimension (N)
-
+              WORK is DOUBLE PRECISION array, dimension (N,NRHS)
+              This array is used to hold the residual vectors.
+    [out]    SWORK
+              SWORK is REAL array, dimension (N*(N+NRHS))
+              This array is used to use the single precision matrix and the
+              right-hand sides or solutions in single precision.
+    [out]    ITER
+              ITER is INTEGER
+              < 0: iterative refinement has failed, double precision
+                   factorization has been performed
+                   -1 : the routine fell back to full precision for
+                        implementation- or machine-specific reasons
+                   -2 : narrowing the precision induced an overflow,
+                        the routine fell back to full precision
+                   -3 : failure of SPOTRF
+                   -31: stop the iterative refinement after the 30th
+                        iterations
+              > 0: iterative refinement has been successfully used.
+                   Returns the number of iterations
     [out]    INFO
-
               INFO is INTEGER
               = 0:  successful exit
               < 0:  if INFO = -i, the i-th argument had an illegal value
-              > 0:  if INFO = i, and i is
-                    <= N:  U(i,i) is exactly zero.  The factorization has
-                           been completed, but the factor U is exactly
-                           singular, so the solution and error bounds
-                           could not be computed. RCOND = 0 is returned.
-                    = N+1: U is nonsingular, but RCOND is less than machine
-                           precision, meaning that the matrix is singular
-                           to working precision.  Nevertheless, the
-                           solution and error bounds are computed because
-                           there are a number of situations where the
-                           computed solution can be more accurate than the
-                           value of RCOND would suggest.
-
+              > 0:  if INFO = i, the leading minor of order i of
+                    (DOUBLE PRECISION) A is not positive, so the
+                    factorization could not be completed, and the solution
+                    has not been computed.
 Author
-    Univ. of Tennessee
-    Univ. of California Berkeley
-    Univ. of Colorado Denver
-    NAG Ltd.
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
 */
-
 /////////////////////////////////////////////////////////////////////////////
-// DPOSV
+// DGECON
 /////////////////////////////////////////////////////////////////////////////
 /*
-DPOSV computes the solution to system of linear equations A * X = B for positive definite matrices
-subroutine dposv    (    character     uplo,
+subroutine dgecon    (    character     norm,
 integer     n,
-integer     nrhs,
 double precision, dimension( lda, * )     a,
 integer     lda,
-double precision, dimension( ldb, * )     b,
-integer     ldb,
+double precision     anorm,
+double precision     rcond,
+double precision, dimension( * )     work,
+integer, dimension( * )     iwork,
 integer     info
 )
 
+Purpose:
+ DGECON estimates the reciprocal of the condition number of a general
+ real matrix A, in either the 1-norm or the infinity-norm, using
+ the LU factorization computed by DGETRF.
+
+ An estimate is obtained for norm(inv(A)), and the reciprocal of the
+ condition number is computed as
+    RCOND = 1 / ( norm(A) * norm(inv(A)) ).
+Parameters
+[in]    NORM
+          NORM is CHARACTER*1
+          Specifies whether the 1-norm condition number or the
+          infinity-norm condition number is required:
+          = '1' or 'O':  1-norm;
+          = 'I':         Infinity-norm.
+[in]    N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in]    A
+          A is DOUBLE PRECISION array, dimension (LDA,N)
+          The factors L and U from the factorization A = P*L*U
+          as computed by DGETRF.
+[in]    LDA
+          LDA is INTEGER
+          The leading dimension of the array A.  LDA >= max(1,N).
+[in]    ANORM
+          ANORM is DOUBLE PRECISION
+          If NORM = '1' or 'O', the 1-norm of the original matrix A.
+          If NORM = 'I', the infinity-norm of the original matrix A.
+[out]    RCOND
+          RCOND is DOUBLE PRECISION
+          The reciprocal of the condition number of the matrix A,
+          computed as RCOND = 1/(norm(A) * norm(inv(A))).
+[out]    WORK
+          WORK is DOUBLE PRECISION array, dimension (4*N)
+[out]    IWORK
+          IWORK is INTEGER array, dimension (N)
+[out]    INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value.
+                NaNs are illegal values for ANORM, and they propagate to
+                the output parameter RCOND.
+                Infinity is illegal for ANORM, and it propagates to the output
+                parameter RCOND.
+          = 1:  if RCOND = NaN, or
+                   RCOND = Inf, or
+                   the computed norm of the inverse of A is 0.
+                In the latter, RCOND = 0 is returned.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+//
+// The documentation for DGETRF and DGETRS is contained in
+// SCC_LapackBlockTriDiagRoutines.h
+//
+/////////////////////////////////////////////////////////////////////////////
+// DSYTRF
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dsytrf    (    character     uplo,
+integer     n,
+double precision, dimension( lda, * )     a,
+integer     lda,
+integer, dimension( * )     ipiv,
+double precision, dimension( * )     work,
+integer     lwork,
+integer     info
+)
 
 Purpose:
- DPOSV computes the solution to a real system of linear equations
-    A * X = B,
- where A is an N-by-N symmetric positive definite matrix and X and B
- are N-by-NRHS matrices.
+ DSYTRF computes the factorization of a real symmetric matrix A using
+ the Bunch-Kaufman diagonal pivoting method.  The form of the
+ factorization is
 
- The Cholesky decomposition is used to factor A as
-    A = U**T* U,  if UPLO = 'U', or
-    A = L * L**T,  if UPLO = 'L',
- where U is an upper triangular matrix and L is a lower triangular
- matrix.  The factored form of A is then used to solve the system of
- equations A * X = B.
+    A = U**T*D*U  or  A = L*D*L**T
+
+ where U (or L) is a product of permutation and unit upper (lower)
+ triangular matrices, and D is symmetric and block diagonal with
+ 1-by-1 and 2-by-2 diagonal blocks.
+
+ This is the blocked version of the algorithm, calling Level 3 BLAS.
 Parameters
 [in]    UPLO
           UPLO is CHARACTER*1
@@ -2524,12 +4596,7 @@ Parameters
           = 'L':  Lower triangle of A is stored.
 [in]    N
           N is INTEGER
-          The number of linear equations, i.e., the order of the
-          matrix A.  N >= 0.
-[in]    NRHS
-          NRHS is INTEGER
-          The number of right hand sides, i.e., the number of columns
-          of the matrix B.  NRHS >= 0.
+          The order of the matrix A.  N >= 0.
 [in,out]    A
           A is DOUBLE PRECISION array, dimension (LDA,N)
           On entry, the symmetric matrix A.  If UPLO = 'U', the leading
@@ -2540,15 +4607,95 @@ Parameters
           triangular part of the matrix A, and the strictly upper
           triangular part of A is not referenced.
 
-          On exit, if INFO = 0, the factor U or L from the Cholesky
-          factorization A = U**T*U or A = L*L**T.
+          On exit, the block diagonal matrix D and the multipliers used
+          to obtain the factor U or L (see below for further details).
+[in]    LDA
+          LDA is INTEGER
+          The leading dimension of the array A.  LDA >= max(1,N).
+[out]    IPIV
+          IPIV is INTEGER array, dimension (N)
+          Details of the interchanges and the block structure of D.
+          If IPIV(k) > 0, then rows and columns k and IPIV(k) were
+          interchanged and D(k,k) is a 1-by-1 diagonal block.
+          If UPLO = 'U' and IPIV(k) = IPIV(k-1) < 0, then rows and
+          columns k-1 and -IPIV(k) were interchanged and D(k-1:k,k-1:k)
+          is a 2-by-2 diagonal block.  If UPLO = 'L' and IPIV(k) =
+          IPIV(k+1) < 0, then rows and columns k+1 and -IPIV(k) were
+          interchanged and D(k:k+1,k:k+1) is a 2-by-2 diagonal block.
+[out]    WORK
+          WORK is DOUBLE PRECISION array, dimension (MAX(1,LWORK))
+          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+[in]    LWORK
+          LWORK is INTEGER
+          The length of WORK.  LWORK >=1.  For best performance
+          LWORK >= N*NB, where NB is the block size returned by ILAENV.
+
+          If LWORK = -1, then a workspace query is assumed; the routine
+          only calculates the optimal size of the WORK array, returns
+          this value as the first entry of the WORK array, and no error
+          message related to LWORK is issued by XERBLA.
+[out]    INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  if INFO = i, D(i,i) is exactly zero.  The factorization
+                has been completed, but the block diagonal matrix D is
+                exactly singular, and division by zero will occur if it
+                is used to solve a system of equations.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DSYTRS
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dsytrs    (    character     uplo,
+integer     n,
+integer     nrhs,
+double precision, dimension( lda, * )     a,
+integer     lda,
+integer, dimension( * )     ipiv,
+double precision, dimension( ldb, * )     b,
+integer     ldb,
+integer     info
+)
+
+Purpose:
+ DSYTRS solves a system of linear equations A*X = B with a real
+ symmetric matrix A using the factorization A = U**T*D*U or
+ A = L*D*L**T computed by DSYTRF.
+Parameters
+[in]    UPLO
+          UPLO is CHARACTER*1
+          Specifies whether the details of the factorization are stored
+          as an upper or lower triangular matrix.
+          = 'U':  Upper triangular, form is A = U**T*D*U;
+          = 'L':  Lower triangular, form is A = L*D*L**T.
+[in]    N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in]    NRHS
+          NRHS is INTEGER
+          The number of right hand sides, i.e., the number of columns
+          of the matrix B.  NRHS >= 0.
+[in]    A
+          A is DOUBLE PRECISION array, dimension (LDA,N)
+          The block diagonal matrix D and the multipliers used to
+          obtain the factor U or L as computed by DSYTRF.
 [in]    LDA
           LDA is INTEGER
           The leading dimension of the array A.  LDA >= max(1,N).
+[in]    IPIV
+          IPIV is INTEGER array, dimension (N)
+          Details of the interchanges and the block structure of D
+          as determined by DSYTRF.
 [in,out]    B
           B is DOUBLE PRECISION array, dimension (LDB,NRHS)
-          On entry, the N-by-NRHS right hand side matrix B.
-          On exit, if INFO = 0, the N-by-NRHS solution matrix X.
+          On entry, the right hand side matrix B.
+          On exit, the solution matrix X.
 [in]    LDB
           LDB is INTEGER
           The leading dimension of the array B.  LDB >= max(1,N).
@@ -2556,9 +4703,6 @@ Parameters
           INFO is INTEGER
           = 0:  successful exit
           < 0:  if INFO = -i, the i-th argument had an illegal value
-          > 0:  if INFO = i, the leading principal minor of order i
-                of A is not positive, so the factorization could not
-                be completed, and the solution has not been computed.
 Author
 Univ. of Tennessee
 Univ. of California Berkeley
@@ -2991,6 +5135,131 @@ Univ. of California Berkeley
 Univ. of Colorado Denver
 NAG Ltd.
  */
+
+/////////////////////////////////////////////////////////////////////////////
+// DGEEVX
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dgeevx 	( 	character  	balanc,
+		character  	jobvl,
+		character  	jobvr,
+		character  	sense,
+		integer  	n,
+		double precision, dimension( lda, * )  	a,
+		integer  	lda,
+		double precision, dimension( * )  	wr,
+		double precision, dimension( * )  	wi,
+		double precision, dimension( ldvl, * )  	vl,
+		integer  	ldvl,
+		double precision, dimension( ldvr, * )  	vr,
+		integer  	ldvr,
+		integer  	ilo,
+		integer  	ihi,
+		double precision, dimension( * )  	scale,
+		double precision  	abnrm,
+		double precision, dimension( * )  	rconde,
+		double precision, dimension( * )  	rcondv,
+		double precision, dimension( * )  	work,
+		integer  	lwork,
+		integer, dimension( * )  	iwork,
+		integer  	info
+	)
+
+Purpose:
+
+ DGEEVX computes for an N-by-N real nonsymmetric matrix A, the
+ eigenvalues and, optionally, the left and/or right eigenvectors.
+
+ Optionally also, it computes a balancing transformation to improve
+ the conditioning of the eigenvalues and eigenvectors (ILO, IHI,
+ SCALE, and ABNRM), reciprocal condition numbers for the eigenvalues
+ (RCONDE), and reciprocal condition numbers for the right
+ eigenvectors (RCONDV).
+
+Parameters
+[in]	BALANC
+          = 'N': Do not diagonally scale or permute;
+          = 'P': Perform permutations to make the matrix more nearly
+                 upper triangular. Do not diagonally scale;
+          = 'S': Diagonally scale the matrix. Do not permute;
+          = 'B': Both diagonally scale and permute A.
+[in]	JOBVL
+          = 'N': left eigenvectors of A are not computed;
+          = 'V': left eigenvectors of A are computed.
+          If SENSE = 'E' or 'B', JOBVL must = 'V'.
+[in]	JOBVR
+          = 'N': right eigenvectors of A are not computed;
+          = 'V': right eigenvectors of A are computed.
+          If SENSE = 'E' or 'B', JOBVR must = 'V'.
+[in]	SENSE
+          Determines which reciprocal condition numbers are computed.
+          = 'N': None are computed;
+          = 'E': Computed for eigenvalues only;
+          = 'V': Computed for right eigenvectors only;
+          = 'B': Computed for eigenvalues and right eigenvectors.
+[in]	N
+          The order of the matrix A. N >= 0.
+[in,out]	A
+          On entry, the N-by-N matrix A.
+          On exit, A has been overwritten.
+[in]	LDA
+          The leading dimension of the array A.  LDA >= max(1,N).
+[out]	WR, WI
+          The real and imaginary parts, respectively, of the computed
+          eigenvalues.  Complex conjugate pairs of eigenvalues appear
+          consecutively with the eigenvalue having the positive
+          imaginary part first.
+[out]	VL
+          If JOBVL = 'V', the left eigenvectors u(j) are stored one
+          after another in the columns of VL, in the same order
+          as their eigenvalues. If the j-th eigenvalue is real, then
+          u(j) = VL(:,j); if the j-th and (j+1)-st eigenvalues form a
+          complex conjugate pair, then u(j) = VL(:,j) + i*VL(:,j+1) and
+          u(j+1) = VL(:,j) - i*VL(:,j+1).
+[in]	LDVL
+          The leading dimension of the array VL.  LDVL >= 1; if
+          JOBVL = 'V', LDVL >= N.
+[out]	VR
+          If JOBVR = 'V', the right eigenvectors v(j) are stored one
+          after another in the columns of VR, in the same order
+          as their eigenvalues, using the same convention as VL.
+[in]	LDVR
+          The leading dimension of the array VR.  LDVR >= 1, and if
+          JOBVR = 'V', LDVR >= N.
+[out]	ILO, IHI
+          Integer values determined when A was balanced.
+[out]	SCALE
+          Details of the permutations and scaling factors applied
+          when balancing A.
+[out]	ABNRM
+          The one-norm of the balanced matrix.
+[out]	RCONDE
+          RCONDE(j) is the reciprocal condition number of the j-th
+          eigenvalue.
+[out]	RCONDV
+          RCONDV(j) is the reciprocal condition number of the j-th
+          right eigenvector.
+[out]	WORK
+          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+[in]	LWORK
+          If LWORK = -1, then a workspace query is assumed; the routine
+          only calculates the optimal size of the WORK array.
+[out]	IWORK
+          IWORK is INTEGER array, dimension (2*N-2)
+          If SENSE = 'N' or 'E', not referenced.
+[out]	INFO
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value.
+          > 0:  if INFO = i, the QR algorithm failed to compute all the
+                eigenvalues, and no eigenvectors or condition numbers
+                have been computed; elements 1:ILO-1 and i+1:N of WR
+                and WI contain eigenvalues which have converged.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
 #endif
 
 
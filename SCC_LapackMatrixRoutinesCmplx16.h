@@ -40,6 +40,13 @@
 // provided.
 //
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class ZSHIFTSV : Created for solving the shifted systems
+//    (A - sigma I) X = B
+// for many complex shifts sigma with the same matrix A. A is reduced
+// once to upper Hessenberg form with ZGEHRD, after which each shift
+// requires O(N^2) operations.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Class  ZHPEVX : Created for computing eigensystem components
 //                 of a Hermitian complex matrix.
 //
@@ -50,6 +57,41 @@
 // values or a range of indices for the desired eigenvalues.
 //
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class  ZHEEVR : Created for computing eigensystem components
+//                 of a Hermitian complex matrix in full storage.
+//
+// LAPACK base routine description:
+// ZHEEVR computes selected eigenvalues and, optionally, eigenvectors
+// of a complex Hermitian matrix A.  Eigenvalues and eigenvectors can
+// be selected by specifying either a range of values or a range of
+// indices for the desired eigenvalues.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class  ZHPSV : Created for solving A*X = B when A is a complex
+//                Hermitian indefinite matrix in packed storage.
+//
+// LAPACK base routine description:
+// ZHPTRF computes the factorization of a complex Hermitian packed
+// matrix A using the Bunch-Kaufman diagonal pivoting method.
+// ZHPTRS solves a system of linear equations A*X = B with a complex
+// Hermitian matrix A stored in packed format using the factorization
+// computed by ZHPTRF.
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class  ZPOSV : Created for solving A*X = B using the Cholesky
+//                factorization when A is a complex Hermitian positive
+//                definite matrix.
+//
+// LAPACK base routine description:
+// ZPOTRF computes the Cholesky factorization of a complex Hermitian
+// positive definite matrix A.
+// ZPOTRS solves a system of linear equations A*X = B with a Hermitian
+// positive definite matrix A using the Cholesky factorization computed
+// by ZPOTRF.
+//
+// ZPOSV is POSV<std::complex<double>> (SCC_LapackMatrixRoutines.h).
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Class  ZGEEVX : Created for computing eigensystem components
 //                 of a complex matrix.
 //
@@ -65,14 +107,23 @@
 // eigenvalues, the Schur form T, and, optionally, the matrix of Schur
 // vectors Z.
 //
+// ZTRSEN (used by ZGEESX::reorderSchurForm) reorders an existing
+// Schur factorization so that a selected cluster of eigenvalues
+// appears in the leading positions on the diagonal.
+//
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "SCC_LapackHeaders.h"
 #include "SCC_LapackMatrix.h"
 #include "SCC_LapackMatrixCmplx16.h"
+#include "SCC_LapackHermPackedMatrix.h"
+#include "SCC_LapackMatrixRoutines.h"
 
 #include <complex>
 #include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <functional>
 
 #ifndef SCC_LAPACK_MATRIX_ROUTINES_CMPLX16
 #define SCC_LAPACK_MATRIX_ROUTINES_CMPLX16
@@ -92,176 +143,32 @@ namespace SCC
 //
 // Error bounds on the solution and a condition estimate are also
 // provided.
+//
+// ZGESVX is the complex*16 instance of the class template GESVX<T>
+// defined in SCC_LapackMatrixRoutines.h.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-class ZGESVX
-{
-public:
-
-	ZGESVX()
-	{
-	initialize();
-	}
-
-	void initialize()
-	{
-    RCOND = 0.0;
-	FERR.clear();
-	BERR.clear();
-
-	A.initialize();
-	AF.initialize();
-	}
-
-    void applyInverse(const LapackMatrixCmplx16& A,std::vector <std::complex<double>>& b)
-	{
-    	    assert(A.sizeCheck(A.cols,(long)b.size()));
-	        double* bptr =  &(reinterpret_cast<double(&)[2]>(b[0])[0]);
-			applyInverse(A,bptr);
-	}
-
-    void applyInverse(const LapackMatrixCmplx16& A,LapackMatrixCmplx16& b)
-	{
-    	    assert(A.sizeCheck(A.cols,b.rows));
-    		applyInverse(A,b.mData.dataPtr,b.cols);
-	}
-
-	void applyInverse(const LapackMatrixCmplx16& A, double* b, long NRHS = 1)
-	{
-		char FACT  = 'E'; // Equilibrate, then factor
-		char TRANS = 'N'; // No transpose
-		long N     = A.rows;
-
-		//
-		// Duplicate input matrix (since this zgbsvx overwrites input matrix)
-		// and create temporaries
-
-		this->A.initialize(A);
-		this->AF.initialize(N,N);
-
-		double* Aptr  =  A.mData.dataPtr;
-		double* AFptr = AF.mData.dataPtr;
-
-		long LDA   = N;
-		long LDAF  = N;
-
-		std::vector <long >   IPIV(N);
-		long* IPIVptr = &IPIV[0];
-
-		char  EQED;
-
-
-		std::vector<double>   R(N);
-		double* Rptr  = &R[0];
-
-		std::vector<double>    C(N);
-		double* Cptr  =  &C[0];
-
-		std::vector<double>   B(2*N*NRHS);
-		double* Bptr  =      &B[0];
-	    long LDB      =    N;
-
-
-		// b will be overwritten with the solution
-	    // so no need to declare X separately
-
-		double* Xptr = b;
-		long LDX     = N;
-
-		FERR.resize(NRHS);
-		BERR.resize(NRHS);
-
-		std::vector<double>   WORK(4*N);
-		double* WORKptr     = &WORK[0];
+typedef GESVX< std::complex<double> > ZGESVX;
 
-		std::vector<double>  RWORK(2*N);
-		double* RWORKptr   = &RWORK[0];
 
-		long   INFO = 0;
-
-
-		// Assign right hand side to B
-
-		for(long i = 0; i < 2*N*NRHS; i++)
-		{
-			Bptr[i] = b[i];
-		}
-
-
-		zgesvx_(&FACT, &TRANS, &N, &NRHS, Aptr, &LDA, AFptr, &LDAF, IPIVptr,
-		        &EQED, Rptr, Cptr, Bptr,&LDB, Xptr, &LDX, &RCOND,
-				&FERR[0], &BERR[0], WORKptr,RWORKptr, &INFO);
-
-
-		if(INFO != 0)
-        {
-        std::cerr << "dgesvx  Failed : INFO = " << INFO  << std::endl;
-        exit(1);
-        }
-	}
-
-/*
-*  RCOND is DOUBLE PRECISION
-*  The estimate of the reciprocal condition number of the matrix
-*  A after equilibration (if done).  If RCOND is less than the
-*  machine precision (in particular, if RCOND = 0), the matrix
-*  is singular to working precision.  This condition is
-*  indicated by a return code of INFO > 0.
-*/
-
-	double getReciprocalConditionNumber()
-	{
-		return RCOND;
-	}
-
-/*
-*  FERR is DOUBLE PRECISION array, dimension (NRHS)
-*  The estimated forward error bound for each solution vector
-*  X(j) (the j-th column of the solution matrix X).
-*  If XTRUE is the true solution corresponding to X(j), FERR(j)
-*  is an estimated upper bound for the magnitude of the largest
-*  element in (X(j) - XTRUE) divided by the magnitude of the
-*  largest element in X(j).  The estimate is as reliable as
-*  the estimate for RCOND, and is almost always a slight
-*  overestimate of the true error.
-*/
-
-	double getSolutionErrorEst()
-	{
-		return FERR[0];
-	}
-
-	std::vector<double> getMultipleSolutionErrorEst()
-	{
-		return FERR;
-	}
-
-/*
-*  BERR is DOUBLE PRECISION array, dimension (NRHS)
-*  The componentwise relative backward error of each solution
-*  vector X(j) (i.e., the smallest relative change in
-*   any element of A or B that makes X(j) an exact solution).
-*/
-	double getSolutionBackwardErrorEst()
-	{
-		return BERR[0];
-	}
-
-	std::vector<double> getMultipleSolutionBackwardErrorEst()
-	{
-		return BERR;
-	}
-
-
-
-    double          RCOND;
-	std::vector<double>    FERR;
-	std::vector<double>    BERR;
-
-	LapackMatrixCmplx16       A;
-	LapackMatrixCmplx16      AF;
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class ZSHIFTSV : Created for solving the shifted systems
+//
+//    (A - sigma I) X = B
+//
+// for a sequence of complex shifts sigma with the same complex matrix A.
+// A is reduced once to upper Hessenberg form with ZGEHRD, after which
+// each shift requires O(N^2) operations.
+//
+// A real matrix A with complex shifts, e.g. sigma = i*omega in a
+// frequency response sweep, is specified using the LapackMatrixCmplx16
+// initialize(realA, imagA) member function with imagA = 0.
+//
+// ZSHIFTSV is the complex*16 instance of the class template SHIFTSV<T>
+// defined in SCC_LapackMatrixRoutines.h.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-};
+typedef SHIFTSV< std::complex<double> > ZSHIFTSV;
 
 
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -272,8 +179,15 @@ public:
 // of a complex Hermitian matrix A in packed storage.
 // Eigenvalues/vectors can be selected by specifying either a range of
 // values or a range of indices for the desired eigenvalues.
+//
+// The matrix may be specified as a LapackMatrixCmplx16, in which case
+// its upper triangle is copied to packed form, or as a
+// LapackHermPackedMatrix, which is passed to ZHPEVX without conversion.
+// Since ZHPEVX overwrites the packed matrix, a LapackHermPackedMatrix
+// argument is copied unless overwriteA = true, in which case no
+// additional matrix storage is allocated and the contents of the
+// argument are destroyed.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
-
 class ZHPEVX
 {
 public :
@@ -300,7 +214,14 @@ public :
 			throw std::runtime_error("\nZHPEVX : Non-square matrix input argument  \n");
 	}
 
-    long N = A.getRowDimension();
+    AP.initialize(A);
+    return createAlgSmallestEigensystem(eigCount,AP,eigValues,eigVectors,true);
+	}
+
+	long createAlgSmallestEigensystem(long eigCount, SCC::LapackHermPackedMatrix& A, std::vector<double>& eigValues,
+			                          SCC::LapackMatrixCmplx16& eigVectors, bool overwriteA = false)
+	{
+    long N = A.getDimension();
 
     if(eigCount > N)
     {
@@ -312,83 +233,111 @@ public :
 
     char JOBZ   = 'V'; // Specify N for eigenvalues only
     char RANGE  = 'I'; // Specify index range of eigenvalues to be find (A for all, V for interval)
-    char UPLO   = 'U'; // Store complex Hermetian matrix in upper trianglar packed form
-
-    AP.initialize(A.createUpperTriPacked());
-
-    double VL = 0;
-    double VU = 0;
 
     long IL = 1;        // Index of smallest eigenvalue returned
     long IU = eigCount; // Index of largest  eigenvalue returned
 
-    char   DLAMCH_IN = 'S';
-    double ABSTOL    =  2.0*(dlamch_(&DLAMCH_IN));
+    long LDZ   = N;
+    long Mstar = (IU-IL) + 1;              // Maximal number of eigenvalues to be computed when using index specification
 
-    long M = 0;                            // Number of eigenvalues output
+    eigVectors.initialize(LDZ,Mstar);      // Matrix whose columns containing the eigenvectors (Z in original call)
 
-    eigValues.clear();                     // W parameter in original call
-    eigValues.resize(N,0.0);
+    return zhpevx(JOBZ,RANGE,IL,IU,A,overwriteA,eigValues,eigVectors.mData.getDataPointer(),LDZ);
+	}
+
+    // Computes all eigenvalues and eigenvectors.
+	// The value returned is the number of eigenvalues found.
+
+	long createEigensystem(SCC::LapackMatrixCmplx16& A, std::vector<double>& eigValues, SCC::LapackMatrixCmplx16& eigVectors)
+	{
+    if(A.getRowDimension() != A.getColDimension())
+	{
+			throw std::runtime_error("\nZHPEVX : Non-square matrix input argument  \n");
+	}
+
+    AP.initialize(A);
+    return createEigensystem(AP,eigValues,eigVectors,true);
+	}
+
+	long createEigensystem(SCC::LapackHermPackedMatrix& A, std::vector<double>& eigValues, SCC::LapackMatrixCmplx16& eigVectors,
+	                       bool overwriteA = false)
+	{
+    long N = A.getDimension();
+
+    char JOBZ   = 'V'; // Specify N for eigenvalues only
+    char RANGE  = 'A'; // Specify index range of eigenvalues to be find (A for all, V for interval)
+
+    long IL = 1; // Index of smallest eigenvalue returned
+    long IU = N; // Index of largest  eigenvalue returned
 
     long LDZ   = N;
-    long Mstar = (IU-IL) + 1;              // Maximal number of eigenvalues to be computed when using index specification
+    long Mstar = N;                       // Maximal number of eigenvalues to be computed when using index specification
 
     eigVectors.initialize(LDZ,Mstar);      // Matrix whose columns containing the eigenvectors (Z in original call)
 
-    long INFO = 0;
-
-    WORK.initialize();
-    RWORK.clear();
-    IWORK.clear();
-    IFAIL.clear();
+    return zhpevx(JOBZ,RANGE,IL,IU,A,overwriteA,eigValues,eigVectors.mData.getDataPointer(),LDZ);
+	}
 
-    WORK.initialize(2*N,1);
-    RWORK.resize(7*N,0.0);
-    IWORK.resize(5*N,0);
-    IFAIL.resize(N,0);
+    long createAlgSmallestEigenvalues(long eigCount, SCC::LapackMatrixCmplx16& A, std::vector<double>& eigValues)
+	{
+    if(A.getRowDimension() != A.getColDimension())
+	{
+	    throw std::runtime_error("\nZHPEVX : Non-square matrix input argument  \n");
+	}
 
+    AP.initialize(A);
+    return createAlgSmallestEigenvalues(eigCount,AP,eigValues,true);
+	}
 
-    zhpevx_(&JOBZ, &RANGE, &UPLO,&N,AP.mData.getDataPointer(),&VL,&VU,&IL,&IU,&ABSTOL,&M,eigValues.data(),
-    eigVectors.mData.getDataPointer(),&LDZ,WORK.mData.getDataPointer(),RWORK.data(),IWORK.data(),IFAIL.data(),&INFO);
+    long createAlgSmallestEigenvalues(long eigCount, SCC::LapackHermPackedMatrix& A, std::vector<double>& eigValues,
+                                      bool overwriteA = false)
+	{
+    long N = A.getDimension();
 
-    if(INFO != 0)
+    if(eigCount > N)
     {
     	std::stringstream sout;
-    	sout << "\nZHPEVX \nError INFO = " << INFO << "\n";
+    	sout << "\nZHPEVX Error \n";
+    	sout << "Requested number of eigenvalues exceeds system dimension. \n";
     	throw std::runtime_error(sout.str());
     }
 
-    // resize the eig values array to the number of eigenvalues found
+    char JOBZ   = 'N'; // Specify N for eigenvalues only
+    char RANGE  = 'I'; // Specify index range of eigenvalues to be find (A for all, V for interval)
 
-    eigValues.resize(M);
-    return M;
-	}
-	
-	
-    // Computes the eigCount algebraically smallest eigenvalues and eigenvectors.
-	// The value returned is the number of eigenvalues found.
+    long IL = 1;        // Index of smallest eigenvalue returned
+    long IU = eigCount; // Index of largest  eigenvalue returned
 
-	long createEigensystem(SCC::LapackMatrixCmplx16& A, std::vector<double>& eigValues, SCC::LapackMatrixCmplx16& eigVectors)
-	{
-    if(A.getRowDimension() != A.getColDimension())
-	{
-			throw std::runtime_error("\nZHPEVX : Non-square matrix input argument  \n");
+    long LDZ       = 1;
+    double Zdata[2] = {0.0,0.0};   // Reference for null eigenvector
+
+    return zhpevx(JOBZ,RANGE,IL,IU,A,overwriteA,eigValues,Zdata,LDZ);
 	}
 
-    long N = A.getRowDimension();
 
-    char JOBZ   = 'V'; // Specify N for eigenvalues only
-    char RANGE  = 'A'; // Specify index range of eigenvalues to be find (A for all, V for interval)
-    char UPLO   = 'U'; // Store complex Hermetian matrix in upper trianglar packed form
+	SCC::LapackHermPackedMatrix   AP; // For storing packed matrix in packed Hermitian form
+
+    SCC::LapackMatrixCmplx16    WORK;
+    std::vector<double>        RWORK;
+    std::vector<long>          IWORK;
+    std::vector<long>          IFAIL;
 
-    AP.initialize(A.createUpperTriPacked());
+private :
+
+    long zhpevx(char JOBZ, char RANGE, long IL, long IU, SCC::LapackHermPackedMatrix& A, bool overwriteA,
+                std::vector<double>& eigValues, double* Zptr, long LDZ)
+    {
+    // ZHPEVX overwrites the packed matrix data
+
+    if((not overwriteA)&&(&A != &AP)) {AP.initialize(A);}
+    double* APptr = overwriteA ? A.getDataPointer() : AP.getDataPointer();
+
+    long N      = A.getDimension();
+    char UPLO   = 'U'; // Store complex Hermetian matrix in upper trianglar packed form
 
     double VL = 0;
     double VU = 0;
 
-    long IL = 1; // Index of smallest eigenvalue returned
-    long IU = N; // Index of largest  eigenvalue returned
-
     char   DLAMCH_IN = 'S';
     double ABSTOL    =  2.0*(dlamch_(&DLAMCH_IN));
 
@@ -397,11 +346,6 @@ public :
     eigValues.clear();                     // W parameter in original call
     eigValues.resize(N,0.0);
 
-    long LDZ   = N;
-    long Mstar = N;                       // Maximal number of eigenvalues to be computed when using index specification
-
-    eigVectors.initialize(LDZ,Mstar);      // Matrix whose columns containing the eigenvectors (Z in original call)
-
     long INFO = 0;
 
     WORK.initialize();
@@ -414,9 +358,8 @@ public :
     IWORK.resize(5*N,0);
     IFAIL.resize(N,0);
 
-
-    zhpevx_(&JOBZ, &RANGE, &UPLO,&N,AP.mData.getDataPointer(),&VL,&VU,&IL,&IU,&ABSTOL,&M,eigValues.data(),
-    eigVectors.mData.getDataPointer(),&LDZ,WORK.mData.getDataPointer(),RWORK.data(),IWORK.data(),IFAIL.data(),&INFO);
+    zhpevx_(&JOBZ, &RANGE, &UPLO,&N,APptr,&VL,&VU,&IL,&IU,&ABSTOL,&M,eigValues.data(),
+    Zptr,&LDZ,WORK.mData.getDataPointer(),RWORK.data(),IWORK.data(),IFAIL.data(),&INFO);
 
     if(INFO != 0)
     {
@@ -429,84 +372,384 @@ public :
 
     eigValues.resize(M);
     return M;
-	}
+    }
+};
 
-    long createAlgSmallestEigenvalues(long eigCount, SCC::LapackMatrixCmplx16& A, std::vector<double>& eigValues)
-	{
-    if(A.getRowDimension() != A.getColDimension())
-	{
-	    throw std::runtime_error("\nZHPEVX : Non-square matrix input argument  \n");
-	}
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class  ZHEEVR : Created for computing eigensystem components
+//                 of a Hermitian complex matrix in full storage.
+// LAPACK base routine description:
+// ZHEEVR computes selected eigenvalues and, optionally, eigenvectors
+// of a complex Hermitian matrix A.  Eigenvalues and eigenvectors can
+// be selected by specifying either a range of values or a range of
+// indices for the desired eigenvalues.
+//
+// ZHEEVR reduces A to tridiagonal form with blocked (Level 3 BLAS)
+// Householder transformations and computes eigenvectors with the
+// MRRR algorithm, so for large N it is substantially faster than the
+// packed storage routine used by ZHPEVX.
+//
+// Only the upper triangle of A is referenced. Since ZHEEVR overwrites
+// the upper triangle, A is copied unless overwriteA = true, in which
+// case the computation is performed in place in A.mData and no
+// additional matrix storage is allocated.
+//
+// Workspace sizes are obtained with a workspace query and the work
+// arrays are retained for subsequent invocations.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-    long N = A.getRowDimension();
+class ZHEEVR
+{
+public :
 
-    if(eigCount > N)
+    ZHEEVR()
+    {
+    initialize();
+    }
+
+    void initialize()
+    {
+    A.initialize();
+    WORK.clear();
+    RWORK.clear();
+    IWORK.clear();
+    ISUPPZ.clear();
+    }
+
+    // Computes the eigCount algebraically smallest eigenvalues and eigenvectors.
+    // The value returned is the number of eigenvalues found.
+
+    long createAlgSmallestEigensystem(long eigCount, SCC::LapackMatrixCmplx16& H, std::vector<double>& eigValues,
+                                      SCC::LapackMatrixCmplx16& eigVectors, bool overwriteA = false)
+    {
+    eigCountCheck(eigCount,H);
+    return zheevr('V','I',0.0,0.0,1,eigCount,H,overwriteA,eigValues,&eigVectors);
+    }
+
+    // Computes all eigenvalues and eigenvectors.
+    // The value returned is the number of eigenvalues found.
+
+    long createEigensystem(SCC::LapackMatrixCmplx16& H, std::vector<double>& eigValues,
+                           SCC::LapackMatrixCmplx16& eigVectors, bool overwriteA = false)
+    {
+    return zheevr('V','A',0.0,0.0,0,0,H,overwriteA,eigValues,&eigVectors);
+    }
+
+    // Computes the eigenvalues in the half-open interval (lambdaMin, lambdaMax]
+    // and their eigenvectors. The value returned is the number of eigenvalues found.
+
+    long createEigensystem(double lambdaMin, double lambdaMax, SCC::LapackMatrixCmplx16& H,
+                           std::vector<double>& eigValues, SCC::LapackMatrixCmplx16& eigVectors, bool overwriteA = false)
+    {
+    return zheevr('V','V',lambdaMin,lambdaMax,0,0,H,overwriteA,eigValues,&eigVectors);
+    }
+
+    long createAlgSmallestEigenvalues(long eigCount, SCC::LapackMatrixCmplx16& H, std::vector<double>& eigValues,
+                                      bool overwriteA = false)
+    {
+    eigCountCheck(eigCount,H);
+    return zheevr('N','I',0.0,0.0,1,eigCount,H,overwriteA,eigValues,nullptr);
+    }
+
+    long createEigenvalues(SCC::LapackMatrixCmplx16& H, std::vector<double>& eigValues, bool overwriteA = false)
+    {
+    return zheevr('N','A',0.0,0.0,0,0,H,overwriteA,eigValues,nullptr);
+    }
+
+    // Computes the eigenvalues in the half-open interval (lambdaMin, lambdaMax].
+    // The value returned is the number of eigenvalues found.
+
+    long createEigenvalues(double lambdaMin, double lambdaMax, SCC::LapackMatrixCmplx16& H,
+                           std::vector<double>& eigValues, bool overwriteA = false)
+    {
+    return zheevr('N','V',lambdaMin,lambdaMax,0,0,H,overwriteA,eigValues,nullptr);
+    }
+
+    SCC::LapackMatrixCmplx16       A; // Copy of the input matrix when overwriteA = false
+
+    std::vector<double>         WORK; // Complex work array stored as interleaved real and imaginary parts
+    std::vector<double>        RWORK;
+    std::vector<long>          IWORK;
+    std::vector<long>         ISUPPZ;
+
+private :
+
+    void eigCountCheck(long eigCount, const SCC::LapackMatrixCmplx16& H) const
+    {
+    if(eigCount > H.getRowDimension())
     {
     	std::stringstream sout;
-    	sout << "\nZHPEVX Error \n";
-    	sout << "Requested number of eigenvalues exceeds system dimension. \n";
+    	sout << "\nZHEEVR Error \n";
+    	sout << "Requested number of eigenvalues/eigenvectors exceeds system dimension. \n";
     	throw std::runtime_error(sout.str());
     }
+    }
 
-    char JOBZ   = 'N'; // Specify N for eigenvalues only
-    char RANGE  = 'I'; // Specify index range of eigenvalues to be find (A for all, V for interval)
-    char UPLO   = 'U'; // Store complex Hermetian matrix in upper trianglar packed form
+    long zheevr(char JOBZ, char RANGE, double VL, double VU, long IL, long IU, SCC::LapackMatrixCmplx16& H,
+                bool overwriteA, std::vector<double>& eigValues, SCC::LapackMatrixCmplx16* eigVectors)
+    {
+    if(H.getRowDimension() != H.getColDimension())
+	{
+			throw std::runtime_error("\nZHEEVR : Non-square matrix input argument  \n");
+	}
 
-    AP.initialize(A.createUpperTriPacked());
+    long N = H.getRowDimension();
 
-    double VL = 0;
-    double VU = 0;
+    if(not overwriteA) {A.initialize(H);}
+    double* Aptr = overwriteA ? H.mData.getDataPointer() : A.mData.getDataPointer();
 
-    long IL = 1;        // Index of smallest eigenvalue returned
-    long IU = eigCount; // Index of largest  eigenvalue returned
+    char UPLO = 'U';
+    long LDA  = N;
 
     char   DLAMCH_IN = 'S';
-    double ABSTOL    =  2.0*(dlamch_(&DLAMCH_IN));
+    double ABSTOL    = dlamch_(&DLAMCH_IN);
 
-    long M = 0;                     // Number of eigenvalues output
+    long M = 0;                            // Number of eigenvalues output
 
-    eigValues.clear();              // W parameter in original call
+    eigValues.clear();                     // W parameter in original call
     eigValues.resize(N,0.0);
 
+    // Eigenvectors for a value range are computed in an N x N array and then
+    // truncated to the number found
+
     long LDZ     = 1;
-    double Zdata = 0.0;              // Double value to be used as reference for null eigenvector
+    double Zdata[2] = {0.0,0.0};           // Reference for null eigenvector
+    double* Zptr = Zdata;
+
+    if(JOBZ == 'V')
+    {
+    LDZ = N;
+    if(RANGE == 'I') {eigVectors->initialize(N,(IU-IL)+1);}
+    else             {eigVectors->initialize(N,N);}
+    Zptr = eigVectors->mData.getDataPointer();
+    }
+
+    ISUPPZ.resize(2*std::max(N,(long)1),0);
 
     long INFO = 0;
 
-    WORK.initialize();
-    RWORK.clear();
-    IWORK.clear();
-    IFAIL.clear();
+    // workspace query
 
-    WORK.initialize(2*N,1);
-    RWORK.resize(7*N,0.0);
-    IWORK.resize(5*N,0);
-    IFAIL.resize(N,0);
+    long LWORK  = -1;
+    long LRWORK = -1;
+    long LIWORK = -1;
+
+    double WORKtmp[2]; double RWORKtmp; long IWORKtmp;
+
+    zheevr_(&JOBZ,&RANGE,&UPLO,&N,Aptr,&LDA,&VL,&VU,&IL,&IU,&ABSTOL,&M,eigValues.data(),Zptr,&LDZ,
+    ISUPPZ.data(),WORKtmp,&LWORK,&RWORKtmp,&LRWORK,&IWORKtmp,&LIWORK,&INFO);
 
+    LWORK  = (long)WORKtmp[0];
+    LRWORK = (long)RWORKtmp;
+    LIWORK = IWORKtmp;
 
-    zhpevx_(&JOBZ, &RANGE, &UPLO,&N,AP.mData.getDataPointer(),&VL,&VU,&IL,&IU,&ABSTOL,&M,eigValues.data(),
-    &Zdata,&LDZ,WORK.mData.getDataPointer(),RWORK.data(),IWORK.data(),IFAIL.data(),&INFO);
+    if((long)WORK.size()  < 2*LWORK)  {WORK.resize(2*LWORK);}
+    if((long)RWORK.size() < LRWORK)   {RWORK.resize(LRWORK);}
+    if((long)IWORK.size() < LIWORK)   {IWORK.resize(LIWORK);}
+
+    zheevr_(&JOBZ,&RANGE,&UPLO,&N,Aptr,&LDA,&VL,&VU,&IL,&IU,&ABSTOL,&M,eigValues.data(),Zptr,&LDZ,
+    ISUPPZ.data(),WORK.data(),&LWORK,RWORK.data(),&LRWORK,IWORK.data(),&LIWORK,&INFO);
 
     if(INFO != 0)
     {
     	std::stringstream sout;
-    	sout << "\nZHPEVX \nError INFO = " << INFO << "\n";
+    	sout << "\nZHEEVR \nError INFO = " << INFO << "\n";
     	throw std::runtime_error(sout.str());
     }
 
+    // resize the eig values array and the eigenvector matrix to the number of
+    // eigenvalues found
+
     eigValues.resize(M);
+
+    if((JOBZ == 'V')&&(eigVectors->getColDimension() != M))
+    {
+    SCC::LapackMatrixCmplx16 Z(N,M);
+    std::memcpy(Z.mData.getDataPointer(),eigVectors->mData.getDataPointer(),2*N*M*sizeof(double));
+    eigVectors->initialize(Z);
+    }
+
     return M;
-	}
+    }
+};
 
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class  ZHPSV : Created for solving A*X = B when A is a complex Hermitian
+//                indefinite matrix in packed storage.
+// LAPACK base routines description:
+// ZHPTRF computes the factorization of a complex Hermitian packed
+// matrix A using the Bunch-Kaufman diagonal pivoting method:
+//
+//    A = U*D*U**H  or  A = L*D*L**H
+//
+// ZHPTRS solves a system of linear equations A*X = B with a complex
+// Hermitian matrix A stored in packed format using the factorization
+// A = U*D*U**H or A = L*D*L**H computed by ZHPTRF.
+//
+// The factors are created from the upper packed storage of a
+// LapackHermPackedMatrix, cached, and re-used by each applyInverse(...)
+// invocation. The factors can be created in a copy of the input matrix
+// data, or, to avoid the copy, in place in the data of the input matrix.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
-	SCC::LapackMatrixCmplx16      AP; // For storing packed matrix in packed Hermitian form
+class ZHPSV
+{
+public :
 
-    SCC::LapackMatrixCmplx16    WORK;
-    std::vector<double>        RWORK;
-    std::vector<long>          IWORK;
-    std::vector<long>          IFAIL;
+    ZHPSV()
+    {
+    initialize();
+    }
+
+    ZHPSV(const ZHPSV& zhpsv)
+    {
+    initialize(zhpsv);
+    }
+
+    void initialize()
+    {
+    APfactors.initialize();
+    IPIV.clear();
+    N    = 0;
+    INFO = 0;
+    }
+
+    void initialize(const ZHPSV& zhpsv)
+    {
+    APfactors.initialize(zhpsv.APfactors);
+    IPIV = zhpsv.IPIV;
+    N    = zhpsv.N;
+    INFO = zhpsv.INFO;
+    }
+
+    //
+    // Creates the factors of a copy of the matrix data of H.
+    //
+    void createFactors(const SCC::LapackHermPackedMatrix& H)
+    {
+    APfactors.initialize(H);
+    factor();
+    }
+
+    //
+    // Creates the factors in place.
+    //
+    // !!! Important: APdata, the upper packed storage of an N x N Hermitian
+    // matrix, e.g. H.getDataPointer() for a LapackHermPackedMatrix H, is
+    // overwritten by the factors and must remain allocated while the factors
+    // are in use. No bounds checking is performed.
+    //
+    void createFactors(long N, double* APdata)
+    {
+    APfactors.initialize();  // release any locally allocated factors before adopting APdata
+    APfactors.initialize(N,APdata);
+    factor();
+    }
+
+    void applyInverse(std::vector<std::complex<double>>& b)
+    {
+    assert(sizeCheck((long)b.size(),N));
+    applyInverse(reinterpret_cast<double*>(&b[0]));
+    }
+
+    void applyInverse(SCC::LapackMatrixCmplx16& B)
+    {
+    assert(sizeCheck(B.getRowDimension(),N));
+    applyInverse(B.mData.getDataPointer(),B.getColDimension());
+    }
+
+    //
+    // Overwrites the N x NRHS complex array b, stored by columns with
+    // interleaved real and imaginary parts, with the solution of A*X = b.
+    //
+    void applyInverse(double* b, long NRHS = 1)
+    {
+    if(INFO > 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nZHPSV (zhptrs) Error \n";
+    	sout << "Matrix is singular: D(" << INFO-1 << "," << INFO-1 << ") = 0 \n";
+    	throw std::runtime_error(sout.str());
+    }
+
+    char UPLO  = 'U';
+    long LDB   = N;
+    long INFOs = 0;
+
+    zhptrs_(&UPLO, &N, &NRHS, APfactors.getDataPointer(), &IPIV[0], b, &LDB, &INFOs);
+
+    if(INFOs != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nZHPSV (zhptrs) \nError INFO = " << INFOs << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+    }
+
+    bool isSingular() const
+    {
+    return (INFO > 0);
+    }
+
+#ifdef _DEBUG
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "ZHPSV sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+    SCC::LapackHermPackedMatrix APfactors;
+    std::vector<long>                IPIV;
+
+    long    N;
+    long INFO;
+
+private :
+
+    void factor()
+    {
+    N = APfactors.getDimension();
+    IPIV.resize(N);
+
+    char UPLO = 'U';
+    INFO      = 0;
+
+    zhptrf_(&UPLO, &N, APfactors.getDataPointer(), &IPIV[0], &INFO);
+
+    if(INFO < 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nZHPSV (zhptrf) \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+    }
 };
 
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class  ZPOSV : Created for solving A*X = B using the Cholesky factorization
+//                when A is a complex Hermitian positive definite matrix.
+// LAPACK base routines description:
+// ZPOTRF computes the Cholesky factorization of a complex Hermitian
+// positive definite matrix A.
+// ZPOTRS solves a system of linear equations A*X = B with a Hermitian
+// positive definite matrix A using the Cholesky factorization
+// A = U**H*U or A = L*L**H computed by ZPOTRF.
+// ZPOCON estimates the reciprocal of the condition number (in the
+// 1-norm) of a complex Hermitian positive definite matrix using the
+// Cholesky factorization computed by ZPOTRF.
+//
+// ZPOSV is the complex*16 instance of the cached Cholesky class template
+// POSV<T> defined in SCC_LapackMatrixRoutines.h.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+typedef POSV< std::complex<double> > ZPOSV;
 
 
 
@@ -517,6 +760,16 @@ public :
 // LAPACK base routine description:
 // ZGEEVX computes for an N-by-N complex general matrix A, the
 // eigenvalues and, optionally, the left and/or right eigenvectors.
+//
+// The member functions compute the eigenvalues only, the eigenvalues
+// and right eigenvectors, or the eigenvalues and left and right
+// eigenvectors, so that outputs that are not required are not computed.
+// In the last case the reciprocal condition numbers of the eigenvalues
+// (RCONDE) and right eigenvectors (RCONDV) are computed unless
+// computeConditionNumbers = false.
+//
+// The input matrix is copied and balanced (BALANC = 'B'), and the work
+// array size is obtained with a workspace query.
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
 class ZGEEVX 
@@ -535,39 +788,73 @@ public :
     RCONDV.clear();
 	}
 
-	
-    // Computes the eigenvalues and left and right eigenvectors.
+    // Computes the eigenvalues.
+
+	void createEigenvalues(SCC::LapackMatrixCmplx16& A, std::vector<std::complex<double>>& eigValues)
+	{
+	zgeevx('N','N','N',A,eigValues,nullptr,nullptr);
+	}
+
+    // Computes the eigenvalues and right eigenvectors.
+
+	void createEigensystem(SCC::LapackMatrixCmplx16& A, std::vector<std::complex<double>>& eigValues,
+	SCC::LapackMatrixCmplx16& eigVecRight)
+	{
+	eigVecRight.initialize(A.getRowDimension(),A.getRowDimension());
+	zgeevx('N','V','N',A,eigValues,nullptr,&eigVecRight);
+	}
+
+    // Computes the eigenvalues and left and right eigenvectors, and, unless
+    // computeConditionNumbers = false, the reciprocal condition numbers of the
+    // eigenvalues (RCONDE) and right eigenvectors (RCONDV).
 
 	void createEigensystem(SCC::LapackMatrixCmplx16& A,
 	std::vector<std::complex<double>>& eigValues,
 	SCC::LapackMatrixCmplx16& eigVecLeft,
-	SCC::LapackMatrixCmplx16& eigVecRight)
+	SCC::LapackMatrixCmplx16& eigVecRight, bool computeConditionNumbers = true)
+	{
+	eigVecLeft.initialize(A.getRowDimension(),A.getRowDimension());
+	eigVecRight.initialize(A.getRowDimension(),A.getRowDimension());
+	char SENSE = computeConditionNumbers ? 'B' : 'N';
+	zgeevx('V','V',SENSE,A,eigValues,&eigVecLeft,&eigVecRight);
+	}
+
+
+	SCC::LapackMatrixCmplx16      AS; // Copy of input matrix (S for scaled)
+
+    std::vector<double> WORK;
+    std::vector<double> RWORK;
+    std::vector<double> SCALE;
+    std::vector<double> RCONDE;
+    std::vector<double> RCONDV;
+
+private :
+
+	void zgeevx(char JOBVL, char JOBVR, char SENSE, SCC::LapackMatrixCmplx16& A,
+	std::vector<std::complex<double>>& eigValues, SCC::LapackMatrixCmplx16* eigVecLeft,
+	SCC::LapackMatrixCmplx16* eigVecRight)
 	{
     if(A.getRowDimension() != A.getColDimension())
 	{
-			throw std::runtime_error("\nZHPEVX : Non-square matrix input argument  \n");
+			throw std::runtime_error("\nZGEEVX : Non-square matrix input argument  \n");
 	}
 
 	AS.initialize(A); // Copy input matrix since scaling and permuting
 
 	char BALANC = 'B';  // Both diagonally scale and permute the copy of A.
-    char JOBVL  = 'V'; 	// Compute left eigenvectors
-    char JOBVR  = 'V'; 	// Compute right eigenvectors
-    char SENSE  = 'B';  // Compute left and right eigenvector reciprocal condition numbers
     long N      = A.getRowDimension();
-    long LDA    = N;
+    long LDA    = std::max(N,(long)1);
 
     eigValues.resize(N,{0.0,0.0});
-    double* eigValuePtr = reinterpret_cast<double*>(const_cast< std::complex<double>* >(&eigValues[0]));
+    double* eigValuePtr = reinterpret_cast<double*>(&eigValues[0]);
 
-    eigVecLeft.initialize(N,N);
-    eigVecRight.initialize(N,N);
+    double VLdummy[2] = {0.0,0.0};
+    double VRdummy[2] = {0.0,0.0};
 
-    double* VLptr = eigVecLeft.mData.getDataPointer();
-    long LDVL     = N;
-
-    double* VRptr = eigVecRight.mData.getDataPointer();
-    long LDVR     = N;
+    double* VLptr = (JOBVL == 'V') ? eigVecLeft->mData.getDataPointer()  : VLdummy;
+    double* VRptr = (JOBVR == 'V') ? eigVecRight->mData.getDataPointer() : VRdummy;
+    long LDVL     = (JOBVL == 'V') ? LDA : 1;
+    long LDVR     = (JOBVR == 'V') ? LDA : 1;
 
     long ILO      = 0;
     long IHI      = 0;
@@ -576,19 +863,41 @@ public :
 
     double ABNRM;
 
+    if(SENSE != 'N')
+    {
     RCONDE.resize(N,0.0);
     RCONDV.resize(N,0.0);
+    }
+    else
+    {
+    RCONDE.clear();
+    RCONDV.clear();
+    }
 
-    RWORK.resize(2*N,0.0);
+    double RCONDEdummy = 0.0;
+    double RCONDVdummy = 0.0;
+    double* RCONDEptr  = (SENSE != 'N') ? RCONDE.data() : &RCONDEdummy;
+    double* RCONDVptr  = (SENSE != 'N') ? RCONDV.data() : &RCONDVdummy;
+
+    RWORK.resize(std::max(2*N,(long)1),0.0);
     long INFO = 0;
 
-    long LWORK = N*N + 3*N;
-    WORK.resize(2*LWORK); // 2 X LWORK since need complex*16
+    // workspace query
+
+    long LWORK = -1;
+    double WORKtmp[2];
+
+    zgeevx_(&BALANC,&JOBVL, &JOBVR, &SENSE,&N,AS.mData.getDataPointer(), &LDA,
+        eigValuePtr, VLptr, &LDVL, VRptr,&LDVR, &ILO, &IHI, &SCALE[0], &ABNRM,
+        RCONDEptr, RCONDVptr, WORKtmp,&LWORK, &RWORK[0], &INFO);
 
+    LWORK = (long)WORKtmp[0];
+    if((long)WORK.size() < 2*LWORK) {WORK.resize(2*LWORK);} // 2 X LWORK since need complex*16
+    LWORK = (long)WORK.size()/2;
 
     zgeevx_(&BALANC,&JOBVL, &JOBVR, &SENSE,&N,AS.mData.getDataPointer(), &LDA,
         eigValuePtr, VLptr, &LDVL, VRptr,&LDVR, &ILO, &IHI, &SCALE[0], &ABNRM,
-        &RCONDE[0], &RCONDV[0], &WORK[0],&LWORK, &RWORK[0], &INFO);
+        RCONDEptr, RCONDVptr, &WORK[0],&LWORK, &RWORK[0], &INFO);
 
     if(INFO != 0)
     {
@@ -596,19 +905,7 @@ public :
     	sout << "\nZGEEVX \nError INFO = " << INFO << "\n";
     	throw std::runtime_error(sout.str());
     }
-
 	}
-
-
-
-
-	SCC::LapackMatrixCmplx16      AS; // Copy of input matrix (S for scaled)
-
-    std::vector<double> WORK;
-    std::vector<double> RWORK;
-    std::vector<double> SCALE;
-    std::vector<double> RCONDE;
-    std::vector<double> RCONDV;
 };
 
 
@@ -628,6 +925,11 @@ public :
 // selected eigenvalues (RCONDV).  The leading columns of Z form an
 // orthonormal basis for this invariant subspace.
 //
+// Eigenvalues may be selected by the sign of their real part or by
+// an arbitrary predicate. A Schur decomposition that has already been
+// computed can be reordered for a different selection using
+// reorderSchurForm(...), which is based on the LAPACK routine ZTRSEN.
+//
 // Note: Using ints for LOGICAL arguments instead of C++ bool. Since
 // values are passed by pointer, this will support LOGICAL values
 // used by Fortran declared LOGICAL(1) through LOGICAL(4).
@@ -665,6 +967,27 @@ public:
 
 enum {NONE, SORT_POS, SORT_NEG};
 
+//
+// Eigenvalue selection predicate : returns true if the eigenvalue
+// is to be placed in the upper left of the Schur decomposition.
+//
+typedef std::function<bool(std::complex<double>)> EigSelector;
+
+ZGEESX()
+{
+    initialize();
+}
+
+void initialize()
+{
+    RCONDE = 0.0;
+    RCONDV = 0.0;
+    WORK.clear();
+    RWORK.clear();
+    BWORK.clear();
+    SELECT.clear();
+}
+
 //
 // The input matrix is not altered, on output Q contains the Schur
 // vectors and T the upper triangular decomposition of A with
@@ -687,82 +1010,128 @@ SCC::LapackMatrixCmplx16& Q, SCC::LapackMatrixCmplx16& T,
 std::vector<std::complex<double>>& eigValues,
 long& sortedDim, int sortType = ZGEESX::NONE)
 {
-    long N        =  A.rows;
-
-    char JOBVS    = 'V'; // Compute Schur vectors
-
-    char SORTFLAG = 'S'; // Sort eigenvalues
-
-    if(sortType == ZGEESX::NONE){SORTFLAG = 'N';}
+    if(sortType == ZGEESX::SORT_POS)
+    {
+    zgeesx('S',eigSelectRealPos,A,Q,T,eigValues,sortedDim);
+    }
+    else if(sortType == ZGEESX::SORT_NEG)
+    {
+    zgeesx('S',eigSelectRealNeg,A,Q,T,eigValues,sortedDim);
+    }
+    else
+    {
+    zgeesx('N',eigSelectRealPos,A,Q,T,eigValues,sortedDim);
+    }
+}
 
-    char SENSE    = 'B';
-    if(sortType == ZGEESX::NONE)
+//
+// As above, but the eigenvalues located in the upper left quadrant
+// of the decomposition are those for which select(lambda) is true,
+// e.g. to select the eigenvalues inside the disk |lambda - c| < r
+//
+// computeSchurDecomposition(A,Q,T,eigValues,sortedDim,
+//       [c,r](std::complex<double> lambda){return std::abs(lambda - c) < r;});
+//
+// The predicate is invoked from within zgeesx through a thread local
+// trampoline, so distinct instances may be used concurrently from
+// separate threads. The predicate must not throw an exception.
+//
+void computeSchurDecomposition(const SCC::LapackMatrixCmplx16& A,
+SCC::LapackMatrixCmplx16& Q, SCC::LapackMatrixCmplx16& T,
+std::vector<std::complex<double>>& eigValues,
+long& sortedDim, const EigSelector& select)
+{
+    const EigSelector* previousSelector = activeSelector();
+    activeSelector() = &select;
+    try
     {
-    SENSE     = 'N';
-    RCONDE    = 0.0; // Infinite condition numbers if no sorting
-    RCONDV    = 0.0; // Infinite condition numbers if no sorting
-    sortedDim = 0;
+    zgeesx('S',eigSelectTrampoline,A,Q,T,eigValues,sortedDim);
     }
+    catch(...)
+    {
+    activeSelector() = previousSelector;
+    throw;
+    }
+    activeSelector() = previousSelector;
+}
 
-    long NSIZE    =  N;
+//
+// Reorders the Schur decomposition (Q,T) obtained from a previous
+// invocation of computeSchurDecomposition so that the eigenvalues for
+// which select(lambda) is true are located in the upper left quadrant
+// of T. Q and T are updated in place, so a sequence of selections
+// can be applied to a single Schur decomposition of A without
+// recomputing it.
+//
+// On return eigValues contains the reordered diagonal of T and the
+// first sortedDim columns of Q form an invariant subspace associated
+// with the selected eigenvalues.
+//
+// If computeConditionNumbers = true, then RCONDE and RCONDV are set
+// to the reciprocal condition numbers of the selected cluster of
+// eigenvalues and of the invariant subspace; otherwise they are
+// not altered.
+//
+void reorderSchurForm(SCC::LapackMatrixCmplx16& Q, SCC::LapackMatrixCmplx16& T,
+std::vector<std::complex<double>>& eigValues, long& sortedDim,
+const EigSelector& select, bool computeConditionNumbers = true)
+{
+    long N = T.rows;
 
-    //
-    // Copy in put A to T, zgeesx will overwrite T with
-    // the upper triangular component of the decomposition
-    //
+    if((T.cols != N)||(Q.rows != N)||(Q.cols != N))
+    {
+    	std::stringstream sout;
+    	sout << "\nZGEESX::reorderSchurForm \n";
+    	sout << "Schur vectors Q and Schur form T must both be " << N << " x " << N << " \n";
+    	throw std::runtime_error(sout.str());
+    }
 
-    T.initialize(A);
-    double*Aptr  = T.mData.getDataPointer();
+    SELECT.resize(N);
+    for(long k = 0; k < N; k++)
+    {
+    SELECT[k] = select(T(k,k)) ? 1 : 0;
+    }
 
-    long LDA     = N;
+    char JOB   = computeConditionNumbers ? 'B' : 'N';
+    char COMPQ = 'V';
 
-    SCC::LapackMatrixCmplx16 cEigVals(N,1);
+    long LDT   = N;
+    long LDQ   = N;
 
-    Q.initialize(N,N);
+    eigValues.resize(N);
+    double* Wptr = reinterpret_cast<double*>(eigValues.data());
 
-    long LDVS = N;
+    double S    = 0.0;
+    double SEP  = 0.0;
 
-    long LWORK = (N*(N+1))/2;
-    std::vector<double> cWORK(2*LWORK,0.0);
-    std::vector<double> RWORK(N,0.0);
+    long INFO   = 0;
 
-    std::vector<int> BWORK(N,0); // Using int's for logical, possibly over-allocating memory
-                                 // but certainly sufficient.
+    // Workspace query
 
-    long INFO = 0;
+    long LWORK  = -1;
+    double WORKSIZE[2] = {0.0,0.0};
 
-    if(sortType == ZGEESX::SORT_POS)
-    {
-    zgeesx_(&JOBVS,&SORTFLAG,eigSelectRealPos,&SENSE,&NSIZE,Aptr,&LDA,&sortedDim,
-           cEigVals.mData.getDataPointer(),Q.mData.getDataPointer(),&LDVS,
-           &RCONDE,&RCONDV,&cWORK[0],&LWORK,&RWORK[0],&BWORK[0],&INFO);
-    }
-    else if(sortType == ZGEESX::SORT_NEG)
-    {
-    zgeesx_(&JOBVS,&SORTFLAG,eigSelectRealNeg,&SENSE,&NSIZE,Aptr,&LDA,&sortedDim,
-           cEigVals.mData.getDataPointer(),Q.mData.getDataPointer(),&LDVS,
-           &RCONDE,&RCONDV,&cWORK[0],&LWORK,&RWORK[0],&BWORK[0],&INFO);
-    }
-    else
-    {
-    	zgeesx_(&JOBVS,&SORTFLAG,eigSelectRealPos,&SENSE,&NSIZE,Aptr,&LDA,&sortedDim,
-        cEigVals.mData.getDataPointer(),Q.mData.getDataPointer(),&LDVS,
-        &RCONDE,&RCONDV,&cWORK[0],&LWORK,&RWORK[0],&BWORK[0],&INFO);
-    }
+    ztrsen_(&JOB,&COMPQ,SELECT.data(),&N,T.mData.getDataPointer(),&LDT,Q.mData.getDataPointer(),&LDQ,
+            Wptr,&sortedDim,&S,&SEP,WORKSIZE,&LWORK,&INFO);
 
-    eigValues.resize(N);
-    for(long k = 0; k < N; k++)
-    {
-    eigValues[k] = cEigVals(k);
-    }
+    LWORK = std::max((long)WORKSIZE[0],(long)1);
+    if((long)WORK.size() < 2*LWORK) {WORK.resize(2*LWORK,0.0);}
 
+    ztrsen_(&JOB,&COMPQ,SELECT.data(),&N,T.mData.getDataPointer(),&LDT,Q.mData.getDataPointer(),&LDQ,
+            Wptr,&sortedDim,&S,&SEP,WORK.data(),&LWORK,&INFO);
 
     if(INFO != 0)
     {
     	std::stringstream sout;
-    	sout << "\nZGEESX \nError INFO = " << INFO << "\n";
+    	sout << "\nZGEESX (ztrsen) \nError INFO = " << INFO << "\n";
     	throw std::runtime_error(sout.str());
     }
+
+    if(computeConditionNumbers)
+    {
+    RCONDE = S;
+    RCONDV = SEP;
+    }
 }
 
 // A utility for creating a matrix whose columns are those of the
@@ -799,6 +1168,99 @@ void createInvariantSubpace(long sortedDim, const SCC::LapackMatrixCmplx16& Q, S
     double RCONDE;
     double RCONDV;
 
+//
+//  Work arrays, retained between invocations
+//
+    std::vector<double>  WORK; // Complex work array stored as interleaved real and imaginary parts
+    std::vector<double> RWORK;
+    std::vector<int>    BWORK; // Using int's for logical
+    std::vector<int>   SELECT; // Using int's for logical
+
+private:
+
+//
+// The selection predicate used by the trampoline is recorded in a
+// thread local variable, as zgeesx only passes the eigenvalue
+// to the selection function.
+//
+static const EigSelector*& activeSelector()
+{
+    static thread_local const EigSelector* selector = nullptr;
+    return selector;
+}
+
+static int eigSelectTrampoline(double* C)
+{
+    return (*activeSelector())(std::complex<double>(C[0],C[1])) ? 1 : 0;
+}
+
+void zgeesx(char SORTFLAG, int(*eigSelect)(double* C), const SCC::LapackMatrixCmplx16& A,
+SCC::LapackMatrixCmplx16& Q, SCC::LapackMatrixCmplx16& T,
+std::vector<std::complex<double>>& eigValues, long& sortedDim)
+{
+    long N        =  A.rows;
+
+    char JOBVS    = 'V'; // Compute Schur vectors
+
+    char SENSE    = 'B';
+    if(SORTFLAG == 'N')
+    {
+    SENSE     = 'N';
+    RCONDE    = 0.0; // Infinite condition numbers if no sorting
+    RCONDV    = 0.0; // Infinite condition numbers if no sorting
+    }
+
+    sortedDim     = 0;
+
+    long NSIZE    =  N;
+
+    //
+    // Copy in put A to T, zgeesx will overwrite T with
+    // the upper triangular component of the decomposition
+    //
+
+    T.initialize(A);
+    double*Aptr  = T.mData.getDataPointer();
+
+    long LDA     = N;
+
+    eigValues.resize(N);
+    double* Wptr = reinterpret_cast<double*>(eigValues.data());
+
+    Q.initialize(N,N);
+
+    long LDVS = N;
+
+    RWORK.resize(std::max(N,(long)1));
+    BWORK.resize(std::max(N,(long)1));
+
+    long INFO = 0;
+
+    // Workspace query; for SENSE = 'B' the size returned includes
+    // the storage required by the condition estimates.
+
+    long LWORK = -1;
+    double WORKSIZE[2] = {0.0,0.0};
+
+    zgeesx_(&JOBVS,&SORTFLAG,eigSelect,&SENSE,&NSIZE,Aptr,&LDA,&sortedDim,
+           Wptr,Q.mData.getDataPointer(),&LDVS,
+           &RCONDE,&RCONDV,WORKSIZE,&LWORK,RWORK.data(),BWORK.data(),&INFO);
+
+    LWORK = std::max((long)WORKSIZE[0],std::max(2*N,(long)1));
+    if((long)WORK.size() < 2*LWORK) {WORK.resize(2*LWORK,0.0);}
+
+    zgeesx_(&JOBVS,&SORTFLAG,eigSelect,&SENSE,&NSIZE,Aptr,&LDA,&sortedDim,
+           Wptr,Q.mData.getDataPointer(),&LDVS,
+           &RCONDE,&RCONDV,WORK.data(),&LWORK,RWORK.data(),BWORK.data(),&INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nZGEESX \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+}
+
 };
 
 
@@ -1459,6 +1921,158 @@ Univ. of Colorado Denver
 NAG Ltd.
 */
 
+/////////////////////////////////////////////////////////////////////////////
+// ZHEEVR
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine zheevr 	( 	character  	jobz,
+		character  	range,
+		character  	uplo,
+		integer  	n,
+		complex*16, dimension( lda, * )  	a,
+		integer  	lda,
+		double precision  	vl,
+		double precision  	vu,
+		integer  	il,
+		integer  	iu,
+		double precision  	abstol,
+		integer  	m,
+		double precision, dimension( * )  	w,
+		complex*16, dimension( ldz, * )  	z,
+		integer  	ldz,
+		integer, dimension( * )  	isuppz,
+		complex*16, dimension( * )  	work,
+		integer  	lwork,
+		double precision, dimension( * )  	rwork,
+		integer  	lrwork,
+		integer, dimension( * )  	iwork,
+		integer  	liwork,
+		integer  	info
+	)
+
+Purpose:
+
+ ZHEEVR computes selected eigenvalues and, optionally, eigenvectors
+ of a complex Hermitian matrix A.  Eigenvalues and eigenvectors can
+ be selected by specifying either a range of values or a range of
+ indices for the desired eigenvalues.
+
+ ZHEEVR first reduces the matrix A to tridiagonal form T with a call
+ to ZHETRD.  Then, whenever possible, ZHEEVR calls ZSTEMR to compute
+ the eigenspectrum using Relatively Robust Representations.
+
+Parameters
+[in]	JOBZ
+          = 'N':  Compute eigenvalues only;
+          = 'V':  Compute eigenvalues and eigenvectors.
+[in]	RANGE
+          = 'A': all eigenvalues will be found.
+          = 'V': all eigenvalues in the half-open interval (VL,VU]
+                 will be found.
+          = 'I': the IL-th through IU-th eigenvalues will be found.
+[in]	UPLO
+          = 'U':  Upper triangle of A is stored;
+          = 'L':  Lower triangle of A is stored.
+[in]	N
+          The order of the matrix A.  N >= 0.
+[in,out]	A
+          A is COMPLEX*16 array, dimension (LDA, N)
+          On entry, the Hermitian matrix A.  If UPLO = 'U', the
+          leading N-by-N upper triangular part of A contains the
+          upper triangular part of the matrix A.
+          On exit, the lower triangle (if UPLO='L') or the upper
+          triangle (if UPLO='U') of A, including the diagonal, is
+          destroyed.
+[in]	LDA
+          The leading dimension of the array A.  LDA >= max(1,N).
+[in]	VL, VU
+          If RANGE='V', the lower and upper bounds of the interval to
+          be searched for eigenvalues. VL < VU.
+          Not referenced if RANGE = 'A' or 'I'.
+[in]	IL, IU
+          If RANGE='I', the indices (in ascending order) of the
+          smallest and largest eigenvalues to be returned.
+          Not referenced if RANGE = 'A' or 'V'.
+[in]	ABSTOL
+          The absolute error tolerance for the eigenvalues.
+          If high relative accuracy is important, set ABSTOL to
+          DLAMCH( 'Safe minimum' ).
+[out]	M
+          The total number of eigenvalues found.
+[out]	W
+          The first M elements contain the selected eigenvalues in
+          ascending order.
+[out]	Z
+          Z is COMPLEX*16 array, dimension (LDZ, max(1,M))
+          If JOBZ = 'V', then if INFO = 0, the first M columns of Z
+          contain the orthonormal eigenvectors of the matrix A
+          corresponding to the selected eigenvalues.
+          If JOBZ = 'N', then Z is not referenced.
+          Note: the user must ensure that at least max(1,M) columns are
+          supplied in the array Z; if RANGE = 'V', the exact value of M
+          is not known in advance and an upper bound must be used.
+[in]	LDZ
+          The leading dimension of the array Z.  LDZ >= 1, and if
+          JOBZ = 'V', LDZ >= max(1,N).
+[out]	ISUPPZ
+          ISUPPZ is INTEGER array, dimension ( 2*max(1,M) )
+          The support of the eigenvectors in Z.
+[out]	WORK
+          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+[in]	LWORK
+          If LWORK = -1, then a workspace query is assumed; the routine
+          only calculates the optimal sizes of the WORK, RWORK and
+          IWORK arrays, returns these values as the first entries of
+          the WORK, RWORK and IWORK arrays.
+[out]	RWORK
+          On exit, if INFO = 0, RWORK(1) returns the optimal LRWORK.
+[in]	LRWORK
+          The length of the array RWORK.  LRWORK >= max(1,24*N).
+[out]	IWORK
+          On exit, if INFO = 0, IWORK(1) returns the optimal LIWORK.
+[in]	LIWORK
+          The dimension of the array IWORK.  LIWORK >= max(1,10*N).
+[out]	INFO
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  Internal error
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+
+/////////////////////////////////////////////////////////////////////////////
+// ZHPTRF and ZHPTRS
+/////////////////////////////////////////////////////////////////////////////
+//
+// The LAPACK documentation for ZHPTRF and ZHPTRS is that of DSPTRF and
+// DSPTRS contained in SCC_LapackSymPackedRoutines.h with COMPLEX*16
+// replacing DOUBLE PRECISION and the factorization A = U*D*U**H of a
+// Hermitian matrix replacing A = U*D*U**T.
+//
+
+/////////////////////////////////////////////////////////////////////////////
+// ZPOTRF, ZPOTRS and ZPOCON
+/////////////////////////////////////////////////////////////////////////////
+//
+// ZPOTRF (UPLO, N, A, LDA, INFO) computes the Cholesky factorization
+// A = U**H*U (UPLO = 'U') or A = L*L**H (UPLO = 'L') of the N x N complex
+// Hermitian positive definite matrix A, overwriting the referenced triangle
+// of A. INFO > 0 : the leading minor of order INFO is not positive.
+//
+// ZPOTRS (UPLO, N, NRHS, A, LDA, B, LDB, INFO) overwrites the N x NRHS
+// complex array B with the solution of A*X = B using the factors
+// computed by ZPOTRF.
+//
+// ZPOCON (UPLO, N, A, LDA, ANORM, RCOND, WORK, RWORK, INFO) estimates the
+// reciprocal of the 1-norm condition number using the factors computed by
+// ZPOTRF and ANORM, the 1-norm of A (computed with ZLANHE). WORK is a
+// COMPLEX*16 array of dimension 2*N and RWORK a DOUBLE PRECISION array
+// of dimension N.
+//
+
 /////////////////////////////////////////////////////////////////////////////
 // ZGEESX
 /////////////////////////////////////////////////////////////////////////////
@@ -1613,5 +2227,113 @@ Univ. of Colorado Denver
 NAG Ltd.
 */
 
-#endif
+/////////////////////////////////////////////////////////////////////////////
+// ZTRSEN
+/////////////////////////////////////////////////////////////////////////////
+/*
+      subroutine ztrsen ( character  job,
+                          character  compq,
+                          logical, dimension( * )  select,
+                          integer  n,
+                          complex*16, dimension( ldt, * )  t,
+                          integer  ldt,
+                          complex*16, dimension( ldq, * )  q,
+                          integer  ldq,
+                          complex*16, dimension( * )  w,
+                          integer  m,
+                          double precision  s,
+                          double precision  sep,
+                          complex*16, dimension( * )  work,
+                          integer  lwork,
+                          integer  info
+                        )
+
+ ZTRSEN reorders the Schur factorization of a complex matrix
+ A = Q*T*Q**H, so that a selected cluster of eigenvalues appears in
+ the leading positions on the diagonal of the upper triangular matrix
+ T, and the leading columns of Q form an orthonormal basis of the
+ corresponding right invariant subspace.
+
+ Optionally the routine computes the reciprocal condition numbers of
+ the cluster of eigenvalues and/or the invariant subspace.
+
+ JOB     (input) CHARACTER*1
+         Specifies whether condition numbers are required for the
+         cluster of eigenvalues (S) or the invariant subspace (SEP):
+         = 'N': none;
+         = 'E': for eigenvalues only (S);
+         = 'V': for invariant subspace only (SEP);
+         = 'B': for both eigenvalues and invariant subspace (S and SEP).
+
+ COMPQ   (input) CHARACTER*1
+         = 'V': update the matrix Q of Schur vectors;
+         = 'N': do not update Q.
+
+ SELECT  (input) LOGICAL array, dimension (N)
+         SELECT specifies the eigenvalues in the selected cluster. To
+         select the j-th eigenvalue, SELECT(j) must be set to .TRUE..
+
+ N       (input) INTEGER
+         The order of the matrix T. N >= 0.
+
+ T       (input/output) COMPLEX*16 array, dimension (LDT,N)
+         On entry, the upper triangular matrix T.
+         On exit, T is overwritten by the reordered matrix T, with the
+         selected eigenvalues as the leading diagonal elements.
+
+ LDT     (input) INTEGER
+         The leading dimension of the array T. LDT >= max(1,N).
+
+ Q       (input/output) COMPLEX*16 array, dimension (LDQ,N)
+         On entry, if COMPQ = 'V', the matrix Q of Schur vectors.
+         On exit, if COMPQ = 'V', Q has been postmultiplied by the
+         unitary transformation matrix which reorders T; the leading M
+         columns of Q form an orthonormal basis for the specified
+         invariant subspace.
+         If COMPQ = 'N', Q is not referenced.
+
+ LDQ     (input) INTEGER
+         The leading dimension of the array Q.
+         LDQ >= 1; and if COMPQ = 'V', LDQ >= N.
+
+ W       (output) COMPLEX*16 array, dimension (N)
+         The reordered eigenvalues of T, in the same order as they
+         appear on the diagonal of T.
+
+ M       (output) INTEGER
+         The dimension of the specified invariant subspace.
+         0 <= M <= N.
+
+ S       (output) DOUBLE PRECISION
+         If JOB = 'E' or 'B', S is a lower bound on the reciprocal
+         condition number for the selected cluster of eigenvalues.
+         S cannot underestimate the true reciprocal condition number
+         by more than a factor of sqrt(N). If M = 0 or N, S = 1.
+         If JOB = 'N' or 'V', S is not referenced.
+
+ SEP     (output) DOUBLE PRECISION
+         If JOB = 'V' or 'B', SEP is the estimated reciprocal
+         condition number of the specified invariant subspace. If
+         M = 0 or N, SEP = norm(T).
+         If JOB = 'N' or 'E', SEP is not referenced.
+
+ WORK    (workspace/output) COMPLEX*16 array, dimension (MAX(1,LWORK))
+         On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+
+ LWORK   (input) INTEGER
+         The dimension of the array WORK.
+         If JOB = 'N', LWORK >= 1;
+         if JOB = 'E', LWORK = max(1,M*(N-M));
+         if JOB = 'V' or 'B', LWORK >= max(1,2*M*(N-M)).
+
+         If LWORK = -1, then a workspace query is assumed; the routine
+         only calculates the optimal size of the WORK array, returns
+         this value as the first entry of the WORK array, and no error
+         message related to LWORK is issued by XERBLA.
+
+ INFO    (output) INTEGER
+         = 0:  successful exit
+         < 0:  if INFO = -i, the i-th argument had an illegal value
+*/
 
+#endif
@@ -0,0 +1,111 @@
+/*
+ * SCC_LapackMatrixRoutinesFloat.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// SCC::LapackMatrixRoutinesFloat
+//
+// Single precision versions of the classes contained in
+// SCC_LapackMatrixRoutines.h and SCC_LapackMatrixRoutinesCmplx16.h.
+// The classes are used with instances of LapackMatrixFloat and
+// LapackMatrixCmplx8 and have the interface of the corresponding
+// double precision classes, with float replacing double.
+//
+// The classes are the single precision instances of the class
+// templates GESVX<T>, POSV<T>, GESVD<T>, SYEV<T>, GESV<T> and SYSV<T> defined in
+// SCC_LapackMatrixRoutines.h.
+//
+// Data mapping being used for direct invocation of
+// Fortran routines
+//
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  float  ==  Fortran REAL
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SGESVX : Created for solving general systems of equations
+// (single precision version of DGESVX)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SPOSV : Created for solving symmetric positive definite systems
+// of equations (single precision version of DPOSV)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SGESVD : Created for singular value decomposition
+// (single precision version of DGESVD)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SSYEV : Created for eigensystem of symmetric matrix
+// (single precision version of DSYEV)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class CGESVX : Created for solving A*X = B using LU factorization
+// when A is a complex matrix (single precision version of ZGESVX)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class CPOSV : Created for solving Hermitian positive definite systems
+// of equations (single precision version of ZPOSV)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SGESV : Created for solving general systems of equations
+// using cached LU factors (single precision version of DGESV)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class SSYSV : Created for solving symmetric indefinite systems of
+// equations (single precision version of DSYSV)
+//
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include "SCC_LapackMatrixFloat.h"
+#include "SCC_LapackMatrixCmplx8.h"
+#include "SCC_LapackMatrixRoutines.h"
+
+#ifndef SCC_LAPACK_MATRIX_ROUTINES_FLOAT_
+#define SCC_LAPACK_MATRIX_ROUTINES_FLOAT_
+
+namespace SCC
+{
+typedef GESVX<float>                  SGESVX;
+typedef POSV<float>                    SPOSV;
+typedef GESVD<float>                  SGESVD;
+typedef SYEV<float>                    SSYEV;
+typedef GESVX< std::complex<float> >  CGESVX;
+typedef POSV< std::complex<float> >    CPOSV;
+typedef GESV<float>                    SGESV;
+typedef SYSV<float>                    SSYSV;
+} // Namespace SCC
+
+//
+// The LAPACK documentation for SGESVX, SPOSV, SGESVD, SSYEV, CGESVX, CPOSV and
+// SGETRF/SGETRS/SGECON/SSYTRF/SSYTRS is that of DGESVX, DPOSV, DGESVD, DSYEV,
+// ZGESVX, ZPOSV and DGETRF/DGETRS/DGECON/DSYTRF/DSYTRS contained in
+// SCC_LapackMatrixRoutines.h and SCC_LapackMatrixRoutinesCmplx16.h, with
+// REAL replacing DOUBLE PRECISION and COMPLEX replacing COMPLEX*16.
+//
+
+#endif /* SCC_LAPACK_MATRIX_ROUTINES_FLOAT_ */
@@ -39,7 +39,14 @@
 #############################################################################
 */
 
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
 #include "LapackInterface/SCC_LapackMatrix.h"
+#include "LapackInterface/SCC_LapackBandMatrix.h"
 
 #ifndef LAPACK_SYM_BAND_MATRIX_
 #define LAPACK_SYM_BAND_MATRIX_
@@ -65,6 +72,16 @@ class LapackSymBandMatrix
 	    initialize(ku,N);
 	}
 
+	LapackSymBandMatrix(const LapackBandMatrix& A, double relTol = 0.0)
+	{
+	    initialize(A,relTol);
+	}
+
+	LapackSymBandMatrix(const LapackMatrix& M, double relTol = 0.0, double dropTol = 0.0)
+	{
+	    initialize(M,relTol,dropTol);
+	}
+
 	void initialize()
 	{
 		Sp.initialize();
@@ -86,6 +103,122 @@ class LapackSymBandMatrix
     	Sp.initialize(ku + 1, N);
 	}
 
+    //
+    // Initializes with the upper triangular entries of the band matrix A.
+    // A std::runtime_error is thrown if A is not symmetric to within
+    // relTol*max|A(i,j)| (see LapackBandMatrix::isSymmetric).
+    //
+    void initialize(const LapackBandMatrix& A, double relTol = 0.0)
+	{
+    	if(not A.isSymmetric(relTol))
+    	{
+    		throw std::runtime_error("\nLapackSymBandMatrix : Band matrix argument is not symmetric \n");
+    	}
+
+    	initialize(std::min(A.kl,A.ku),A.N);
+
+    	// Copy the contiguous upper triangular portion of each column
+
+    	long LDAB = A.kl + A.ku + 1;
+    	long iMin;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	iMin = std::max((long)0,j-ku);
+    	std::memcpy(Sp.dataPtr + j*(ku+1) + ku + (iMin-j), A.mData.dataPtr + j*LDAB + A.ku + (iMin-j),
+    	            (j-iMin+1)*sizeof(double));
+    	}
+	}
+
+    //
+    // Initializes with the upper triangular entries of the square matrix M.
+    // The number of super diagonals is the smallest for which all entries
+    // of the upper triangle of M with absolute value greater than dropTol
+    // are contained in the band. A std::runtime_error is thrown if M is not
+    // symmetric to within relTol*max|M(i,j)|.
+    //
+    void initialize(const LapackMatrix& M, double relTol = 0.0, double dropTol = 0.0)
+	{
+    	if(not isSymmetric(M,relTol))
+    	{
+    		throw std::runtime_error("\nLapackSymBandMatrix : Matrix argument is not symmetric \n");
+    	}
+
+    	long Msize = M.rows;
+    	long upper = 0;
+
+    	for(long j = 0; j < Msize; j++)
+    	{
+    	for(long i = 0; i < j; i++)
+    	{
+    		if(std::abs(M(i,j)) > dropTol) {upper = std::max(upper,j-i);}
+    	}}
+
+    	initialize(upper,Msize);
+
+    	long iMin;
+    	for(long j = 0; j < N; j++)
+    	{
+    	iMin = std::max((long)0,j-ku);
+    	std::memcpy(Sp.dataPtr + j*(ku+1) + ku + (iMin-j), M.dataPtr + j*N + iMin, (j-iMin+1)*sizeof(double));
+    	}
+	}
+
+    //
+    // Returns true if M is square and |M(i,j) - M(j,i)| <= relTol*max|M(i,j)|
+    //
+    static bool isSymmetric(const LapackMatrix& M, double relTol = 0.0)
+    {
+    	if(M.rows != M.cols) return false;
+
+    	double tol = relTol*M.elementMaxAbs();
+    	for(long j = 0; j < M.cols; j++)
+    	{
+    	for(long i = 0; i < j; i++)
+    	{
+    		if(std::abs(M(i,j) - M(j,i)) > tol) return false;
+    	}}
+    	return true;
+    }
+
+    //
+    // Returns the matrix in LapackBandMatrix form (kl = ku)
+    //
+    LapackBandMatrix getBandMatrix() const
+    {
+    	LapackBandMatrix A(ku,ku,N);
+
+    	long LDAB = 2*ku + 1;
+    	double* Acol;
+    	double* Scol;
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	Acol = A.mData.dataPtr + j*LDAB + ku;  // Acol[i-j] = A(i,j)
+    	Scol = Sp.dataPtr + j*(ku+1) + ku;      // Scol[i-j] = S(i,j), i <= j
+
+    	for(long d = 0; d <= std::min(ku,j); d++)       {Acol[-d] = Scol[-d];}
+    	for(long d = 1; d <= std::min(ku,N-1-j); d++)   {Acol[d]  = Sp(ku-d,j+d);}
+    	}
+    	return A;
+    }
+
+    //
+    // Returns the matrix as a dense N x N matrix
+    //
+    LapackMatrix getDenseMatrix() const
+    {
+    	LapackMatrix M(N,N);
+    	for(long j = 0; j < N; j++)
+    	{
+    	for(long i = std::max((long)0,j-ku); i <= j; i++)
+    	{
+    		M(i,j) = Sp(ku + (i-j),j);
+    		M(j,i) = M(i,j);
+    	}}
+    	return M;
+    }
+
 	#ifdef _DEBUG
 	double& operator()(long i, long j)
 	{
@@ -151,6 +284,94 @@ class LapackSymBandMatrix
     dsbmv_(&UPLO,&N,&K,&ALPHA,Aptr,&LDA,Xptr,&INCX,&BETA,Yptr,&INCY);
     }
 
+//
+//  Y := alpha*A*X + beta*Y
+//
+//  where X and Y are N x m matrices; the equivalent of m invocations
+//  of dsbmv.
+//
+//  Only the upper band is stored, so each band entry A(i,j), i < j, is
+//  applied as both A(i,j) and A(j,i). The band data is processed in
+//  panels of consecutive columns, each small enough to remain in cache
+//  while it is applied to all m columns of X, so the band is streamed
+//  from memory once.
+//
+//  If beta = 0 then Y need not be initialized.
+//
+    void dsbmm(double alpha, const LapackMatrix& X, double beta, LapackMatrix& Y) const
+    {
+    assert(sizeCheck(X.rows,N));
+    assert(sizeCheck(Y.rows,N));
+    assert(sizeCheck(X.cols,Y.cols));
+
+    long    m     = X.cols;
+    long    LDA   = ku + 1;
+    double* Aptr  = Sp.dataPtr;
+    double* Xptr  = X.dataPtr;
+    double* Yptr  = Y.dataPtr;
+
+    if(beta == 0.0)
+    {
+    for(long k = 0; k < N*m; k++) {Yptr[k] = 0.0;}
+    }
+    else if(beta != 1.0)
+    {
+    for(long k = 0; k < N*m; k++) {Yptr[k] *= beta;}
+    }
+
+    if((alpha == 0.0)||(N == 0)) return;
+
+    // Panel width chosen so that a panel of band data occupies
+    // approximately 128 KB
+
+    long panelWidth = 16384/LDA;
+    if(panelWidth < 1) panelWidth = 1;
+
+    long    iMin;
+    double  aX; double sum;
+    double* Aj;
+    double* Xc;
+    double* Yc;
+
+    for(long jStart = 0; jStart < N; jStart += panelWidth)
+    {
+    long jEnd = std::min(jStart + panelWidth, N);
+
+    for(long c = 0; c < m; c++)
+    {
+    Xc = Xptr + c*N;
+    Yc = Yptr + c*N;
+    for(long j = jStart; j < jEnd; j++)
+    {
+        iMin = std::max((long)0,j-ku);
+        Aj   = Aptr + j*LDA + (ku - j);  // Aj[i] = A(i,j), i <= j
+        aX   = alpha*Xc[j];
+        sum  = 0.0;
+        for(long i = iMin; i < j; i++)
+        {
+            Yc[i] += aX*Aj[i];
+            sum   += Aj[i]*Xc[i];
+        }
+        Yc[j] += aX*Aj[j] + alpha*sum;
+    }}
+    }
+    }
+
+    //
+    // Y = alpha*A*X + beta*Y
+    //
+    void apply(const LapackMatrix& X, LapackMatrix& Y, double alpha = 1.0, double beta = 0.0) const
+    {
+    dsbmm(alpha,X,beta,Y);
+    }
+
+    LapackMatrix operator*(const LapackMatrix& X) const
+    {
+    LapackMatrix Y(N,X.cols);
+    dsbmm(1.0,X,0.0,Y);
+    return Y;
+    }
+
 // Fortran indexing bounds check
 
 #ifdef _DEBUG
@@ -166,8 +387,19 @@ class LapackSymBandMatrix
 	    }
 	    return true;
 	}
+
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "LapackSymBandMatrix sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
 #else
         bool boundsCheck(long, long) const {return true;}
+        bool sizeCheck(long, long) const {return true;}
 #endif
 
     SCC::LapackMatrix Sp;
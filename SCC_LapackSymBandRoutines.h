@@ -0,0 +1,1041 @@
+/*
+ * SCC_LapackSymBandRoutines.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// SCC::LapackSymBandMatrixRoutines
+//
+// A collection of utility classes whose functionality is
+// based upon LAPACK routines. These routines are meant
+// to be used with instances of LapackSymBandMatrix. The documentation
+// for the each of the base LAPACK routines is contained at the
+// end of this file or can be found at
+//
+// https://netlib.org/lapack/explore-html
+//
+// These classes do not provide the complete functionality of the
+// LAPACK routines upon which they are based -- only the
+// functionality as needed for specific project use, functionality
+// that may be updated without notice.
+//
+// Data mapping being used for direct invocation of
+// Fortran routines
+//
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  double ==  Fortran DOUBLE PRECISION
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DPBSV : Created for solving A*X = B using the Cholesky factorization
+//               when A is a symmetric positive definite band matrix.
+// LAPACK base routine description:
+// DPBTRF computes the Cholesky factorization of a real symmetric
+// positive definite band matrix A.
+//
+// DPBTRS solves a system of linear equations A*X = B with a symmetric
+// positive definite band matrix A using the Cholesky factorization
+// A = U**T*U or A = L*L**T computed by DPBTRF.
+//
+// DPBCON estimates the reciprocal of the condition number (in the
+// 1-norm) of a real symmetric positive definite band matrix using the
+// Cholesky factorization A = U**T*U or A = L*L**T computed by DPBTRF.
+//
+// DPBSV is PBSV<double>; the complex instance ZPBSV = PBSV<std::complex<double>>
+// is declared in SCC_LapackBandRoutinesCmplx16.h.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSBEVX : Created for computing selected eigenvalues and, optionally,
+//                eigenvectors of a symmetric band matrix.
+// LAPACK base routine description:
+// DSBEVX computes selected eigenvalues and, optionally, eigenvectors
+// of a real symmetric band matrix A.  Eigenvalues and eigenvectors can
+// be selected by specifying either a range of values or a range of
+// indices for the desired eigenvalues.
+//
+// DSBEVD computes all the eigenvalues and, optionally, eigenvectors of
+// a real symmetric band matrix A. If eigenvectors are desired, it uses
+// a divide and conquer algorithm.
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <complex>
+#include <algorithm>
+#include <type_traits>
+
+#include "SCC_LapackHeaders.h"
+#include "SCC_LapackTraits.h"
+#include "SCC_LapackMatrix.h"
+#include "SCC_LapackSymBandMatrix.h"
+
+#ifndef SCC_LAPACK_SYM_BAND_ROUTINES_
+#define SCC_LAPACK_SYM_BAND_ROUTINES_
+
+namespace SCC
+{
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DPBSV : Created for solving A*X = B using the Cholesky factorization
+//               when A is a symmetric positive definite band matrix.
+//
+// The Cholesky factors A = U**T*U (A = U**H*U when A is complex Hermitian)
+// are computed with xPBTRF using the upper band (ku+1 rows) storage,
+// cached, and then used by xPBTRS for any number of subsequent solves
+// with any number of right hand sides. No pivoting or equilibration is
+// performed.
+//
+// When created from a LapackBandMatrixT<T> the ku super diagonals and
+// the diagonal are copied, the sub diagonals are not referenced. A band
+// matrix with kl = 0 is stored in upper band form, so its data can be
+// factored in place with createFactors(A.ku, A.N, A.getDataPointer()).
+// For T = double the factors can also be created from a LapackSymBandMatrix.
+//
+// The reciprocal condition number is computed with xPBCON only when
+// requested.
+//
+// The class is a template, PBSV<T>, with the LAPACK routines selected
+// at compile time using LapackTraits<T>
+//
+// T = double               : DPBSV = PBSV<double>
+// T = std::complex<double> : ZPBSV = PBSV<std::complex<double>>
+//                            (SCC_LapackBandRoutinesCmplx16.h)
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <class T>
+class PBSV
+{
+	public:
+
+    typedef typename LapackTraits<T>::RealType RealType;
+
+	PBSV()
+	{
+	initialize();
+	}
+
+	PBSV(const PBSV& pbsv)
+	{
+	initialize(pbsv);
+	}
+
+	void initialize()
+	{
+	UPLO  = 'U'; // upper band storage
+	N     = 0;
+	KD    = 0;
+	ANORM = 0.0;
+	RCOND = -1.0;
+	ABfactors.initialize();
+	}
+
+	void initialize(const PBSV& pbsv)
+	{
+	UPLO  = pbsv.UPLO;
+	N     = pbsv.N;
+	KD    = pbsv.KD;
+	ANORM = pbsv.ANORM;
+	RCOND = pbsv.RCOND;
+	ABfactors.initialize(pbsv.ABfactors);
+	}
+
+	void applyInverse(const LapackBandMatrixT<T>& A, std::vector<T>& f)
+	{
+	createFactors(A);
+	applyInverse(f);
+	}
+
+	void applyInverse(const LapackBandMatrixT<T>& A, LapackMatrixT<T>& F)
+	{
+	createFactors(A);
+	applyInverse(F);
+	}
+
+	template <class U = T>
+	void applyInverse(const SCC::LapackSymBandMatrix& S, std::vector<double>& f)
+	{
+	createFactors(S);
+	applyInverse(f);
+	}
+
+	template <class U = T>
+	void applyInverse(const SCC::LapackSymBandMatrix& S, LapackMatrix& F)
+	{
+	createFactors(S);
+	applyInverse(F);
+	}
+
+	void applyInverse(std::vector<T>& f)
+	{
+	assert(sizeCheck((long)f.size(),1));
+	applyInverse(reinterpret_cast<RealType*>(&f[0]));
+	}
+
+	void applyInverse(LapackMatrixT<T>& F)
+	{
+	assert(sizeCheck(F.rows,F.cols));
+	applyInverse(F.getDataPointer(),F.cols);
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions.
+	//
+	void applyInverse(RealType* f, long NRHS = 1)
+	{
+    long LDAB = KD + 1;
+    long LDB  = N;
+    long INFO = 0;
+
+    LapackTraits<T>::pbtrs(&UPLO, &N, &KD, &NRHS, ABfactors.getDataPointer(), &LDAB, f, &LDB, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "pbtrs \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+	//
+	// Creates the Cholesky factors of a copy of the diagonal and
+	// super diagonals of A.
+	//
+	void createFactors(const LapackBandMatrixT<T>& A)
+	{
+	long ku = A.ku;
+	long nc = LapackTraits<T>::realComponents;
+
+	ABfactors.initialize(ku+1,A.N);
+
+	// Copy the contiguous upper triangular portion of each column
+
+	long LDAB = A.kl + A.ku + 1;
+	long iMin;
+
+	for(long j = 0; j < A.N; j++)
+	{
+	iMin = std::max((long)0,j-ku);
+	std::memcpy(ABfactors.getDataPointer() + nc*(j*(ku+1) + ku + (iMin-j)),
+	            A.getDataPointer() + nc*(j*LDAB + A.ku + (iMin-j)),
+	            nc*(j-iMin+1)*sizeof(RealType));
+	}
+
+	factor(ku,A.N);
+	}
+
+	//
+	// Creates the Cholesky factors of a copy of the matrix data of S (T = double).
+	//
+	template <class U = T>
+	void createFactors(const SCC::LapackSymBandMatrix& S)
+	{
+	static_assert(std::is_same<U,double>::value,"PBSV<T> : LapackSymBandMatrix requires T = double");
+	ABfactors.initialize(S.Sp);
+	factor(S.ku,S.N);
+	}
+
+	//
+	// Creates the Cholesky factors in place.
+	//
+	// !!! Important: ABdata, the (ku+1) x N upper band storage of a
+	// symmetric (Hermitian) band matrix with ku super diagonals, e.g. the
+	// data of S.Sp for a LapackSymBandMatrix S, is overwritten by the
+	// factors and must remain allocated while the factors are in use.
+	// No bounds checking is performed.
+	//
+	void createFactors(long ku, long N, RealType* ABdata)
+	{
+	ABfactors.initialize();  // release any locally allocated factors before adopting ABdata
+	ABfactors.initialize(ku+1,N,ABdata);
+	factor(ku,N);
+	}
+
+	//
+	// Returns an estimate of the reciprocal of the condition number (in the 1-norm)
+	// of the factored matrix. The estimate is computed on first request.
+	//
+	RealType getReciprocalCondNumber()
+	{
+	if(RCOND >= 0.0) {return RCOND;}
+
+    long LDAB = KD + 1;
+    long INFO = 0;
+
+    LapackTraits<T>::pbcon(&UPLO, &N, &KD, ABfactors.getDataPointer(), &LDAB, &ANORM, &RCOND, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "pbcon \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+    return RCOND;
+	}
+
+	void factor(long ku, long N)
+	{
+    this->N  = N;
+    this->KD = ku;
+
+    long LDAB = KD + 1;
+    long INFO = 0;
+
+    // 1-norm of A, required for condition number estimates, is
+    // computed from the upper band prior to overwriting A with its
+    // factors; A(i,j) is stored in ABfactors(KD+i-j,j) (the imaginary
+    // parts of the diagonal are assumed zero)
+
+    std::vector<RealType> colSum(N,0.0);
+    RealType a;
+    for(long j = 0; j < N; j++)
+    {
+    for(long i = std::max((long)0,j-KD); i < j; i++)
+    {
+    a          = std::abs(ABfactors(KD+i-j,j));
+    colSum[i] += a;
+    colSum[j] += a;
+    }
+    colSum[j] += std::abs(std::real(ABfactors(KD,j)));
+    }
+
+    ANORM = 0.0;
+    for(long j = 0; j < N; j++) {ANORM = (colSum[j] > ANORM) ? colSum[j] : ANORM;}
+    RCOND = -1.0;
+
+    LapackTraits<T>::pbtrf(&UPLO, &this->N, &KD, ABfactors.getDataPointer(), &LDAB, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\n" << LapackTraits<T>::prefix() << "pbtrf \nError INFO = " << INFO << "\n";
+    	if(INFO > 0) {sout << "Matrix is not positive definite \n";}
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+	long getDimension() const
+	{
+	return N;
+	}
+
+#ifdef _DEBUG
+    bool sizeCheck(long rows, long cols) const
+    {
+    if((rows != N) || (cols < 1))
+    {
+    std::cerr  <<  "PBSV error                              "  << "\n";
+    std::cerr  <<  "Right hand side must have N rows        "  << "\n";
+    std::cerr  <<  "N    : "  << N    << "\n";
+    std::cerr  <<  "rows : "  << rows << "\n";
+    std::cerr  <<  "cols : "  << cols << "\n";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+	char       UPLO;
+	long          N;
+	long         KD;
+	RealType  ANORM;
+	RealType  RCOND;
+
+    // For caching factors
+
+	LapackMatrixT<T> ABfactors;
+};
+
+typedef PBSV<double> DPBSV;
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSBEVX : Created for computing selected eigenvalues and, optionally,
+//                eigenvectors of a symmetric band matrix.
+//
+// The band storage of the LapackSymBandMatrix is used directly, so
+// computing eigenvalues only requires O(N*ku) memory and O(N*ku^2) work
+// for the reduction to tridiagonal form.
+//
+// When eigenvectors are requested DSBEVX forms the N x N orthogonal
+// matrix of the reduction to tridiagonal form, so memory is O(N^2)
+// regardless of the number of eigenvectors requested.
+//
+// Index ranges are specified using 0-based indices of the eigenvalues
+// in ascending order, i.e. [indexMin, indexMax] = [0, 4] selects the
+// 5 algebraically smallest eigenvalues. Value ranges select the
+// eigenvalues in the half-open interval (lambdaMin, lambdaMax].
+//
+// Each of the create member functions returns the number of eigenvalues
+// found, with eigValues resized to that number and the eigenvectors
+// stored as the columns of eigVectors.
+//
+// All eigenvalues (and eigenvectors) are computed with DSBEVD.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class DSBEVX
+{
+public :
+
+    DSBEVX()
+    {
+    initialize();
+    }
+
+    void initialize()
+    {
+    AB.initialize();
+    Q.initialize();
+    WORK.clear();
+    IWORK.clear();
+    IFAIL.clear();
+    }
+
+    long createAlgSmallestEigensystem(long eigCount, const SCC::LapackSymBandMatrix& S,
+    std::vector<double>& eigValues, SCC::LapackMatrix& eigVectors)
+    {
+    return createIndexRangeEigensystem(0,eigCount-1,S,eigValues,eigVectors);
+    }
+
+    long createAlgSmallestEigenvalues(long eigCount, const SCC::LapackSymBandMatrix& S,
+    std::vector<double>& eigValues)
+    {
+    return createIndexRangeEigenvalues(0,eigCount-1,S,eigValues);
+    }
+
+    long createIndexRangeEigensystem(long indexMin, long indexMax, const SCC::LapackSymBandMatrix& S,
+    std::vector<double>& eigValues, SCC::LapackMatrix& eigVectors)
+    {
+    indexRangeCheck(indexMin,indexMax,S.N);
+    eigVectors.initialize(S.N,indexMax-indexMin+1);
+    return computeEigen('V','I',0.0,0.0,indexMin+1,indexMax+1,S,eigValues,eigVectors);
+    }
+
+    long createIndexRangeEigenvalues(long indexMin, long indexMax, const SCC::LapackSymBandMatrix& S,
+    std::vector<double>& eigValues)
+    {
+    indexRangeCheck(indexMin,indexMax,S.N);
+    return computeEigen('N','I',0.0,0.0,indexMin+1,indexMax+1,S,eigValues,Q);
+    }
+
+    long createValueRangeEigensystem(double lambdaMin, double lambdaMax, const SCC::LapackSymBandMatrix& S,
+    std::vector<double>& eigValues, SCC::LapackMatrix& eigVectors)
+    {
+    // Count the eigenvalues in the interval so that only the
+    // required number of eigenvector columns are allocated
+
+    long eigCount = computeEigen('N','V',lambdaMin,lambdaMax,0,0,S,eigValues,Q);
+
+    eigVectors.initialize(S.N,eigCount);
+    if(eigCount == 0) {return 0;}
+
+    return computeEigen('V','V',lambdaMin,lambdaMax,0,0,S,eigValues,eigVectors);
+    }
+
+    long createValueRangeEigenvalues(double lambdaMin, double lambdaMax, const SCC::LapackSymBandMatrix& S,
+    std::vector<double>& eigValues)
+    {
+    return computeEigen('N','V',lambdaMin,lambdaMax,0,0,S,eigValues,Q);
+    }
+
+    long createEigensystem(const SCC::LapackSymBandMatrix& S, std::vector<double>& eigValues,
+    SCC::LapackMatrix& eigVectors)
+    {
+    eigVectors.initialize(S.N,S.N);
+    return computeAllEigen('V',S,eigValues,eigVectors);
+    }
+
+    long createEigenvalues(const SCC::LapackSymBandMatrix& S, std::vector<double>& eigValues)
+    {
+    return computeAllEigen('N',S,eigValues,Q);
+    }
+
+    // Invokes dsbevx. When JOBZ = 'V', Z must be allocated with
+    // S.N rows and a column for each eigenvalue to be found.
+
+    long computeEigen(char JOBZ, char RANGE, double VL, double VU, long IL, long IU,
+    const SCC::LapackSymBandMatrix& S, std::vector<double>& eigValues, SCC::LapackMatrix& Z)
+    {
+    long N    = S.N;
+    long KD   = S.ku;
+    long LDAB = KD + 1;
+
+    char UPLO = 'U'; // LapackSymBandMatrix stores the upper band
+
+    // Copy input matrix data, as it is overwritten by dsbevx
+
+    AB.initialize(S.Sp);
+
+    char   DLAMCH_IN = 'S';
+    double ABSTOL    =  2.0*(dlamch_(&DLAMCH_IN));
+
+    long eigComputed = 0;     //  M parameter in original call = number of eigenvalues output
+
+    eigValues.clear();        // W parameter in original call
+    eigValues.resize(N,0.0);
+
+    long   LDQ   = 1;
+    long   LDZ   = 1;
+    double QDATA = 0.0;
+    double ZDATA = 0.0;
+
+    double* Qptr = &QDATA;
+    double* Zptr = &ZDATA;
+
+    if(JOBZ == 'V')
+    {
+    Q.initialize(N,N);
+    LDQ  = N;
+    LDZ  = N;
+    Qptr = Q.getDataPointer();
+    Zptr = Z.getDataPointer();
+    }
+
+    WORK.resize(7*N,0.0);
+    IWORK.resize(5*N,0);
+    IFAIL.resize(N,0);
+
+    long INFO = 0;
+
+    dsbevx_(&JOBZ, &RANGE, &UPLO, &N, &KD, AB.getDataPointer(), &LDAB, Qptr, &LDQ,
+    &VL, &VU, &IL, &IU, &ABSTOL, &eigComputed, eigValues.data(), Zptr, &LDZ,
+    WORK.data(), IWORK.data(), IFAIL.data(), &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\nDSBEVX \nError INFO = " << INFO << "\n";
+        if(INFO > 0) {sout << INFO << " eigenvectors failed to converge \n";}
+        throw std::runtime_error(sout.str());
+    }
+
+    // Release the orthogonal matrix of the reduction
+
+    if(JOBZ == 'V') {Q.initialize();}
+
+    // resize the eig values array to the number of eigenvalues found
+
+    eigValues.resize(eigComputed);
+    return eigComputed;
+    }
+
+    // Invokes dsbevd. When JOBZ = 'V', Z must be allocated as S.N x S.N.
+
+    long computeAllEigen(char JOBZ, const SCC::LapackSymBandMatrix& S, std::vector<double>& eigValues,
+    SCC::LapackMatrix& Z)
+    {
+    long N    = S.N;
+    long KD   = S.ku;
+    long LDAB = KD + 1;
+
+    char UPLO = 'U';
+
+    AB.initialize(S.Sp);
+
+    eigValues.clear();
+    eigValues.resize(N,0.0);
+
+    long   LDZ   = 1;
+    double ZDATA = 0.0;
+    double* Zptr = &ZDATA;
+
+    if(JOBZ == 'V')
+    {
+    LDZ  = N;
+    Zptr = Z.getDataPointer();
+    }
+
+    long INFO = 0;
+
+    // workspace query
+
+    long LWORK  = -1;
+    long LIWORK = -1;
+    WORK.resize(1,0.0);
+    IWORK.resize(1,0);
+
+    dsbevd_(&JOBZ, &UPLO, &N, &KD, AB.getDataPointer(), &LDAB, eigValues.data(), Zptr, &LDZ,
+    WORK.data(), &LWORK, IWORK.data(), &LIWORK, &INFO);
+
+    LWORK  = (long)WORK[0];
+    LIWORK = IWORK[0];
+
+    WORK.resize(LWORK,0.0);
+    IWORK.resize(LIWORK,0);
+
+    dsbevd_(&JOBZ, &UPLO, &N, &KD, AB.getDataPointer(), &LDAB, eigValues.data(), Zptr, &LDZ,
+    WORK.data(), &LWORK, IWORK.data(), &LIWORK, &INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\nDSBEVX (dsbevd) \nError INFO = " << INFO << "\n";
+        throw std::runtime_error(sout.str());
+    }
+
+    return N;
+    }
+
+    void indexRangeCheck(long indexMin, long indexMax, long N) const
+    {
+    if((indexMin < 0)||(indexMax >= N)||(indexMin > indexMax))
+    {
+        std::stringstream sout;
+        sout << "\nDSBEVX Error \n";
+        sout << "Requested eigenvalue index range [" << indexMin << ", " << indexMax << "] ";
+        sout << "is not contained in [0, " << N-1 << "] \n";
+        throw std::runtime_error(sout.str());
+    }
+    }
+
+    SCC::LapackMatrix            AB;
+    SCC::LapackMatrix             Q;
+    std::vector<double>        WORK;
+    std::vector<long>         IWORK;
+    std::vector<long>         IFAIL;
+};
+
+} // Namespace SCC
+
+//
+// LAPACK documentation
+//
+/////////////////////////////////////////////////////////////////////////////
+// DPBTRF
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dpbtrf	(	character 	uplo,
+integer 	n,
+integer 	kd,
+double precision, dimension( ldab, * ) 	ab,
+integer 	ldab,
+integer 	info
+)
+
+Purpose:
+ DPBTRF computes the Cholesky factorization of a real symmetric
+ positive definite band matrix A.
+
+ The factorization has the form
+    A = U**T * U,  if UPLO = 'U', or
+    A = L  * L**T,  if UPLO = 'L',
+ where U is an upper triangular matrix and L is lower triangular.
+Parameters
+[in]	UPLO
+          UPLO is CHARACTER*1
+          = 'U':  Upper triangle of A is stored;
+          = 'L':  Lower triangle of A is stored.
+[in]	N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in]	KD
+          KD is INTEGER
+          The number of superdiagonals of the matrix A if UPLO = 'U',
+          or the number of subdiagonals if UPLO = 'L'.  KD >= 0.
+[in,out]	AB
+          AB is DOUBLE PRECISION array, dimension (LDAB,N)
+          On entry, the upper or lower triangle of the symmetric band
+          matrix A, stored in the first KD+1 rows of the array.  The
+          j-th column of A is stored in the j-th column of the array AB
+          as follows:
+          if UPLO = 'U', AB(kd+1+i-j,j) = A(i,j) for max(1,j-kd)<=i<=j;
+          if UPLO = 'L', AB(1+i-j,j)    = A(i,j) for j<=i<=min(n,j+kd).
+
+          On exit, if INFO = 0, the triangular factor U or L from the
+          Cholesky factorization A = U**T*U or A = L*L**T of the band
+          matrix A, in the same storage format as A.
+[in]	LDAB
+          LDAB is INTEGER
+          The leading dimension of the array AB.  LDAB >= KD+1.
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  if INFO = i, the leading principal minor of order i
+                is not positive, and the factorization could not be
+                completed.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DPBTRS
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dpbtrs	(	character 	uplo,
+integer 	n,
+integer 	kd,
+integer 	nrhs,
+double precision, dimension( ldab, * ) 	ab,
+integer 	ldab,
+double precision, dimension( ldb, * ) 	b,
+integer 	ldb,
+integer 	info
+)
+
+Purpose:
+ DPBTRS solves a system of linear equations A*X = B with a symmetric
+ positive definite band matrix A using the Cholesky factorization
+ A = U**T*U or A = L*L**T computed by DPBTRF.
+Parameters
+[in]	UPLO
+          UPLO is CHARACTER*1
+          = 'U':  Upper triangular factor stored in AB;
+          = 'L':  Lower triangular factor stored in AB.
+[in]	N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in]	KD
+          KD is INTEGER
+          The number of superdiagonals of the matrix A if UPLO = 'U',
+          or the number of subdiagonals if UPLO = 'L'.  KD >= 0.
+[in]	NRHS
+          NRHS is INTEGER
+          The number of right hand sides, i.e., the number of columns
+          of the matrix B.  NRHS >= 0.
+[in]	AB
+          AB is DOUBLE PRECISION array, dimension (LDAB,N)
+          The triangular factor U or L from the Cholesky factorization
+          A = U**T*U or A = L*L**T of the band matrix A, stored in the
+          first KD+1 rows of the array.
+[in]	LDAB
+          LDAB is INTEGER
+          The leading dimension of the array AB.  LDAB >= KD+1.
+[in,out]	B
+          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+          On entry, the right hand side matrix B.
+          On exit, the solution matrix X.
+[in]	LDB
+          LDB is INTEGER
+          The leading dimension of the array B.  LDB >= max(1,N).
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DPBCON
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dpbcon	(	character 	uplo,
+integer 	n,
+integer 	kd,
+double precision, dimension( ldab, * ) 	ab,
+integer 	ldab,
+double precision 	anorm,
+double precision 	rcond,
+double precision, dimension( * ) 	work,
+integer, dimension( * ) 	iwork,
+integer 	info
+)
+
+Purpose:
+ DPBCON estimates the reciprocal of the condition number (in the
+ 1-norm) of a real symmetric positive definite band matrix using the
+ Cholesky factorization A = U**T*U or A = L*L**T computed by DPBTRF.
+
+ An estimate is obtained for norm(inv(A)), and the reciprocal of the
+ condition number is computed as RCOND = 1 / (ANORM * norm(inv(A))).
+Parameters
+[in]	ANORM
+          ANORM is DOUBLE PRECISION
+          The 1-norm (or infinity-norm) of the symmetric band matrix A.
+[out]	RCOND
+          RCOND is DOUBLE PRECISION
+          The reciprocal of the condition number of the matrix A,
+          computed as RCOND = 1/(ANORM * AINVNM), where AINVNM is an
+          estimate of the 1-norm of inv(A) computed in this routine.
+[out]	WORK
+          WORK is DOUBLE PRECISION array, dimension (3*N)
+[out]	IWORK
+          IWORK is INTEGER array, dimension (N)
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DLANSB
+/////////////////////////////////////////////////////////////////////////////
+/*
+double precision function dlansb	(	character 	norm,
+character 	uplo,
+integer 	n,
+integer 	k,
+double precision, dimension( ldab, * ) 	ab,
+integer 	ldab,
+double precision, dimension( * ) 	work
+)
+
+Purpose:
+ DLANSB  returns the value of the one norm,  or the Frobenius norm, or
+ the  infinity norm,  or the element of  largest absolute value  of an
+ n by n symmetric band matrix A,  with k super-diagonals.
+Parameters
+[in]	NORM
+          NORM is CHARACTER*1
+          Specifies the value to be returned in DLANSB as described
+          above: 'M' max abs, '1' or 'O' one norm, 'I' infinity norm,
+          'F' or 'E' Frobenius norm.
+[out]	WORK
+          WORK is DOUBLE PRECISION array, dimension (MAX(1,LWORK)),
+          where LWORK >= N when NORM = 'I' or '1' or 'O'; otherwise,
+          WORK is not referenced.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+
+/////////////////////////////////////////////////////////////////////////////
+// DSBEVX
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dsbevx	(	character 	jobz,
+character 	range,
+character 	uplo,
+integer 	n,
+integer 	kd,
+double precision, dimension( ldab, * ) 	ab,
+integer 	ldab,
+double precision, dimension( ldq, * ) 	q,
+integer 	ldq,
+double precision 	vl,
+double precision 	vu,
+integer 	il,
+integer 	iu,
+double precision 	abstol,
+integer 	m,
+double precision, dimension( * ) 	w,
+double precision, dimension( ldz, * ) 	z,
+integer 	ldz,
+double precision, dimension( * ) 	work,
+integer, dimension( * ) 	iwork,
+integer, dimension( * ) 	ifail,
+integer 	info
+)
+
+Purpose:
+ DSBEVX computes selected eigenvalues and, optionally, eigenvectors
+ of a real symmetric band matrix A.  Eigenvalues and eigenvectors can
+ be selected by specifying either a range of values or a range of
+ indices for the desired eigenvalues.
+Parameters
+[in]	JOBZ
+          JOBZ is CHARACTER*1
+          = 'N':  Compute eigenvalues only;
+          = 'V':  Compute eigenvalues and eigenvectors.
+[in]	RANGE
+          RANGE is CHARACTER*1
+          = 'A': all eigenvalues will be found;
+          = 'V': all eigenvalues in the half-open interval (VL,VU]
+                 will be found;
+          = 'I': the IL-th through IU-th eigenvalues will be found.
+[in]	UPLO
+          UPLO is CHARACTER*1
+          = 'U':  Upper triangle of A is stored;
+          = 'L':  Lower triangle of A is stored.
+[in]	N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in]	KD
+          KD is INTEGER
+          The number of superdiagonals of the matrix A if UPLO = 'U',
+          or the number of subdiagonals if UPLO = 'L'.  KD >= 0.
+[in,out]	AB
+          AB is DOUBLE PRECISION array, dimension (LDAB, N)
+          On entry, the upper or lower triangle of the symmetric band
+          matrix A, stored in the first KD+1 rows of the array.
+          if UPLO = 'U', AB(kd+1+i-j,j) = A(i,j) for max(1,j-kd)<=i<=j;
+          if UPLO = 'L', AB(1+i-j,j)    = A(i,j) for j<=i<=min(n,j+kd).
+
+          On exit, AB is overwritten by values generated during the
+          reduction to tridiagonal form.
+[in]	LDAB
+          LDAB is INTEGER
+          The leading dimension of the array AB.  LDAB >= KD + 1.
+[out]	Q
+          Q is DOUBLE PRECISION array, dimension (LDQ, N)
+          If JOBZ = 'V', the N-by-N orthogonal matrix used in the
+                         reduction to tridiagonal form.
+          If JOBZ = 'N', the array Q is not referenced.
+[in]	LDQ
+          LDQ is INTEGER
+          The leading dimension of the array Q.  If JOBZ = 'V', then
+          LDQ >= max(1,N).
+[in]	VL, VU
+          If RANGE='V', the lower and upper bounds of the interval to
+          be searched for eigenvalues. VL < VU.
+          Not referenced if RANGE = 'A' or 'I'.
+[in]	IL, IU
+          If RANGE='I', the indices (in ascending order) of the
+          smallest and largest eigenvalues to be returned.
+          1 <= IL <= IU <= N, if N > 0; IL = 1 and IU = 0 if N = 0.
+          Not referenced if RANGE = 'A' or 'V'.
+[in]	ABSTOL
+          ABSTOL is DOUBLE PRECISION
+          The absolute error tolerance for the eigenvalues.
+          Eigenvalues will be computed most accurately when ABSTOL is
+          set to twice the underflow threshold 2*DLAMCH('S'), not zero.
+[out]	M
+          M is INTEGER
+          The total number of eigenvalues found.  0 <= M <= N.
+          If RANGE = 'A', M = N, and if RANGE = 'I', M = IU-IL+1.
+[out]	W
+          W is DOUBLE PRECISION array, dimension (N)
+          The first M elements contain the selected eigenvalues in
+          ascending order.
+[out]	Z
+          Z is DOUBLE PRECISION array, dimension (LDZ, max(1,M))
+          If JOBZ = 'V', then if INFO = 0, the first M columns of Z
+          contain the orthonormal eigenvectors of the matrix A
+          corresponding to the selected eigenvalues, with the i-th
+          column of Z holding the eigenvector associated with W(i).
+          If JOBZ = 'N', then Z is not referenced.
+          Note: the user must ensure that at least max(1,M) columns are
+          supplied in the array Z; if RANGE = 'V', the exact value of M
+          is not known in advance and an upper bound must be used.
+[in]	LDZ
+          LDZ is INTEGER
+          The leading dimension of the array Z.  LDZ >= 1, and if
+          JOBZ = 'V', LDZ >= max(1,N).
+[out]	WORK
+          WORK is DOUBLE PRECISION array, dimension (7*N)
+[out]	IWORK
+          IWORK is INTEGER array, dimension (5*N)
+[out]	IFAIL
+          IFAIL is INTEGER array, dimension (N)
+          If JOBZ = 'V', then if INFO = 0, the first M elements of
+          IFAIL are zero.  If INFO > 0, then IFAIL contains the
+          indices of the eigenvectors that failed to converge.
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit.
+          < 0:  if INFO = -i, the i-th argument had an illegal value.
+          > 0:  if INFO = i, then i eigenvectors failed to converge.
+                Their indices are stored in array IFAIL.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+/////////////////////////////////////////////////////////////////////////////
+// DSBEVD
+/////////////////////////////////////////////////////////////////////////////
+/*
+subroutine dsbevd	(	character 	jobz,
+character 	uplo,
+integer 	n,
+integer 	kd,
+double precision, dimension( ldab, * ) 	ab,
+integer 	ldab,
+double precision, dimension( * ) 	w,
+double precision, dimension( ldz, * ) 	z,
+integer 	ldz,
+double precision, dimension( * ) 	work,
+integer 	lwork,
+integer, dimension( * ) 	iwork,
+integer 	liwork,
+integer 	info
+)
+
+Purpose:
+ DSBEVD computes all the eigenvalues and, optionally, eigenvectors of
+ a real symmetric band matrix A. If eigenvectors are desired, it uses
+ a divide and conquer algorithm.
+Parameters
+[in]	JOBZ
+          JOBZ is CHARACTER*1
+          = 'N':  Compute eigenvalues only;
+          = 'V':  Compute eigenvalues and eigenvectors.
+[in,out]	AB
+          AB is DOUBLE PRECISION array, dimension (LDAB, N)
+          On entry, the upper or lower triangle of the symmetric band
+          matrix A, stored in the first KD+1 rows of the array.
+          On exit, AB is overwritten by values generated during the
+          reduction to tridiagonal form.
+[out]	W
+          W is DOUBLE PRECISION array, dimension (N)
+          If INFO = 0, the eigenvalues in ascending order.
+[out]	Z
+          Z is DOUBLE PRECISION array, dimension (LDZ, N)
+          If JOBZ = 'V', then if INFO = 0, Z contains the orthonormal
+          eigenvectors of the matrix A, with the i-th column of Z
+          holding the eigenvector associated with W(i).
+          If JOBZ = 'N', then Z is not referenced.
+[out]	WORK
+          WORK is DOUBLE PRECISION array, dimension (LWORK)
+          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+[in]	LWORK
+          If LWORK = -1, then a workspace query is assumed; the routine
+          only calculates the optimal sizes of the WORK and IWORK
+          arrays, returns these values as the first entries of the WORK
+          and IWORK arrays.
+[out]	IWORK
+          IWORK is INTEGER array, dimension (MAX(1,LIWORK))
+          On exit, if INFO = 0, IWORK(1) returns the optimal LIWORK.
+[in]	LIWORK
+          If LIWORK = -1, then a workspace query is assumed.
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  if INFO = i, the algorithm failed to converge; i
+                off-diagonal elements of an intermediate tridiagonal
+                form did not converge to zero.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+
+#endif /* SCC_LAPACK_SYM_BAND_ROUTINES_ */
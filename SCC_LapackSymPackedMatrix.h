@@ -0,0 +1,280 @@
+/*
+ * SCC_LapackSymPackedMatrix.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+
+// A class for representing an N x N real symmetric matrix in Lapack
+// packed storage.
+//
+// Only the upper triangular portion of the matrix is stored, by columns,
+// so that the matrix occupies N*(N+1)/2 doubles, approximately half of the
+// storage required by an N x N LapackMatrix. With 0 based indexing the
+// entry A(i,j), i <= j, is located at
+//
+//     AP[i + (j*(j+1))/2]
+//
+// Note: LapackSymPackedMatrix stores the upper triangular
+// data of a symmetric matrix so the UPLO parameter in the
+// Lapack symmetric packed routines should be specified as "U".
+//
+// The access operator()(i,j) accepts any pair of indices 0 <= i,j < N;
+// for i > j the reference returned is to the stored entry A(j,i).
+//
+// The data pointer obtained using getDataPointer() can be passed
+// directly to Lapack routines that assume a symmetric matrix stored
+// using the Lapack packed storage convention (e.g. dspmv, dspevx,
+// dsptrf and dsptrs), so no conversion of the matrix is required.
+//
+// Lapack dependencies : dspmv_
+//
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include <cstring>
+#include <vector>
+#include <iostream>
+
+#include "LapackInterface/SCC_LapackHeaders.h"
+#include "LapackInterface/SCC_LapackMatrix.h"
+
+#ifndef LAPACK_SYM_PACKED_MATRIX_
+#define LAPACK_SYM_PACKED_MATRIX_
+
+namespace SCC
+{
+class LapackSymPackedMatrix
+{
+	public:
+
+	LapackSymPackedMatrix()
+	{
+	initialize();
+	}
+
+    LapackSymPackedMatrix(const LapackSymPackedMatrix& S)
+	{
+    	initialize(S);
+	}
+
+	LapackSymPackedMatrix(long N)
+	{
+	    initialize(N);
+	}
+
+	LapackSymPackedMatrix(const LapackMatrix& M)
+	{
+	    initialize(M);
+	}
+
+	void initialize()
+	{
+		AP.initialize();
+    	N  = 0;
+	}
+
+	void initialize(const LapackSymPackedMatrix& S)
+	{
+		N  = S.N;
+	    AP.initialize(S.AP);
+	}
+
+    void initialize(long N)
+	{
+    	this->N  = N;
+    	AP.initialize((N*(N+1))/2,1);
+	}
+
+    //
+    // Initialize with externally defined packed data of size N*(N+1)/2.
+    // Deleting or re-initializing this instance will not delete the data.
+    // Any locally allocated data is released first.
+    //
+    void initialize(long N, double* APdata)
+	{
+    	AP.initialize();
+    	this->N  = N;
+    	AP.initialize((N*(N+1))/2,1,APdata);
+	}
+
+    //
+    // Initializes with the upper triangular entries of the square matrix M;
+    // the entries of M below the diagonal are not referenced.
+    //
+    // Column j of the upper triangle of M is contiguous in both M and
+    // the packed data, so each column is copied with a single memcpy.
+    //
+    void initialize(const LapackMatrix& M)
+	{
+    	assert(sizeCheck(M.rows,M.cols));
+
+    	initialize(M.rows);
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	std::memcpy(AP.dataPtr + (j*(j+1))/2, M.dataPtr + j*N, (j+1)*sizeof(double));
+    	}
+	}
+
+    //
+    // Returns the matrix as a dense N x N matrix
+    //
+    LapackMatrix getDenseMatrix() const
+    {
+    	LapackMatrix M(N,N);
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	std::memcpy(M.dataPtr + j*N, AP.dataPtr + (j*(j+1))/2, (j+1)*sizeof(double));
+    	}
+
+    	for(long j = 0; j < N; j++)
+    	{
+    	for(long i = 0; i < j; i++)
+    	{
+    		M(j,i) = M(i,j);
+    	}}
+    	return M;
+    }
+
+	#ifdef _DEBUG
+	double& operator()(long i, long j)
+	{
+		assert(boundsCheck(i,j));
+		return (i <= j) ? AP.dataPtr[i + (j*(j+1))/2] : AP.dataPtr[j + (i*(i+1))/2];
+	}
+
+    const double& operator()(long i, long j) const
+	{
+    	assert(boundsCheck(i,j));
+		return (i <= j) ? AP.dataPtr[i + (j*(j+1))/2] : AP.dataPtr[j + (i*(i+1))/2];
+	}
+
+	#else
+	inline double& operator()(long i, long j)
+	{
+		return (i <= j) ? AP.dataPtr[i + (j*(j+1))/2] : AP.dataPtr[j + (i*(i+1))/2];
+	}
+
+    inline const double& operator()(long i, long j) const
+	{
+		return (i <= j) ? AP.dataPtr[i + (j*(j+1))/2] : AP.dataPtr[j + (i*(i+1))/2];
+	}
+	#endif
+
+	double* getDataPointer() const {return AP.dataPtr;}
+
+    void setToValue(double val)
+	{
+		AP.setToValue(val);
+	}
+
+    long getDimension() const
+    {
+    	return N;
+    }
+
+//
+//  y := alpha*A*x + beta*y
+//
+//  If beta = 0 then y need not be initialized.
+//
+    void dspmv(double alpha, const double* x, double beta, double* y) const
+    {
+    char UPLO    = 'U';
+    long Nloc    = N;
+    long INCX    = 1;
+    long INCY    = 1;
+
+    dspmv_(&UPLO,&Nloc,&alpha,AP.dataPtr,const_cast<double*>(x),&INCX,&beta,y,&INCY);
+    }
+
+    void applySymmetricPackedMatrix(const std::vector<double>& x, std::vector<double>& y) const
+    {
+    assert(sizeCheck((long)x.size(),N));
+	if((long)y.size() != N)  {y.resize(N,0.0);}
+	dspmv(1.0,&x[0],0.0,&y[0]);
+    }
+
+    std::vector<double> operator*(const std::vector<double>& x) const
+    {
+    std::vector<double> y(N,0.0);
+    applySymmetricPackedMatrix(x,y);
+    return y;
+    }
+
+//
+//  Y = alpha*A*X + beta*Y, applied column by column to the N x m matrix X
+//
+    void apply(const LapackMatrix& X, LapackMatrix& Y, double alpha = 1.0, double beta = 0.0) const
+    {
+    assert(sizeCheck(X.rows,N));
+    assert(sizeCheck(Y.rows,N));
+    assert(sizeCheck(X.cols,Y.cols));
+
+    for(long c = 0; c < X.cols; c++)
+    {
+    dspmv(alpha,X.dataPtr + c*N,beta,Y.dataPtr + c*N);
+    }
+    }
+
+    LapackMatrix operator*(const LapackMatrix& X) const
+    {
+    LapackMatrix Y(N,X.cols);
+    apply(X,Y,1.0,0.0);
+    return Y;
+    }
+
+#ifdef _DEBUG
+	bool boundsCheck(long i, long j) const
+	{
+        if((i < 0)||(i >= N)||(j < 0)||(j >= N))
+	    {
+	    std::cerr  <<  "LapackSymPackedMatrix index error " << std::endl;
+	    std::cerr  <<  "N  =  " << N   <<  std::endl;
+	    std::cerr  <<  "Offending indices " << "(" << i << ", " << j << ")" << std::endl;
+	    return false;
+	    }
+	    return true;
+	}
+
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "LapackSymPackedMatrix sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
+#else
+        bool boundsCheck(long, long) const {return true;}
+        bool sizeCheck(long, long) const {return true;}
+#endif
+
+    SCC::LapackMatrix AP;
+	long  N;
+};
+
+} // Namespace SCC
+
+#endif /* LAPACK_SYM_PACKED_MATRIX_ */
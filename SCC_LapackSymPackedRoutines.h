@@ -0,0 +1,630 @@
+/*
+ * SCC_LapackSymPackedRoutines.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// SCC::LapackSymPackedMatrixRoutines
+//
+// A collection of utility classes whose functionality is
+// based upon LAPACK routines. These routines are meant
+// to be used with instances of LapackSymPackedMatrix. The documentation
+// for the each of the base LAPACK routines is contained at the
+// end of this file or can be found at
+//
+// https://netlib.org/lapack/explore-html
+//
+// These classes do not provide the complete functionality of the
+// LAPACK routines upon which they are based -- only the
+// functionality as needed for specific project use, functionality
+// that may be updated without notice.
+//
+// Data mapping being used for direct invocation of
+// Fortran routines
+//
+// C++  int    ==  Fortran LOGICAL
+// C++  long   ==  Fortran INTEGER
+// C++  double ==  Fortran DOUBLE PRECISION
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Current class list
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSPSV : Created for solving A*X = B when A is a symmetric
+//               indefinite matrix in packed storage.
+// LAPACK base routine description:
+// DSPTRF computes the factorization of a real symmetric matrix A stored
+// in packed format using the Bunch-Kaufman diagonal pivoting method:
+//
+//    A = U*D*U**T  or  A = L*D*L**T
+//
+// DSPTRS solves a system of linear equations A*X = B with a real
+// symmetric matrix A stored in packed format using the factorization
+// A = U*D*U**T or A = L*D*L**T computed by DSPTRF.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Class DSPEVX : Created for computing selected eigenvalues and, optionally,
+//                eigenvectors of a symmetric matrix in packed storage.
+// LAPACK base routine description:
+// DSPEVX computes selected eigenvalues and, optionally, eigenvectors
+// of a real symmetric matrix A in packed storage.  Eigenvalues/vectors
+// can be selected by specifying either a range of values or a range of
+// indices for the desired eigenvalues.
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#ifdef  _DEBUG
+#include <cstdio>
+#else
+#ifndef NDEBUG
+#define NDEBUG
+#endif
+#endif
+
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "SCC_LapackHeaders.h"
+#include "SCC_LapackMatrix.h"
+#include "SCC_LapackSymPackedMatrix.h"
+
+#ifndef SCC_LAPACK_SYM_PACKED_ROUTINES_
+#define SCC_LAPACK_SYM_PACKED_ROUTINES_
+
+namespace SCC
+{
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSPSV : Created for solving A*X = B when A is a symmetric
+//               indefinite matrix in packed storage.
+//
+// The Bunch-Kaufman factors A = U*D*U**T are computed with DSPTRF using
+// the upper packed storage of LapackSymPackedMatrix, cached, and then
+// used by DSPTRS for any number of subsequent solves with any number of
+// right hand sides.
+//
+// The factors can be created in a copy of the input matrix data, or, to
+// avoid the copy, in place in the data of the input matrix.
+//
+// If D is exactly singular the factors are retained while
+// applyInverse(...) throws an exception.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class DSPSV
+{
+	public:
+
+	DSPSV()
+	{
+	initialize();
+	}
+
+	DSPSV(const DSPSV& dspsv)
+	{
+	initialize(dspsv);
+	}
+
+	void initialize()
+	{
+	APfactors.initialize();
+	IPIV.clear();
+	N    = 0;
+	INFO = 0;
+	}
+
+	void initialize(const DSPSV& dspsv)
+	{
+	APfactors.initialize(dspsv.APfactors);
+	IPIV = dspsv.IPIV;
+	N    = dspsv.N;
+	INFO = dspsv.INFO;
+	}
+
+	void applyInverse(const SCC::LapackSymPackedMatrix& S, std::vector<double>& f)
+	{
+	createFactors(S);
+	applyInverse(&f[0]);
+	}
+
+	void applyInverse(const SCC::LapackSymPackedMatrix& S, LapackMatrix& F)
+	{
+	createFactors(S);
+	applyInverse(F);
+	}
+
+	void applyInverse(std::vector<double>& f)
+	{
+	assert(sizeCheck((long)f.size(),N));
+	applyInverse(&f[0]);
+	}
+
+	void applyInverse(LapackMatrix& F)
+	{
+	assert(sizeCheck(F.rows,N));
+	applyInverse(F.dataPtr,F.cols);
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N,
+	// that are overwritten with the solutions.
+	//
+	void applyInverse(double* f, long NRHS = 1)
+	{
+    if(INFO > 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nDSPSV (dsptrs) Error \n";
+    	sout << "Matrix is singular: D(" << INFO-1 << "," << INFO-1 << ") = 0 \n";
+    	throw std::runtime_error(sout.str());
+    }
+
+    char UPLO  = 'U';
+    long LDB   = N;
+    long INFOs = 0;
+
+    dsptrs_(&UPLO, &N, &NRHS, APfactors.getDataPointer(), &IPIV[0], f, &LDB, &INFOs);
+
+    if(INFOs != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nDSPSV (dsptrs) \nError INFO = " << INFOs << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+	//
+	// Creates the factors of a copy of the matrix data of S.
+	//
+	void createFactors(const SCC::LapackSymPackedMatrix& S)
+	{
+	APfactors.initialize(S);
+	factor();
+	}
+
+	//
+	// Creates the factors in place.
+	//
+	// !!! Important: APdata, the upper packed storage of an N x N symmetric
+	// matrix, e.g. S.getDataPointer() for a LapackSymPackedMatrix S, is
+	// overwritten by the factors and must remain allocated while the factors
+	// are in use. No bounds checking is performed.
+	//
+	void createFactors(long N, double* APdata)
+	{
+	APfactors.initialize();  // release any locally allocated factors before adopting APdata
+	APfactors.initialize(N,APdata);
+	factor();
+	}
+
+    bool isSingular() const
+    {
+    return (INFO > 0);
+    }
+
+#ifdef _DEBUG
+    bool sizeCheck(long size1, long size2) const
+    {
+    if(size1 != size2)
+    {
+    std::cerr << "DSPSV sizes are incompatible : " << size1 << " != " << size2 << " ";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+    SCC::LapackSymPackedMatrix APfactors;
+    std::vector<long>               IPIV;
+
+	long    N;
+	long INFO;
+
+	private:
+
+	void factor()
+	{
+	N = APfactors.getDimension();
+	IPIV.resize(N);
+
+	char UPLO = 'U';
+	INFO      = 0;
+
+	dsptrf_(&UPLO, &N, APfactors.getDataPointer(), &IPIV[0], &INFO);
+
+    if(INFO < 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nDSPSV (dsptrf) \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Class DSPEVX : Created for computing selected eigenvalues and, optionally,
+//                eigenvectors of a symmetric matrix in packed storage.
+//
+// The member functions have the same form as those of DSYEVX, with the
+// symmetric matrix specified as a LapackSymPackedMatrix that is passed
+// to DSPEVX without conversion. Since DSPEVX overwrites the packed matrix,
+// the argument is copied unless overwriteA = true, in which case no
+// additional matrix storage is allocated and the contents of the argument
+// are destroyed.
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+class DSPEVX
+{
+public :
+
+    DSPEVX()
+    {
+    initialize();
+    }
+
+    void initialize()
+    {
+    AP.initialize();
+    WORK.clear();
+    IWORK.clear();
+    IFAIL.clear();
+    }
+
+    // Computes the eigCount algebraically smallest eigenvalues and eigenvectors.
+    // The value returned is the number of eigenvalues found.
+
+    long createAlgSmallestEigensystem(long eigCount, SCC::LapackSymPackedMatrix& S, std::vector<double>& eigValues,
+                                      SCC::LapackMatrix& eigVectors, bool overwriteA = false)
+    {
+    long N = S.getDimension();
+
+    if(eigCount > N)
+    {
+        std::stringstream sout;
+        sout << "\nDSPEVX Error \n";
+        sout << "Requested number of eigenvalues/eigenvectors exceeds system dimension. \n";
+        throw std::runtime_error(sout.str());
+    }
+
+    char JOBZ   = 'V'; // Specify N for eigenvalues only
+    char RANGE  = 'I'; // Specify index range of eigenvalues to be found (A for all, V for interval)
+
+    long IL = 1;        // Index of smallest eigenvalue returned
+    long IU = eigCount; // Index of largest  eigenvalue returned
+
+    long LDZ   = N;
+    eigVectors.initialize(LDZ,(IU-IL) + 1);  // Matrix whose columns containing the eigenvectors (Z in original call)
+
+    return dspevx(JOBZ,RANGE,IL,IU,S,overwriteA,eigValues,eigVectors.getDataPointer(),LDZ);
+    }
+
+    // Computes all eigenvalues and eigenvectors.
+    // The value returned is the number of eigenvalues found.
+
+    long createEigensystem(SCC::LapackSymPackedMatrix& S, std::vector<double>& eigValues,
+                           SCC::LapackMatrix& eigVectors, bool overwriteA = false)
+    {
+    long N = S.getDimension();
+
+    char JOBZ   = 'V'; // Specify N for eigenvalues only
+    char RANGE  = 'A'; // Specify index range of eigenvalues to be found (A for all, V for interval)
+
+    long IL = 0; // Index of smallest eigenvalue returned
+    long IU = 0; // Index of largest  eigenvalue returned
+
+    long LDZ   = N;
+    eigVectors.initialize(LDZ,N);      // Matrix whose columns containing the eigenvectors (Z in original call)
+
+    return dspevx(JOBZ,RANGE,IL,IU,S,overwriteA,eigValues,eigVectors.getDataPointer(),LDZ);
+    }
+
+    long createAlgSmallestEigenvalues(long eigCount, SCC::LapackSymPackedMatrix& S, std::vector<double>& eigValues,
+                                      bool overwriteA = false)
+    {
+    long N = S.getDimension();
+
+    if(eigCount > N)
+    {
+        std::stringstream sout;
+        sout << "\nDSPEVX Error \n";
+        sout << "Requested number of eigenvalues exceeds system dimension. \n";
+        throw std::runtime_error(sout.str());
+    }
+
+    char JOBZ   = 'N'; // Specify N for eigenvalues only
+    char RANGE  = 'I'; // Specify index range of eigenvalues to be found (A for all, V for interval)
+
+    long IL = 1;        // Index of smallest eigenvalue returned
+    long IU = eigCount; // Index of largest  eigenvalue returned
+
+    long LDZ     = 1;
+    double ZDATA = 0.0;
+
+    return dspevx(JOBZ,RANGE,IL,IU,S,overwriteA,eigValues,&ZDATA,LDZ);
+    }
+
+    SCC::LapackSymPackedMatrix    AP;
+    std::vector<double>         WORK;
+    std::vector<long>          IWORK;
+    std::vector<long>          IFAIL;
+
+private :
+
+    long dspevx(char JOBZ, char RANGE, long IL, long IU, SCC::LapackSymPackedMatrix& S, bool overwriteA,
+                std::vector<double>& eigValues, double* Zptr, long LDZ)
+    {
+    // DSPEVX overwrites the packed matrix data
+
+    if(not overwriteA) {AP.initialize(S);}
+    double* APptr = overwriteA ? S.getDataPointer() : AP.getDataPointer();
+
+    long N    = S.getDimension();
+    char UPLO = 'U';   // LapackSymPackedMatrix stores the upper triangle
+
+    double VL = 0;
+    double VU = 0;
+
+    char   DLAMCH_IN = 'S';
+    double ABSTOL    =  2.0*(dlamch_(&DLAMCH_IN));
+
+    long eigComputed = 0;     //  M parameter in original call = number of eigenvalues output
+
+    eigValues.clear();        // W parameter in original call
+    eigValues.resize(N,0.0);
+
+    long INFO = 0;
+
+    WORK.resize(8*N,0.0);
+    IWORK.resize(5*N,0);
+    IFAIL.resize(N,0);
+
+    dspevx_(&JOBZ, &RANGE, &UPLO,&N,APptr,&VL,&VU,&IL,&IU,&ABSTOL,&eigComputed,eigValues.data(),
+    Zptr,&LDZ,WORK.data(),IWORK.data(),IFAIL.data(),&INFO);
+
+    if(INFO != 0)
+    {
+        std::stringstream sout;
+        sout << "\nDSPEVX \nError INFO = " << INFO << "\n";
+        throw std::runtime_error(sout.str());
+    }
+
+    // resize the eig values array to the number of eigenvalues found
+
+    eigValues.resize(eigComputed);
+    return eigComputed;
+    }
+};
+
+} // Namespace SCC
+
+/*
+/////////////////////////////////////////////////////////////////////////////
+DSPTRF
+/////////////////////////////////////////////////////////////////////////////
+
+subroutine dsptrf 	( 	character  	uplo,
+		integer  	n,
+		double precision, dimension( * )  	ap,
+		integer, dimension( * )  	ipiv,
+		integer  	info
+	)
+
+Purpose:
+
+ DSPTRF computes the factorization of a real symmetric matrix A stored
+ in packed format using the Bunch-Kaufman diagonal pivoting method:
+
+    A = U*D*U**T  or  A = L*D*L**T
+
+ where U (or L) is a product of permutation and unit upper (lower)
+ triangular matrices, and D is symmetric and block diagonal with
+ 1-by-1 and 2-by-2 diagonal blocks.
+
+Parameters
+[in]	UPLO
+          UPLO is CHARACTER*1
+          = 'U':  Upper triangle of A is stored;
+          = 'L':  Lower triangle of A is stored.
+[in]	N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in,out]	AP
+          AP is DOUBLE PRECISION array, dimension (N*(N+1)/2)
+          On entry, the upper or lower triangle of the symmetric matrix
+          A, packed columnwise in a linear array.  The j-th column of A
+          is stored in the array AP as follows:
+          if UPLO = 'U', AP(i + (j-1)*j/2) = A(i,j) for 1<=i<=j;
+          if UPLO = 'L', AP(i + (j-1)*(2n-j)/2) = A(i,j) for j<=i<=n.
+
+          On exit, the block diagonal matrix D and the multipliers used
+          to obtain the factor U or L, stored as a packed triangular
+          matrix overwriting A.
+[out]	IPIV
+          IPIV is INTEGER array, dimension (N)
+          Details of the interchanges and the block structure of D.
+[out]	INFO
+          INFO is INTEGER
+          = 0: successful exit
+          < 0: if INFO = -i, the i-th argument had an illegal value
+          > 0: if INFO = i, D(i,i) is exactly zero.  The factorization
+               has been completed, but the block diagonal matrix D is
+               exactly singular, and division by zero will occur if it
+               is used to solve a system of equations.
+
+/////////////////////////////////////////////////////////////////////////////
+DSPTRS
+/////////////////////////////////////////////////////////////////////////////
+
+subroutine dsptrs 	( 	character  	uplo,
+		integer  	n,
+		integer  	nrhs,
+		double precision, dimension( * )  	ap,
+		integer, dimension( * )  	ipiv,
+		double precision, dimension( ldb, * )  	b,
+		integer  	ldb,
+		integer  	info
+	)
+
+Purpose:
+
+ DSPTRS solves a system of linear equations A*X = B with a real
+ symmetric matrix A stored in packed format using the factorization
+ A = U*D*U**T or A = L*D*L**T computed by DSPTRF.
+
+Parameters
+[in]	UPLO
+          UPLO is CHARACTER*1
+          Specifies whether the details of the factorization are stored
+          as an upper or lower triangular matrix.
+[in]	N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in]	NRHS
+          NRHS is INTEGER
+          The number of right hand sides.  NRHS >= 0.
+[in]	AP
+          AP is DOUBLE PRECISION array, dimension (N*(N+1)/2)
+          The block diagonal matrix D and the multipliers used to
+          obtain the factor U or L as computed by DSPTRF, stored as a
+          packed triangular matrix.
+[in]	IPIV
+          IPIV is INTEGER array, dimension (N)
+          Details of the interchanges and the block structure of D
+          as determined by DSPTRF.
+[in,out]	B
+          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+          On entry, the right hand side matrix B.
+          On exit, the solution matrix X.
+[in]	LDB
+          LDB is INTEGER
+          The leading dimension of the array B.  LDB >= max(1,N).
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0: if INFO = -i, the i-th argument had an illegal value
+
+/////////////////////////////////////////////////////////////////////////////
+DSPEVX
+/////////////////////////////////////////////////////////////////////////////
+
+subroutine dspevx 	( 	character  	jobz,
+		character  	range,
+		character  	uplo,
+		integer  	n,
+		double precision, dimension( * )  	ap,
+		double precision  	vl,
+		double precision  	vu,
+		integer  	il,
+		integer  	iu,
+		double precision  	abstol,
+		integer  	m,
+		double precision, dimension( * )  	w,
+		double precision, dimension( ldz, * )  	z,
+		integer  	ldz,
+		double precision, dimension( * )  	work,
+		integer, dimension( * )  	iwork,
+		integer, dimension( * )  	ifail,
+		integer  	info
+	)
+
+Purpose:
+
+ DSPEVX computes selected eigenvalues and, optionally, eigenvectors
+ of a real symmetric matrix A in packed storage.  Eigenvalues/vectors
+ can be selected by specifying either a range of values or a range of
+ indices for the desired eigenvalues.
+
+Parameters
+[in]	JOBZ
+          JOBZ is CHARACTER*1
+          = 'N':  Compute eigenvalues only;
+          = 'V':  Compute eigenvalues and eigenvectors.
+[in]	RANGE
+          RANGE is CHARACTER*1
+          = 'A': all eigenvalues will be found;
+          = 'V': all eigenvalues in the half-open interval (VL,VU]
+                 will be found;
+          = 'I': the IL-th through IU-th eigenvalues will be found.
+[in]	UPLO
+          UPLO is CHARACTER*1
+          = 'U':  Upper triangle of A is stored;
+          = 'L':  Lower triangle of A is stored.
+[in]	N
+          N is INTEGER
+          The order of the matrix A.  N >= 0.
+[in,out]	AP
+          AP is DOUBLE PRECISION array, dimension (N*(N+1)/2)
+          On entry, the upper or lower triangle of the symmetric matrix
+          A, packed columnwise in a linear array.
+
+          On exit, AP is overwritten by values generated during the
+          reduction to tridiagonal form.
+[in]	VL, VU
+          If RANGE='V', the lower and upper bounds of the interval to
+          be searched for eigenvalues. Not referenced if RANGE = 'A' or 'I'.
+[in]	IL, IU
+          If RANGE='I', the indices (in ascending order) of the
+          smallest and largest eigenvalues to be returned.
+          Not referenced if RANGE = 'A' or 'V'.
+[in]	ABSTOL
+          The absolute error tolerance for the eigenvalues.
+          Eigenvalues will be computed most accurately when ABSTOL is
+          set to twice the underflow threshold 2*DLAMCH('S').
+[out]	M
+          The total number of eigenvalues found.
+[out]	W
+          W is DOUBLE PRECISION array, dimension (N)
+          If INFO = 0, the selected eigenvalues in ascending order.
+[out]	Z
+          Z is DOUBLE PRECISION array, dimension (LDZ, max(1,M))
+          If JOBZ = 'V', then if INFO = 0, the first M columns of Z
+          contain the orthonormal eigenvectors of the matrix A
+          corresponding to the selected eigenvalues.
+          If JOBZ = 'N', then Z is not referenced.
+[in]	LDZ
+          The leading dimension of the array Z.  LDZ >= 1, and if
+          JOBZ = 'V', LDZ >= max(1,N).
+[out]	WORK
+          WORK is DOUBLE PRECISION array, dimension (8*N)
+[out]	IWORK
+          IWORK is INTEGER array, dimension (5*N)
+[out]	IFAIL
+          If JOBZ = 'V', then if INFO = 0, the first M elements of
+          IFAIL are zero.  If INFO > 0, then IFAIL contains the
+          indices of the eigenvectors that failed to converge.
+[out]	INFO
+          INFO is INTEGER
+          = 0:  successful exit
+          < 0:  if INFO = -i, the i-th argument had an illegal value
+          > 0:  if INFO = i, then i eigenvectors failed to converge.
+                Their indices are stored in array IFAIL.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
+NAG Ltd.
+*/
+
+#endif /* SCC_LAPACK_SYM_PACKED_ROUTINES_ */
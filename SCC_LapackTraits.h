@@ -0,0 +1,461 @@
+/*
+ * SCC_LapackTraits.h
+ *
+ *  Created on: Oct. 18, 2026
+ *      Author: anderson
+ */
+//
+// Compile time dispatch of BLAS and LAPACK routines for the four
+// LAPACK data types.
+//
+// LapackTraits<T> is specialized for
+//
+//  T = float                  : s prefixed routines (REAL)
+//  T = double                 : d prefixed routines (DOUBLE PRECISION)
+//  T = std::complex<float>    : c prefixed routines (COMPLEX)
+//  T = std::complex<double>   : z prefixed routines (COMPLEX*16)
+//
+// Each specialization defines
+//
+//  RealType        : float or double, the type of the real and imaginary
+//                    parts of T
+//  realComponents  : number of RealType values in a T value (1 or 2)
+//  prefix()        : the LAPACK routine prefix character
+//
+// and static member functions with the names of the LAPACK routines
+// without their prefix, e.g. LapackTraits<double>::gemm(...) invokes dgemm_.
+// The arguments are those of the Fortran routines, with matrix and vector
+// data of complex type passed as pointers to RealType arrays containing
+// alternating real and imaginary parts, consistent with the prototypes
+// in SCC_LapackHeaders.h.
+//
+// The routine templates in the LapackInterface classes, e.g. GESVX<T>,
+// use these functions so that the specific LAPACK routine is determined
+// at compile time.
+//
+// The workspace required by gesvx, gecon, gbcon, gbsvx, pocon and pbcon is
+// allocated internally.
+// Routines that are only available for a subset of the data types
+// are only defined in the corresponding specializations.
+//
+/*
+#############################################################################
+#
+# Copyright  2026 Chris Anderson
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the Lesser GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# For a copy of the GNU General Public License see
+# <http://www.gnu.org/licenses/>.
+#
+#############################################################################
+*/
+
+#include <vector>
+#include <complex>
+
+#include "SCC_LapackHeaders.h"
+
+#ifndef SCC_LAPACK_TRAITS_
+#define SCC_LAPACK_TRAITS_
+
+namespace SCC
+{
+
+template <class T> struct LapackTraits;
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+//                             double
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <> struct LapackTraits<double>
+{
+    typedef double RealType;
+    static const long realComponents = 1;
+    static char prefix() {return 'd';}
+
+    static void gemv(char* TRANS, long* M, long* N, double* ALPHA, double* A, long* LDA,
+                     double* X, long* INCX, double* BETA, double* Y, long* INCY)
+    {dgemv_(TRANS,M,N,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gemm(char* TRANSA, char* TRANSB, long* M, long* N, long* K, double* ALPHA,
+                     double* A, long* LDA, double* B, long* LDB, double* BETA, double* C, long* LDC)
+    {dgemm_(TRANSA,TRANSB,M,N,K,ALPHA,A,LDA,B,LDB,BETA,C,LDC);}
+
+    static void gbmv(char* TRANS, long* M, long* N, long* KL, long* KU, double* ALPHA, double* A,
+                     long* LDA, double* X, long* INCX, double* BETA, double* Y, long* INCY)
+    {dgbmv_(TRANS,M,N,KL,KU,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gesvx(char* FACT, char* TRANS, long* N, long* NRHS, double* A, long* LDA, double* AF, long* LDAF,
+                      long* IPIV, char* EQED, double* R, double* C, double* B, long* LDB, double* X, long* LDX,
+                      double* RCOND, double* FERR, double* BERR, long* INFO)
+    {
+    std::vector<double> WORK(4*(*N));
+    std::vector<long>  IWORK(*N);
+    dgesvx_(FACT,TRANS,N,NRHS,A,LDA,AF,LDAF,IPIV,EQED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void getrf(long* M, long* N, double* A, long* LDA, long* IPIV, long* INFO)
+    {dgetrf_(M,N,A,LDA,IPIV,INFO);}
+
+    static void getrs(char* TRANS, long* N, long* NRHS, double* A, long* LDA, long* IPIV,
+                      double* B, long* LDB, long* INFO)
+    {dgetrs_(TRANS,N,NRHS,A,LDA,IPIV,B,LDB,INFO);}
+
+    static void gecon(char* NORM, long* N, double* A, long* LDA, double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double> WORK(4*(*N));
+    std::vector<long>  IWORK(*N);
+    dgecon_(NORM,N,A,LDA,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void posv(char* UPLO, long* N, long* NRHS, double* A, long* LDA, double* B, long* LDB, long* INFO)
+    {dposv_(UPLO,N,NRHS,A,LDA,B,LDB,INFO);}
+
+    static void potrf(char* UPLO, long* N, double* A, long* LDA, long* INFO)
+    {dpotrf_(UPLO,N,A,LDA,INFO);}
+
+    static void potrs(char* UPLO, long* N, long* NRHS, double* A, long* LDA, double* B, long* LDB, long* INFO)
+    {dpotrs_(UPLO,N,NRHS,A,LDA,B,LDB,INFO);}
+
+    static void pocon(char* UPLO, long* N, double* A, long* LDA, double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double> WORK(3*(*N));
+    std::vector<long>  IWORK(*N);
+    dpocon_(UPLO,N,A,LDA,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void pbtrf(char* UPLO, long* N, long* KD, double* AB, long* LDAB, long* INFO)
+    {dpbtrf_(UPLO,N,KD,AB,LDAB,INFO);}
+
+    static void pbtrs(char* UPLO, long* N, long* KD, long* NRHS, double* AB, long* LDAB, double* B, long* LDB, long* INFO)
+    {dpbtrs_(UPLO,N,KD,NRHS,AB,LDAB,B,LDB,INFO);}
+
+    static void pbcon(char* UPLO, long* N, long* KD, double* AB, long* LDAB, double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double> WORK(3*(*N));
+    std::vector<long>  IWORK(*N);
+    dpbcon_(UPLO,N,KD,AB,LDAB,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void sytrf(char* UPLO, long* N, double* A, long* LDA, long* IPIV, double* WORK, long* LWORK, long* INFO)
+    {dsytrf_(UPLO,N,A,LDA,IPIV,WORK,LWORK,INFO);}
+
+    static void sytrs(char* UPLO, long* N, long* NRHS, double* A, long* LDA, long* IPIV,
+                      double* B, long* LDB, long* INFO)
+    {dsytrs_(UPLO,N,NRHS,A,LDA,IPIV,B,LDB,INFO);}
+
+    static void gesvd(char* JOBU, char* JOBVT, long* M, long* N, double* A, long* LDA, double* S, double* U, long* LDU,
+                      double* VT, long* LDVT, double* WORK, long* LWORK, long* INFO)
+    {dgesvd_(JOBU,JOBVT,M,N,A,LDA,S,U,LDU,VT,LDVT,WORK,LWORK,INFO);}
+
+    static void syev(char* JOBZ, char* UPLO, long* N, double* A, long* LDA, double* W, double* WORK, long* LWORK, long* INFO)
+    {dsyev_(JOBZ,UPLO,N,A,LDA,W,WORK,LWORK,INFO);}
+
+    static void gbtrf(long* M, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV, long* INFO)
+    {dgbtrf_(M,N,KL,KU,AB,LDAB,IPIV,INFO);}
+
+    static void gbtrs(char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* AB, long* LDAB,
+                      long* IPIV, double* B, long* LDB, long* INFO)
+    {dgbtrs_(TRANS,N,KL,KU,NRHS,AB,LDAB,IPIV,B,LDB,INFO);}
+
+    static void gbcon(char* NORM, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV,
+                      double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double> WORK(3*(*N));
+    std::vector<long>  IWORK(*N);
+    dgbcon_(NORM,N,KL,KU,AB,LDAB,IPIV,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void gbsvx(char* FACT, char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* AB, long* LDAB,
+                      double* AFB, long* LDAFB, long* IPIV, char* EQUED, double* R, double* C, double* B, long* LDB,
+                      double* X, long* LDX, double* RCOND, double* FERR, double* BERR, long* INFO)
+    {
+    std::vector<double> WORK(3*(*N));
+    std::vector<long>  IWORK(*N);
+    dgbsvx_(FACT,TRANS,N,KL,KU,NRHS,AB,LDAB,AFB,LDAFB,IPIV,EQUED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void gehrd(long* N, long* ILO, long* IHI, double* A, long* LDA, double* TAU,
+                      double* WORK, long* LWORK, long* INFO)
+    {dgehrd_(N,ILO,IHI,A,LDA,TAU,WORK,LWORK,INFO);}
+
+    static void ormhr(char* SIDE, char* TRANS, long* M, long* N, long* ILO, long* IHI, double* A, long* LDA,
+                      double* TAU, double* C, long* LDC, double* WORK, long* LWORK, long* INFO)
+    {dormhr_(SIDE,TRANS,M,N,ILO,IHI,A,LDA,TAU,C,LDC,WORK,LWORK,INFO);}
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+//                             float
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <> struct LapackTraits<float>
+{
+    typedef float RealType;
+    static const long realComponents = 1;
+    static char prefix() {return 's';}
+
+    static void gemv(char* TRANS, long* M, long* N, float* ALPHA, float* A, long* LDA,
+                     float* X, long* INCX, float* BETA, float* Y, long* INCY)
+    {sgemv_(TRANS,M,N,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gemm(char* TRANSA, char* TRANSB, long* M, long* N, long* K, float* ALPHA,
+                     float* A, long* LDA, float* B, long* LDB, float* BETA, float* C, long* LDC)
+    {sgemm_(TRANSA,TRANSB,M,N,K,ALPHA,A,LDA,B,LDB,BETA,C,LDC);}
+
+    static void gbmv(char* TRANS, long* M, long* N, long* KL, long* KU, float* ALPHA, float* A,
+                     long* LDA, float* X, long* INCX, float* BETA, float* Y, long* INCY)
+    {sgbmv_(TRANS,M,N,KL,KU,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gesvx(char* FACT, char* TRANS, long* N, long* NRHS, float* A, long* LDA, float* AF, long* LDAF,
+                      long* IPIV, char* EQED, float* R, float* C, float* B, long* LDB, float* X, long* LDX,
+                      float* RCOND, float* FERR, float* BERR, long* INFO)
+    {
+    std::vector<float>  WORK(4*(*N));
+    std::vector<long>  IWORK(*N);
+    sgesvx_(FACT,TRANS,N,NRHS,A,LDA,AF,LDAF,IPIV,EQED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void getrf(long* M, long* N, float* A, long* LDA, long* IPIV, long* INFO)
+    {sgetrf_(M,N,A,LDA,IPIV,INFO);}
+
+    static void getrs(char* TRANS, long* N, long* NRHS, float* A, long* LDA, long* IPIV,
+                      float* B, long* LDB, long* INFO)
+    {sgetrs_(TRANS,N,NRHS,A,LDA,IPIV,B,LDB,INFO);}
+
+    static void gecon(char* NORM, long* N, float* A, long* LDA, float* ANORM, float* RCOND, long* INFO)
+    {
+    std::vector<float> WORK(4*(*N));
+    std::vector<long>  IWORK(*N);
+    sgecon_(NORM,N,A,LDA,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void posv(char* UPLO, long* N, long* NRHS, float* A, long* LDA, float* B, long* LDB, long* INFO)
+    {sposv_(UPLO,N,NRHS,A,LDA,B,LDB,INFO);}
+
+    static void potrf(char* UPLO, long* N, float* A, long* LDA, long* INFO)
+    {spotrf_(UPLO,N,A,LDA,INFO);}
+
+    static void potrs(char* UPLO, long* N, long* NRHS, float* A, long* LDA, float* B, long* LDB, long* INFO)
+    {spotrs_(UPLO,N,NRHS,A,LDA,B,LDB,INFO);}
+
+    static void pocon(char* UPLO, long* N, float* A, long* LDA, float* ANORM, float* RCOND, long* INFO)
+    {
+    std::vector<float> WORK(3*(*N));
+    std::vector<long>  IWORK(*N);
+    spocon_(UPLO,N,A,LDA,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+
+    static void sytrf(char* UPLO, long* N, float* A, long* LDA, long* IPIV, float* WORK, long* LWORK, long* INFO)
+    {ssytrf_(UPLO,N,A,LDA,IPIV,WORK,LWORK,INFO);}
+
+    static void sytrs(char* UPLO, long* N, long* NRHS, float* A, long* LDA, long* IPIV,
+                      float* B, long* LDB, long* INFO)
+    {ssytrs_(UPLO,N,NRHS,A,LDA,IPIV,B,LDB,INFO);}
+
+    static void gesvd(char* JOBU, char* JOBVT, long* M, long* N, float* A, long* LDA, float* S, float* U, long* LDU,
+                      float* VT, long* LDVT, float* WORK, long* LWORK, long* INFO)
+    {sgesvd_(JOBU,JOBVT,M,N,A,LDA,S,U,LDU,VT,LDVT,WORK,LWORK,INFO);}
+
+    static void syev(char* JOBZ, char* UPLO, long* N, float* A, long* LDA, float* W, float* WORK, long* LWORK, long* INFO)
+    {ssyev_(JOBZ,UPLO,N,A,LDA,W,WORK,LWORK,INFO);}
+
+    static void gbtrf(long* M, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV, long* INFO)
+    {sgbtrf_(M,N,KL,KU,AB,LDAB,IPIV,INFO);}
+
+    static void gbtrs(char* TRANS, long* N, long* KL, long* KU, long* NRHS, float* AB, long* LDAB,
+                      long* IPIV, float* B, long* LDB, long* INFO)
+    {sgbtrs_(TRANS,N,KL,KU,NRHS,AB,LDAB,IPIV,B,LDB,INFO);}
+
+    static void gbcon(char* NORM, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV,
+                      float* ANORM, float* RCOND, long* INFO)
+    {
+    std::vector<float>  WORK(3*(*N));
+    std::vector<long>  IWORK(*N);
+    sgbcon_(NORM,N,KL,KU,AB,LDAB,IPIV,ANORM,RCOND,&WORK[0],&IWORK[0],INFO);
+    }
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+//                        std::complex<double>
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <> struct LapackTraits< std::complex<double> >
+{
+    typedef double RealType;
+    static const long realComponents = 2;
+    static char prefix() {return 'z';}
+
+    static void gemv(char* TRANS, long* M, long* N, double* ALPHA, double* A, long* LDA,
+                     double* X, long* INCX, double* BETA, double* Y, long* INCY)
+    {zgemv_(TRANS,M,N,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gemm(char* TRANSA, char* TRANSB, long* M, long* N, long* K, double* ALPHA,
+                     double* A, long* LDA, double* B, long* LDB, double* BETA, double* C, long* LDC)
+    {zgemm_(TRANSA,TRANSB,M,N,K,ALPHA,A,LDA,B,LDB,BETA,C,LDC);}
+
+    static void gbmv(char* TRANS, long* M, long* N, long* KL, long* KU, double* ALPHA, double* A,
+                     long* LDA, double* X, long* INCX, double* BETA, double* Y, long* INCY)
+    {zgbmv_(TRANS,M,N,KL,KU,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gesvx(char* FACT, char* TRANS, long* N, long* NRHS, double* A, long* LDA, double* AF, long* LDAF,
+                      long* IPIV, char* EQED, double* R, double* C, double* B, long* LDB, double* X, long* LDX,
+                      double* RCOND, double* FERR, double* BERR, long* INFO)
+    {
+    std::vector<double>  WORK(4*(*N));
+    std::vector<double> RWORK(2*(*N));
+    zgesvx_(FACT,TRANS,N,NRHS,A,LDA,AF,LDAF,IPIV,EQED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void gbtrf(long* M, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV, long* INFO)
+    {zgbtrf_(M,N,KL,KU,AB,LDAB,IPIV,INFO);}
+
+    static void gbtrs(char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* AB, long* LDAB,
+                      long* IPIV, double* B, long* LDB, long* INFO)
+    {zgbtrs_(TRANS,N,KL,KU,NRHS,AB,LDAB,IPIV,B,LDB,INFO);}
+
+    static void gbcon(char* NORM, long* N, long* KL, long* KU, double* AB, long* LDAB, long* IPIV,
+                      double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double>  WORK(4*(*N));
+    std::vector<double> RWORK(*N);
+    zgbcon_(NORM,N,KL,KU,AB,LDAB,IPIV,ANORM,RCOND,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void gbsvx(char* FACT, char* TRANS, long* N, long* KL, long* KU, long* NRHS, double* AB, long* LDAB,
+                      double* AFB, long* LDAFB, long* IPIV, char* EQUED, double* R, double* C, double* B, long* LDB,
+                      double* X, long* LDX, double* RCOND, double* FERR, double* BERR, long* INFO)
+    {
+    std::vector<double>  WORK(4*(*N));
+    std::vector<double> RWORK(*N);
+    zgbsvx_(FACT,TRANS,N,KL,KU,NRHS,AB,LDAB,AFB,LDAFB,IPIV,EQUED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void potrf(char* UPLO, long* N, double* A, long* LDA, long* INFO)
+    {zpotrf_(UPLO,N,A,LDA,INFO);}
+
+    static void potrs(char* UPLO, long* N, long* NRHS, double* A, long* LDA, double* B, long* LDB, long* INFO)
+    {zpotrs_(UPLO,N,NRHS,A,LDA,B,LDB,INFO);}
+
+    static void pocon(char* UPLO, long* N, double* A, long* LDA, double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double>  WORK(4*(*N));
+    std::vector<double> RWORK(*N);
+    zpocon_(UPLO,N,A,LDA,ANORM,RCOND,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void pbtrf(char* UPLO, long* N, long* KD, double* AB, long* LDAB, long* INFO)
+    {zpbtrf_(UPLO,N,KD,AB,LDAB,INFO);}
+
+    static void pbtrs(char* UPLO, long* N, long* KD, long* NRHS, double* AB, long* LDAB, double* B, long* LDB, long* INFO)
+    {zpbtrs_(UPLO,N,KD,NRHS,AB,LDAB,B,LDB,INFO);}
+
+    static void pbcon(char* UPLO, long* N, long* KD, double* AB, long* LDAB, double* ANORM, double* RCOND, long* INFO)
+    {
+    std::vector<double>  WORK(4*(*N));
+    std::vector<double> RWORK(*N);
+    zpbcon_(UPLO,N,KD,AB,LDAB,ANORM,RCOND,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void gehrd(long* N, long* ILO, long* IHI, double* A, long* LDA, double* TAU,
+                      double* WORK, long* LWORK, long* INFO)
+    {zgehrd_(N,ILO,IHI,A,LDA,TAU,WORK,LWORK,INFO);}
+
+    static void unmhr(char* SIDE, char* TRANS, long* M, long* N, long* ILO, long* IHI, double* A, long* LDA,
+                      double* TAU, double* C, long* LDC, double* WORK, long* LWORK, long* INFO)
+    {zunmhr_(SIDE,TRANS,M,N,ILO,IHI,A,LDA,TAU,C,LDC,WORK,LWORK,INFO);}
+};
+
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+//                        std::complex<float>
+//XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+template <> struct LapackTraits< std::complex<float> >
+{
+    typedef float RealType;
+    static const long realComponents = 2;
+    static char prefix() {return 'c';}
+
+    static void gemv(char* TRANS, long* M, long* N, float* ALPHA, float* A, long* LDA,
+                     float* X, long* INCX, float* BETA, float* Y, long* INCY)
+    {cgemv_(TRANS,M,N,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gemm(char* TRANSA, char* TRANSB, long* M, long* N, long* K, float* ALPHA,
+                     float* A, long* LDA, float* B, long* LDB, float* BETA, float* C, long* LDC)
+    {cgemm_(TRANSA,TRANSB,M,N,K,ALPHA,A,LDA,B,LDB,BETA,C,LDC);}
+
+    static void gbmv(char* TRANS, long* M, long* N, long* KL, long* KU, float* ALPHA, float* A,
+                     long* LDA, float* X, long* INCX, float* BETA, float* Y, long* INCY)
+    {cgbmv_(TRANS,M,N,KL,KU,ALPHA,A,LDA,X,INCX,BETA,Y,INCY);}
+
+    static void gesvx(char* FACT, char* TRANS, long* N, long* NRHS, float* A, long* LDA, float* AF, long* LDAF,
+                      long* IPIV, char* EQED, float* R, float* C, float* B, long* LDB, float* X, long* LDX,
+                      float* RCOND, float* FERR, float* BERR, long* INFO)
+    {
+    std::vector<float>  WORK(4*(*N));
+    std::vector<float> RWORK(2*(*N));
+    cgesvx_(FACT,TRANS,N,NRHS,A,LDA,AF,LDAF,IPIV,EQED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void potrf(char* UPLO, long* N, float* A, long* LDA, long* INFO)
+    {cpotrf_(UPLO,N,A,LDA,INFO);}
+
+    static void potrs(char* UPLO, long* N, long* NRHS, float* A, long* LDA, float* B, long* LDB, long* INFO)
+    {cpotrs_(UPLO,N,NRHS,A,LDA,B,LDB,INFO);}
+
+    static void pocon(char* UPLO, long* N, float* A, long* LDA, float* ANORM, float* RCOND, long* INFO)
+    {
+    std::vector<float>  WORK(4*(*N));
+    std::vector<float> RWORK(*N);
+    cpocon_(UPLO,N,A,LDA,ANORM,RCOND,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void gbtrf(long* M, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV, long* INFO)
+    {cgbtrf_(M,N,KL,KU,AB,LDAB,IPIV,INFO);}
+
+    static void gbtrs(char* TRANS, long* N, long* KL, long* KU, long* NRHS, float* AB, long* LDAB,
+                      long* IPIV, float* B, long* LDB, long* INFO)
+    {cgbtrs_(TRANS,N,KL,KU,NRHS,AB,LDAB,IPIV,B,LDB,INFO);}
+
+    static void gbcon(char* NORM, long* N, long* KL, long* KU, float* AB, long* LDAB, long* IPIV,
+                      float* ANORM, float* RCOND, long* INFO)
+    {
+    std::vector<float>  WORK(4*(*N));
+    std::vector<float> RWORK(*N);
+    cgbcon_(NORM,N,KL,KU,AB,LDAB,IPIV,ANORM,RCOND,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void gbsvx(char* FACT, char* TRANS, long* N, long* KL, long* KU, long* NRHS, float* AB, long* LDAB,
+                      float* AFB, long* LDAFB, long* IPIV, char* EQUED, float* R, float* C, float* B, long* LDB,
+                      float* X, long* LDX, float* RCOND, float* FERR, float* BERR, long* INFO)
+    {
+    std::vector<float>  WORK(4*(*N));
+    std::vector<float> RWORK(*N);
+    cgbsvx_(FACT,TRANS,N,KL,KU,NRHS,AB,LDAB,AFB,LDAFB,IPIV,EQUED,R,C,B,LDB,X,LDX,RCOND,FERR,BERR,&WORK[0],&RWORK[0],INFO);
+    }
+
+    static void pbtrf(char* UPLO, long* N, long* KD, float* AB, long* LDAB, long* INFO)
+    {cpbtrf_(UPLO,N,KD,AB,LDAB,INFO);}
+
+    static void pbtrs(char* UPLO, long* N, long* KD, long* NRHS, float* AB, long* LDAB, float* B, long* LDB, long* INFO)
+    {cpbtrs_(UPLO,N,KD,NRHS,AB,LDAB,B,LDB,INFO);}
+
+    static void pbcon(char* UPLO, long* N, long* KD, float* AB, long* LDAB, float* ANORM, float* RCOND, long* INFO)
+    {
+    std::vector<float>  WORK(4*(*N));
+    std::vector<float> RWORK(*N);
+    cpbcon_(UPLO,N,KD,AB,LDAB,ANORM,RCOND,&WORK[0],&RWORK[0],INFO);
+    }
+};
+
+} // Namespace SCC
+
+#endif /* SCC_LAPACK_TRAITS_ */
@@ -48,6 +48,21 @@
 //          matrix T.  The user may ask for all eigenvalues, all eigenvalues
 //          in the half-open interval (VL, VU], or the IL-th through IU-th
 //          eigenvalues.
+//
+// DSTEIN : computes the eigenvectors of a real symmetric tridiagonal
+//          matrix T corresponding to specified eigenvalues, using inverse
+//          iteration.
+//
+// The multithreaded spectrum slicing routines use std::thread, so
+// programs using them should be linked with the platform thread
+// library (e.g. -pthread).
+//
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+// Additional classes
+// XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+//
+// CyclicTriDiagSolver : solves cyclic (periodic) tridiagonal systems
+// using the Sherman-Morrison formula and cached DGTTRF factors.
 /*
 #############################################################################
 #
@@ -72,6 +87,10 @@
 #include <stdexcept>
 #include <exception>
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
 
 #include "SCC_LapackMatrix.h"
 
@@ -433,16 +452,16 @@ std::vector<double> getLowestSymTriEigValues(long nValues, std::vector<double> &
     long nsplit = 0;   // number of diagonal blocks
 
     double* ePtr   = &eVals[0]; // array for the eigenvalues
-    long*   iblock = new long[N];
-    long*   isplit = new long[N];
 
-    double* work   = new double[4*N];   // work array
-    long*  iwork   = new long[3*N];     // work array
+    std::vector<long>   iblock(N);
+    std::vector<long>   isplit(N);
+    std::vector<double> work(4*N);    // work array
+    std::vector<long>   iwork(3*N);   // work array
 
     long   info = 0;
 
     dstebz_(&range, &order, &n, &vLower, &vUpper, &iLower, &iUpper,
-    &abstol, dPtr, uPtr, &mFound, &nsplit, ePtr, iblock, isplit, work, iwork, &info);
+    &abstol, dPtr, uPtr, &mFound, &nsplit, ePtr, iblock.data(), isplit.data(), work.data(), iwork.data(), &info);
 
     if(info != 0)
     {
@@ -458,13 +477,6 @@ std::vector<double> getLowestSymTriEigValues(long nValues, std::vector<double> &
     for(i = 0; i < nValues; i++)
     {eValsReturn[i] = eVals[i];}
 
-    /* clean up */
-
-    delete [] iblock;
-    delete [] isplit;
-    delete [] work;
-    delete [] iwork;
-
     return eValsReturn;
 }
 
@@ -499,17 +511,15 @@ std::vector<double>& D, std::vector<double>& U,std::vector<double>& eigVals)
     long nsplit = 1;   // number of diagonal blocks
 
     double* ePtr   = &eVals[0]; // array for the eigenvalues
-    long*   iblock = new long[N];
-    long*   isplit = new long[N];
 
-    double* work   = new double[4*N];   // work array
-    long*  iwork   = new long[3*N];     // work array
+    std::vector<long>   iblock(N);
+    std::vector<long>   isplit(N);
+    std::vector<double> work(4*N);    // work array
+    std::vector<long>   iwork(3*N);   // work array
     long   info    = 0;
 
-
-
     dstebz_(&range, &order, &n, &vLower, &vUpper, &iLower, &iUpper,
-    &abstol, dPtr, uPtr, &mFound, &nsplit, ePtr, iblock, isplit, work, iwork,
+    &abstol, dPtr, uPtr, &mFound, &nsplit, ePtr, iblock.data(), isplit.data(), work.data(), iwork.data(),
     &info);
 
     if(info != 0)
@@ -530,18 +540,577 @@ std::vector<double>& D, std::vector<double>& U,std::vector<double>& eigVals)
     {eigVals[i] = eVals[i];}
     }
 
+    return mFound;
+}
 
-    // clean up //
+//
+//##############################################################################
+//   SYMMETRIC TRIDIAGONAL MATRIX ROUTINES : MULTITHREADED SPECTRUM SLICING
+//##############################################################################
+//
+// These routines compute selected eigenvalues, and optionally eigenvectors,
+// of a symmetric tridiagonal matrix using threadCount threads.
+//
+// The requested index range of eigenvalues is split into threadCount contiguous
+// sub-ranges (slices) and the eigenvalues in each slice are computed
+// independently by bisection (dstebz). When a range of values is specified,
+// the corresponding index range is determined using Sturm counts.
+//
+// Eigenvectors are computed by inverse iteration (dstein). The eigenvalues are
+// partitioned among the threads so that a cluster of close eigenvalues, whose
+// eigenvectors dstein re-orthogonalizes, is never split between two threads.
+//
+// Eigenvalues are returned in increasing order and the columns of Q are
+// the corresponding eigenvectors.
+//
+// If threadCount <= 0 then std::thread::hardware_concurrency() threads are used.
+//
 
-    delete [] iblock;
-    delete [] isplit;
-    delete [] work;
-    delete [] iwork;
+//
+// Returns the number of eigenvalues of the symmetric tridiagonal matrix
+// that are less than lambda (the Sturm count).
+//
+long getSymTriEigCount(double lambda, const std::vector<double>& D, const std::vector<double>& U)
+{
+    long N = (long)D.size();
 
+    char   cmach  = 'S';
+    double pivmin = 1.0;
+    for(long i = 0; i < N-1; i++) {pivmin = std::max(pivmin,U[i]*U[i]);}
+    pivmin *= dlamch_(&cmach);
 
-    return mFound;
+    long   count = 0;
+    double q     = 0.0;
+
+    for(long i = 0; i < N; i++)
+    {
+        if(i == 0) {q = D[0] - lambda;}
+        else       {q = (D[i] - lambda) - (U[i-1]*U[i-1])/q;}
+
+        if(std::abs(q) < pivmin) {q = -pivmin;}
+        if(q < 0.0)              {count++;}
+    }
+    return count;
+}
+
+// This routine returns the lowest nValues eigenvalues as a std::vector<double>
+
+std::vector<double> getLowestSymTriEigValuesThreaded(long nValues, const std::vector<double>& D,
+		const std::vector<double>& U, long threadCount = 0)
+{
+    long N = (long)D.size();
+
+    if(nValues > N)
+    {
+    	std::stringstream sout;
+    	sout << "\ngetLowestSymTriEigValuesThreaded error \nError: Requested number of eigenvalues > dimension";
+    	sout << "\nRequested number of eigenvalues = " << nValues;
+    	sout << "\nDimension of matrix             = " << N;
+    	throw std::runtime_error(sout.str());
+    }
+
+    std::vector<double> eigVals;
+    std::vector<long>   iblock;
+    std::vector<long>   isplit;
+
+    computeSymTriEigValueSlices(1,nValues,'E',D,U,eigVals,iblock,isplit,threadCount);
+    return eigVals;
+}
+
+//
+// The return value of this routine is the number M of eigenvalues found in
+// the interval (lambdaMin, lambdaMax]. The array eigVals contains the eigenvalues.
+//
+long getLowestSymTriEigValuesThreaded(double lambdaMin, double lambdaMax, const std::vector<double>& D,
+		const std::vector<double>& U, std::vector<double>& eigVals, long threadCount = 0)
+{
+    std::vector<long>   iblock;
+    std::vector<long>   isplit;
+
+    long iLower = getSymTriEigCount(lambdaMin,D,U) + 1;
+    long iUpper = getSymTriEigCount(lambdaMax,D,U);
+
+    computeSymTriEigValueSlices(iLower,iUpper,'E',D,U,eigVals,iblock,isplit,threadCount);
+    return (long)eigVals.size();
+}
+
+// This routine returns the lowest nValues eigenvalues as a std::vector<double> and
+// sets columns of Q to be the eigenvectors.
+
+std::vector<double> getLowestSymTriEigSystemThreaded(long nValues, const std::vector<double>& D,
+		const std::vector<double>& U, SCC::LapackMatrix& Q, long threadCount = 0)
+{
+    long N = (long)D.size();
+
+    if(nValues > N)
+    {
+    	std::stringstream sout;
+    	sout << "\ngetLowestSymTriEigSystemThreaded error \nError: Requested number of eigenvalues/eigenvectors > dimension";
+    	sout << "\nRequested number of eigenvalues = " << nValues;
+    	sout << "\nDimension of matrix             = " << N;
+    	throw std::runtime_error(sout.str());
+    }
+
+    std::vector<double> eigVals;
+    std::vector<long>   iblock;
+    std::vector<long>   isplit;
+
+    computeSymTriEigValueSlices(1,nValues,'B',D,U,eigVals,iblock,isplit,threadCount);
+    computeSymTriEigVectorSlices(D,U,eigVals,iblock,isplit,Q,threadCount);
+    return eigVals;
+}
+
+//
+// The return value of this routine is the number M of eigenvalues found in
+// the interval (lambdaMin, lambdaMax]. The array eigVals contains the
+// eigenvalues and the M columns of Q contain the eigenvectors.
+//
+long getLowestSymTriEigSystemThreaded(double lambdaMin, double lambdaMax, const std::vector<double>& D,
+		const std::vector<double>& U, std::vector<double>& eigVals, SCC::LapackMatrix& Q, long threadCount = 0)
+{
+    std::vector<long>   iblock;
+    std::vector<long>   isplit;
+
+    long iLower = getSymTriEigCount(lambdaMin,D,U) + 1;
+    long iUpper = getSymTriEigCount(lambdaMax,D,U);
+
+    computeSymTriEigValueSlices(iLower,iUpper,'B',D,U,eigVals,iblock,isplit,threadCount);
+    computeSymTriEigVectorSlices(D,U,eigVals,iblock,isplit,Q,threadCount);
+    return (long)eigVals.size();
+}
+
+//
+// Computes the iLower-th through iUpper-th eigenvalues (1 based indexing, as in
+// LAPACK) by bisecting threadCount index slices concurrently. The ORDER
+// parameter of dstebz is specified by order. W, IBLOCK and ISPLIT are
+// the concatenation of the dstebz output for each slice, so that when
+// order = 'E' the eigenvalues in W are in increasing order.
+//
+void computeSymTriEigValueSlices(long iLower, long iUpper, char order, const std::vector<double>& D,
+		const std::vector<double>& U, std::vector<double>& W, std::vector<long>& IBLOCK,
+		std::vector<long>& ISPLIT, long threadCount)
+{
+    long N = (long)D.size();
+
+    W.clear();
+    IBLOCK.clear();
+    ISPLIT.clear();
+    ISPLIT.resize(N,0);
+
+    if((N == 0)||(iUpper < iLower)) {return;}
+
+    long indexCount = (iUpper - iLower) + 1;
+    threadCount     = getSliceThreadCount(threadCount,indexCount);
+
+    char   cmach  = 'S';
+    double abstol = 2.0*dlamch_(&cmach); // Maximal accuracy, as required for dstein
+
+    std::vector< std::vector<double> >  wSlice(threadCount);
+    std::vector< std::vector<long> > iblockSlice(threadCount);
+    std::vector< std::vector<long> > isplitSlice(threadCount);
+    std::vector<long>                     mSlice(threadCount,0);
+    std::vector<long>                  infoSlice(threadCount,0);
+
+    auto bisectSlice = [&](long k)
+    {
+    char range    = 'I';
+    char orderK   = order;
+    long n        = N;
+    double vLower = 0.0;
+    double vUpper = 0.0;
+    long   il     = iLower + (k*indexCount)/threadCount;
+    long   iu     = iLower + ((k+1)*indexCount)/threadCount - 1;
+    double tol    = abstol;
+    long   nsplit = 0;
+
+    wSlice[k].resize(N);
+    iblockSlice[k].resize(N);
+    isplitSlice[k].resize(N);
+
+    std::vector<double> work(4*N);
+    std::vector<long>  iwork(3*N);
+
+    dstebz_(&range, &orderK, &n, &vLower, &vUpper, &il, &iu, &tol,
+    const_cast<double*>(D.data()), const_cast<double*>(U.data()), &mSlice[k], &nsplit,
+    wSlice[k].data(), iblockSlice[k].data(), isplitSlice[k].data(), work.data(), iwork.data(), &infoSlice[k]);
+    };
+
+    std::vector<std::thread> threads;
+    for(long k = 1; k < threadCount; k++) {threads.emplace_back(bisectSlice,k);}
+    bisectSlice(0);
+    for(auto& t : threads) {t.join();}
+
+    for(long k = 0; k < threadCount; k++)
+    {
+    if(infoSlice[k] != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\ncomputeSymTriEigValueSlices LAPACK (dstebz) error \nError INFO = " << infoSlice[k] << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+    }
+
+    // Merge the slices
+
+    for(long k = 0; k < threadCount; k++)
+    {
+    W.insert(W.end(),wSlice[k].begin(),wSlice[k].begin() + mSlice[k]);
+    IBLOCK.insert(IBLOCK.end(),iblockSlice[k].begin(),iblockSlice[k].begin() + mSlice[k]);
+    }
+    ISPLIT = isplitSlice[0];
+}
+
+//
+// Computes the eigenvectors associated with the eigenvalues W using dstein. W, IBLOCK
+// and ISPLIT are the output of computeSymTriEigValueSlices (in any order). On return W
+// and IBLOCK are sorted into increasing order of eigenvalue and the columns of Q are the
+// corresponding eigenvectors.
+//
+void computeSymTriEigVectorSlices(const std::vector<double>& D, const std::vector<double>& U,
+		std::vector<double>& W, std::vector<long>& IBLOCK, std::vector<long>& ISPLIT,
+		SCC::LapackMatrix& Q, long threadCount)
+{
+    long N = (long)D.size();
+    long M = (long)W.size();
+
+    if(M == 0) {Q.initialize(); return;}
+
+    // dstein requires eigenvalues grouped by split-off block and increasing within a block
+
+    std::vector<long> blockOrder(M);
+    for(long i = 0; i < M; i++) {blockOrder[i] = i;}
+
+    std::sort(blockOrder.begin(),blockOrder.end(),[&](long a, long b)
+    {
+    if(IBLOCK[a] != IBLOCK[b]) {return IBLOCK[a] < IBLOCK[b];}
+    if(W[a]      != W[b])      {return W[a] < W[b];}
+    return a < b;
+    });
+
+    // dstein re-orthogonalizes eigenvectors whose eigenvalues are within
+    // 1.0e-3 times the 1-norm of their block of each other. The 1-norm of the
+    // matrix is used as a bound for the 1-norm of each block.
+
+    double oneNorm = 0.0;
+    for(long i = 0; i < N; i++)
+    {
+    double colSum = std::abs(D[i]);
+    if(i > 0)   {colSum += std::abs(U[i-1]);}
+    if(i < N-1) {colSum += std::abs(U[i]);}
+    oneNorm = std::max(oneNorm,colSum);
+    }
+    double orthoTol = 1.0e-3*oneNorm;
+
+    // Create slices whose boundaries only occur between blocks or between
+    // eigenvalues separated by more than orthoTol.
+
+    threadCount = getSliceThreadCount(threadCount,M);
+
+    std::vector<long> sliceStart(1,0);
+    for(long k = 1; k < threadCount; k++)
+    {
+    long s = (k*M)/threadCount;
+    if(s <= sliceStart.back()) {continue;}
+    while((s < M)&&(IBLOCK[blockOrder[s]] == IBLOCK[blockOrder[s-1]])
+                 &&(W[blockOrder[s]] - W[blockOrder[s-1]] <= orthoTol)) {s++;}
+    if(s < M) {sliceStart.push_back(s);}
+    }
+    sliceStart.push_back(M);
+
+    long sliceCount = (long)sliceStart.size() - 1;
+
+    std::vector<SCC::LapackMatrix> Zslice(sliceCount);
+    std::vector<long>           infoSlice(sliceCount,0);
+
+    auto inverseIterate = [&](long k)
+    {
+    long n   = N;
+    long m   = sliceStart[k+1] - sliceStart[k];
+    long ldz = N;
+
+    std::vector<double>   w(m);
+    std::vector<long>   iblock(m);
+    for(long i = 0; i < m; i++)
+    {
+    w[i]      = W[blockOrder[sliceStart[k] + i]];
+    iblock[i] = IBLOCK[blockOrder[sliceStart[k] + i]];
+    }
+
+    Zslice[k].initialize(N,m);
+
+    std::vector<double>  work(5*N);
+    std::vector<long>   iwork(N);
+    std::vector<long>   ifail(m);
+
+    dstein_(&n, const_cast<double*>(D.data()), const_cast<double*>(U.data()), &m, w.data(), iblock.data(),
+    ISPLIT.data(), Zslice[k].getDataPointer(), &ldz, work.data(), iwork.data(), ifail.data(), &infoSlice[k]);
+    };
+
+    std::vector<std::thread> threads;
+    for(long k = 1; k < sliceCount; k++) {threads.emplace_back(inverseIterate,k);}
+    inverseIterate(0);
+    for(auto& t : threads) {t.join();}
+
+    for(long k = 0; k < sliceCount; k++)
+    {
+    if(infoSlice[k] != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\ncomputeSymTriEigVectorSlices LAPACK (dstein) error \nError INFO = " << infoSlice[k] << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+    }
+
+    // Merge the slices in increasing order of eigenvalue
+
+    std::vector<long> sliceIndex(M);
+    std::vector<long>   colIndex(M);
+    for(long k = 0; k < sliceCount; k++)
+    {
+    for(long p = sliceStart[k]; p < sliceStart[k+1]; p++)
+    {
+    sliceIndex[blockOrder[p]] = k;
+    colIndex[blockOrder[p]]   = p - sliceStart[k];
+    }}
+
+    std::vector<long> valueOrder(M);
+    for(long i = 0; i < M; i++) {valueOrder[i] = i;}
+
+    std::sort(valueOrder.begin(),valueOrder.end(),[&](long a, long b)
+    {
+    if(W[a] != W[b]) {return W[a] < W[b];}
+    return a < b;
+    });
+
+    std::vector<double>  wSorted(M);
+    std::vector<long>    iblockSorted(M);
+
+    Q.initialize(N,M);
+
+    for(long j = 0; j < M; j++)
+    {
+    long i          = valueOrder[j];
+    wSorted[j]      = W[i];
+    iblockSorted[j] = IBLOCK[i];
+    std::memcpy(Q.getDataPointer() + j*N, Zslice[sliceIndex[i]].getDataPointer() + colIndex[i]*N, N*sizeof(double));
+    }
+
+    W      = wSorted;
+    IBLOCK = iblockSorted;
+}
+
+long getSliceThreadCount(long threadCount, long taskCount)
+{
+    if(threadCount <= 0)        {threadCount = (long)std::thread::hardware_concurrency();}
+    if(threadCount > taskCount) {threadCount = taskCount;}
+    if(threadCount < 1)         {threadCount = 1;}
+    return threadCount;
 }
 };
+
+//
+//##############################################################################
+//                   CYCLIC TRIDIAGONAL MATRIX SOLVER
+//##############################################################################
+//
+// Class CyclicTriDiagSolver : Created for solving A*X = B when A is an N x N
+// cyclic (periodic) tridiagonal matrix, e.g. a tridiagonal matrix with
+// additional non-zero corner entries
+//
+//    A(0,N-1)  = upperCorner
+//    A(N-1,0)  = lowerCorner
+//
+// The system is solved using the Sherman-Morrison formula applied to
+//
+//    A = T + u*v^T
+//
+// where T is tridiagonal, u = [gamma,0,...,0,lowerCorner]^T,
+// v = [1,0,...,0,upperCorner/gamma]^T and gamma = -D[0]. The LU factors
+// of T (dgttrf) and the solution of T*z = u are cached by createFactors(...)
+// so that each subsequent solve requires only a single invocation of
+// dgttrs and O(N) operations per right hand side.
+//
+// The diagonal component is specified with a double vector of size N, and
+// the sub- and super-diagonal components with double vectors of size N-1.
+// N must be >= 3.
+//
+class CyclicTriDiagSolver
+{
+public:
+
+	CyclicTriDiagSolver()
+	{
+	initialize();
+	}
+
+	CyclicTriDiagSolver(const CyclicTriDiagSolver& S)
+	{
+	initialize(S);
+	}
+
+	void initialize()
+	{
+	N     = 0;
+	gamma = 0.0;
+	vN    = 0.0;
+	denom = 0.0;
+	DL.clear();
+	D.clear();
+	DU.clear();
+	DU2.clear();
+	IPIV.clear();
+	Z.clear();
+	}
+
+	void initialize(const CyclicTriDiagSolver& S)
+	{
+	N     = S.N;
+	gamma = S.gamma;
+	vN    = S.vN;
+	denom = S.denom;
+	DL    = S.DL;
+	D     = S.D;
+	DU    = S.DU;
+	DU2   = S.DU2;
+	IPIV  = S.IPIV;
+	Z     = S.Z;
+	}
+
+	void createFactors(const std::vector<double>& DLin, const std::vector<double>& Din,
+	                   const std::vector<double>& DUin, double lowerCorner, double upperCorner)
+	{
+    N = (long)Din.size();
+
+    if(N < 3)
+    {
+    	std::stringstream sout;
+    	sout << "\nCyclicTriDiagSolver error \nError: System dimension must be >= 3";
+    	sout << "\nDimension of matrix = " << N;
+    	throw std::runtime_error(sout.str());
+    }
+
+    gamma = (Din[0] != 0.0) ? -Din[0] : -1.0;
+    vN    = upperCorner/gamma;
+
+    // Tridiagonal component T of A = T + u*v^T
+
+    DL = DLin;
+    D  = Din;
+    DU = DUin;
+
+    D[0]   -= gamma;
+    D[N-1] -= lowerCorner*vN;
+
+    triRoutines.realTriLUfactorization(DL,D,DU,DU2,IPIV);
+
+    // Cache z = T^{-1} u and the Sherman-Morrison denominator 1 + v^T z
+
+    Z.clear();
+    Z.resize(N,0.0);
+    Z[0]   = gamma;
+    Z[N-1] = lowerCorner;
+
+    solveTri(&Z[0],1);
+
+    denom = 1.0 + Z[0] + vN*Z[N-1];
+
+    if(denom == 0.0)
+    {
+    	std::stringstream sout;
+    	sout << "\nCyclicTriDiagSolver error \nError: Singular Sherman-Morrison correction \n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+	void applyInverse(std::vector<double>& f)
+	{
+	assert(sizeCheck((long)f.size(),1));
+	applyInverse(&f[0],1);
+	}
+
+	void applyInverse(LapackMatrix& F)
+	{
+	assert(sizeCheck(F.rows,F.cols));
+	applyInverse(F.dataPtr,F.cols);
+	}
+
+	//
+	// f points to NRHS contiguous right hand sides, each of size N, that
+	// are overwritten with the solutions.
+	//
+	void applyInverse(double* f, long NRHS = 1)
+	{
+    solveTri(f,NRHS);
+
+    double  alpha;
+    double* fk;
+
+    for(long k = 0; k < NRHS; k++)
+    {
+    fk    = f + k*N;
+    alpha = (fk[0] + vN*fk[N-1])/denom;
+    for(long i = 0; i < N; i++)
+    {
+    	fk[i] -= alpha*Z[i];
+    }
+    }
+	}
+
+	long getDimension() const
+	{
+	return N;
+	}
+
+	void solveTri(double* f, long NRHS)
+	{
+	char TRANS = 'N';
+	long LDB   = N;
+	long INFO  = 0;
+
+	dgttrs_(&TRANS, &N, &NRHS, &DL[0], &D[0], &DU[0], &DU2[0], &IPIV[0], f, &LDB, &INFO);
+
+    if(INFO != 0)
+    {
+    	std::stringstream sout;
+    	sout << "\nCyclicTriDiagSolver (dgttrs) \nError INFO = " << INFO << "\n";
+    	throw std::runtime_error(sout.str());
+    }
+	}
+
+#ifdef _DEBUG
+    bool sizeCheck(long rows, long cols) const
+    {
+    if((rows != N) || (cols < 1))
+    {
+    std::cerr  <<  "CyclicTriDiagSolver error               "  << "\n";
+    std::cerr  <<  "Right hand side must have N rows        "  << "\n";
+    std::cerr  <<  "N    : "  << N    << "\n";
+    std::cerr  <<  "rows : "  << rows << "\n";
+    std::cerr  <<  "cols : "  << cols << "\n";
+    return false;
+    }
+    return true;
+    }
+#else
+    bool sizeCheck(long, long) const {return true;}
+#endif
+
+	long                   N;
+	double             gamma;
+	double                vN;  // v[N-1] = upperCorner/gamma
+	double             denom;  // 1 + v^T T^{-1} u
+
+	// For caching factors of T
+
+	std::vector<double>   DL;
+	std::vector<double>    D;
+	std::vector<double>   DU;
+	std::vector<double>  DU2;
+	std::vector<long>   IPIV;
+	std::vector<double>    Z;  // T^{-1} u
+
+	TriDiagRoutines triRoutines;
+};
 }
 
 
@@ -1119,6 +1688,104 @@ Author
 Univ. of Tennessee
 Univ. of California Berkeley
 Univ. of Colorado Denver
+NAG Ltd.
+
+ */
+////////////////////////////////////////////////////////////////
+// DSTEIN
+////////////////////////////////////////////////////////////////
+/*
+DSTEIN computes the eigenvectors of a real symmetric tridiagonal
+matrix T corresponding to specified eigenvalues, using inverse
+iteration.
+
+subroutine dstein	(	integer 	n,
+double precision, dimension( * ) 	d,
+double precision, dimension( * ) 	e,
+integer 	m,
+double precision, dimension( * ) 	w,
+integer, dimension( * ) 	iblock,
+integer, dimension( * ) 	isplit,
+double precision, dimension( ldz, * ) 	z,
+integer 	ldz,
+double precision, dimension( * ) 	work,
+integer, dimension( * ) 	iwork,
+integer, dimension( * ) 	ifail,
+integer 	info
+)
+
+Purpose:
+ DSTEIN computes the eigenvectors of a real symmetric tridiagonal
+ matrix T corresponding to specified eigenvalues, using inverse
+ iteration.
+
+ The maximum number of iterations allowed for each eigenvector is
+ specified by an internal parameter MAXITS (currently set to 5).
+Parameters
+[in]	N
+          N is INTEGER
+          The order of the matrix.  N >= 0.
+[in]	D
+          D is DOUBLE PRECISION array, dimension (N)
+          The n diagonal elements of the tridiagonal matrix T.
+[in]	E
+          E is DOUBLE PRECISION array, dimension (N-1)
+          The (n-1) subdiagonal elements of the tridiagonal matrix
+          T, in elements 1 to N-1.
+[in]	M
+          M is INTEGER
+          The number of eigenvectors to be found.  0 <= M <= N.
+[in]	W
+          W is DOUBLE PRECISION array, dimension (N)
+          The first M elements of W contain the eigenvalues for
+          which eigenvectors are to be computed.  The eigenvalues
+          should be grouped by split-off block and ordered from
+          smallest to largest within the block.  ( The output array
+          W from DSTEBZ with ORDER = 'B' is expected here. )
+[in]	IBLOCK
+          IBLOCK is INTEGER array, dimension (N)
+          The submatrix indices associated with the corresponding
+          eigenvalues in W; IBLOCK(i)=1 if eigenvalue W(i) belongs to
+          the first submatrix from the top, =2 if W(i) belongs to
+          the second submatrix, etc.  ( The output array IBLOCK
+          from DSTEBZ is expected here. )
+[in]	ISPLIT
+          ISPLIT is INTEGER array, dimension (N)
+          The splitting points, at which T breaks up into submatrices.
+          The first submatrix consists of rows/columns 1 to
+          ISPLIT( 1 ), the second of rows/columns ISPLIT( 1 )+1
+          through ISPLIT( 2 ), etc.
+          ( The output array ISPLIT from DSTEBZ is expected here. )
+[out]	Z
+          Z is DOUBLE PRECISION array, dimension (LDZ, M)
+          The computed eigenvectors.  The eigenvector associated
+          with the eigenvalue W(i) is stored in the i-th column of
+          Z.  Any vector which fails to converge is set to its current
+          iterate after MAXITS iterations.
+[in]	LDZ
+          LDZ is INTEGER
+          The leading dimension of the array Z.  LDZ >= max(1,N).
+[out]	WORK
+          WORK is DOUBLE PRECISION array, dimension (5*N)
+[out]	IWORK
+          IWORK is INTEGER array, dimension (N)
+[out]	IFAIL
+          IFAIL is INTEGER array, dimension (M)
+          On normal exit, all elements of IFAIL are zero.
+          If one or more eigenvectors fail to converge after
+          MAXITS iterations, then their indices are stored in
+          array IFAIL.
+[out]	INFO
+          INFO is INTEGER
+          = 0: successful exit.
+          < 0: if INFO = -i, the i-th argument had an illegal value
+          > 0: if INFO = i, then i eigenvectors failed to converge
+               in MAXITS iterations.  Their indices are stored in
+               array IFAIL.
+Author
+Univ. of Tennessee
+Univ. of California Berkeley
+Univ. of Colorado Denver
 NAG Ltd.
 
  */